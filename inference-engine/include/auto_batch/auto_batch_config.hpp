@@ -0,0 +1,54 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for Auto Batching plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods
+ *
+ * @file auto_batch_config.hpp
+ */
+
+#pragma once
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Auto Batching plugin configuration
+ */
+namespace AutoBatchConfigParams {
+
+/**
+ * @def AUTO_BATCH_CONFIG_KEY(name)
+ * @brief A macro which provides an AUTO_BATCH-mangled name for configuration key with name `name`
+ */
+#define AUTO_BATCH_CONFIG_KEY(name) InferenceEngine::AutoBatchConfigParams::_CONFIG_KEY(AUTO_BATCH_##name)
+
+#define DECLARE_AUTO_BATCH_CONFIG_KEY(name) DECLARE_CONFIG_KEY(AUTO_BATCH_##name)
+
+/**
+ * @brief Device config option, with the device to execute the batched network on and the batch size in brackets,
+ * e.g. "CPU(4)". The `BATCH:CPU(4)` device name sets this option implicitly.
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG);
+
+/**
+ * @brief Time in milliseconds to wait for the batch to be collected, counted from the oldest pending request.
+ * When the time is out, the requests collected so far are executed as a partial batch. Default value is "5".
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(TIMEOUT);
+
+}  // namespace AutoBatchConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get the achieved batch sizes of the network loaded to the BATCH device.
+ * The i-th element is the number of batched inferences executed with (i + 1) requests collected.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(AUTO_BATCH_SIZE_HISTOGRAM, std::vector<unsigned int>);
+
+}  // namespace Metrics
+}  // namespace InferenceEngine
@@ -0,0 +1,74 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for advanced hardware related properties for CPU plugin
+ *        To use in SetConfig() and GetMetric() methods of plugins
+ *
+ * @file cpu_config.hpp
+ */
+#pragma once
+
+#include <map>
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+namespace Metrics {
+
+/**
+ * @def CPU_METRIC_KEY(name)
+ * @brief shortcut for defining CPU plugin metrics
+ */
+#define CPU_METRIC_KEY(name) METRIC_KEY(CPU_##name)
+#define DECLARE_CPU_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(CPU_##name, __VA_ARGS__)
+
+/**
+ * @brief Metric to get the number of primitives taken from the process-wide CPU primitive cache
+ */
+DECLARE_CPU_METRIC_KEY(PRIMITIVE_CACHE_HITS, uint64_t);
+
+/**
+ * @brief Metric to get the number of cacheable primitives which were created (JIT compiled) because they were not found
+ * in the process-wide CPU primitive cache
+ */
+DECLARE_CPU_METRIC_KEY(PRIMITIVE_CACHE_MISSES, uint64_t);
+
+/**
+ * @brief Metric to get the number of primitives currently stored in the process-wide CPU primitive cache
+ */
+DECLARE_CPU_METRIC_KEY(PRIMITIVE_CACHE_SIZE, uint64_t);
+
+/**
+ * @brief Metric to get the number of bytes of weights and intermediate buffers bound to each NUMA node, the key is
+ * the NUMA node id. Memory of the networks executed with several streams is bound to the NUMA nodes of the streams.
+ * The map is empty if there is only one NUMA node or the threading library doesn't report them.
+ */
+DECLARE_CPU_METRIC_KEY(NUMA_NODES_BOUND_BYTES, std::map<int, uint64_t>);
+
+}  // namespace Metrics
+
+/**
+ * @brief CPU plugin configuration
+ */
+namespace CPUConfigParams {
+
+/**
+ * @brief shortcut for defining configuration keys
+ */
+#define CPU_CONFIG_KEY(name) InferenceEngine::CPUConfigParams::_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_KEY(name) DECLARE_CONFIG_KEY(CPU_##name)
+
+/**
+ * @brief Capacity of the process-wide cache of created CPU primitives (JIT kernels).
+ * Identical primitives of all executable networks loaded to the CPU plugin are created only once while they are in
+ * the cache. This option should be used with a non-negative integer value, 0 disables the cache.
+ * The cache is shared by all networks, so the value set by the last call takes effect. Default value is 1024.
+ */
+DECLARE_CPU_CONFIG_KEY(PRIMITIVE_CACHE_CAPACITY);
+
+}  // namespace CPUConfigParams
+
+}  // namespace InferenceEngine
@@ -381,6 +381,20 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief The key enables memory mapping of IR weights (.bin) files instead of reading them into memory.
+ *
+ * Constant operations reference the mapped data without copying, pages are loaded on demand and
+ * shared via page cache between processes that read the same model.
+ * The key is applied by Core only, so it must be set without device name. Possible values: YES / NO (default).
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(MMAP_WEIGHTS), CONFIG_VALUE(YES)}});
+ * auto network = ie.ReadNetwork("model.xml");
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(MMAP_WEIGHTS);
+
 }  // namespace PluginConfigParams
 
 /**
@@ -400,6 +414,7 @@ DECLARE_AUTO_CONFIG_KEY(DEVICE_LIST);
 
 #include "hetero/hetero_plugin_config.hpp"
 #include "multi-device/multi_device_config.hpp"
+#include "auto_batch/auto_batch_config.hpp"
 
 // remove in 2022.1 major release
 #include "cldnn/cldnn_config.hpp"
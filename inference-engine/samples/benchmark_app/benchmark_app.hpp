@@ -40,6 +40,16 @@ static const char infer_requests_count_message[] = "Optional. Number of infer re
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for target arrival rate
+static const char rate_message[] = "Optional. Target arrival rate of inference requests per second. When specified, the requests are "
+                                   "issued in open loop at the given rate regardless of the completion of the previous ones "
+                                   "(supported for async API only) and the latency includes the time the request waited "
+                                   "for an idle infer request.";
+
+/// @brief message for arrival distribution
+static const char arrival_message[] = "Optional. Distribution of the request arrivals in open loop mode: \"constant\" for the fixed "
+                                      "interval or \"poisson\" for exponentially distributed intervals. Default value is \"constant\".";
+
 /// @brief message for #threads for CPU inference
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for inference on the CPU "
                                                 "(including HETERO and MULTI cases).";
@@ -182,6 +192,12 @@ DEFINE_uint32(t, 0, execution_time_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
+/// @brief Target arrival rate of requests per second, enables open loop mode (default 0)
+DEFINE_double(rate, 0, rate_message);
+
+/// @brief Distribution of the request arrivals in open loop mode
+DEFINE_string(arrival, "constant", arrival_message);
+
 /// @brief Number of threads to use for inference on the CPU in throughput mode (also affects Hetero
 /// cases)
 DEFINE_uint32(nthreads, 0, infer_num_threads_message);
@@ -273,6 +289,8 @@ static void showUsage() {
     std::cout << "    -b \"<integer>\"            " << batch_size_message << std::endl;
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
+    std::cout << "    -rate \"<float>\"           " << rate_message << std::endl;
+    std::cout << "    -arrival \"<constant/poisson>\"   " << arrival_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << "    -layout                   " << layout_message << std::endl;
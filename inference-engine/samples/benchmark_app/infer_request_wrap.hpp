@@ -21,7 +21,7 @@
 typedef std::chrono::high_resolution_clock Time;
 typedef std::chrono::nanoseconds ns;
 
-typedef std::function<void(size_t id, const double latency)> QueueCallbackFunction;
+typedef std::function<void(size_t id, const double latency, const double queueingDelay)> QueueCallbackFunction;
 
 /// @brief Wrapper class for InferenceEngine::InferRequest. Handles asynchronous callbacks and calculates execution time.
 class InferReqWrap final {
@@ -34,11 +34,17 @@ public:
         : _request(net.CreateInferRequest()), _id(id), _callbackQueue(callbackQueue) {
         _request.SetCompletionCallback([&]() {
             _endTime = Time::now();
-            _callbackQueue(_id, getExecutionTimeInMilliseconds());
+            _callbackQueue(_id, getExecutionTimeInMilliseconds(), getQueueingDelayInMilliseconds());
         });
     }
 
     void startAsync() {
+        startAsync(Time::now());
+    }
+
+    /// @brief Starts the request which arrived at the given time, the time before the start is counted as queueing delay
+    void startAsync(const Time::time_point& arrivalTime) {
+        _arrivalTime = arrivalTime;
         _startTime = Time::now();
         _request.StartAsync();
     }
@@ -49,9 +55,10 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.Infer();
         _endTime = Time::now();
-        _callbackQueue(_id, getExecutionTimeInMilliseconds());
+        _callbackQueue(_id, getExecutionTimeInMilliseconds(), getQueueingDelayInMilliseconds());
     }
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> getPerformanceCounts() {
@@ -67,8 +74,14 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double getQueueingDelayInMilliseconds() const {
+        auto queueingTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueingTime.count()) * 0.000001;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -79,8 +92,8 @@ class InferRequestsQueue final {
 public:
     InferRequestsQueue(InferenceEngine::ExecutableNetwork& net, size_t nireq) {
         for (size_t id = 0; id < nireq; id++) {
-            requests.push_back(
-                std::make_shared<InferReqWrap>(net, id, std::bind(&InferRequestsQueue::putIdleRequest, this, std::placeholders::_1, std::placeholders::_2)));
+            requests.push_back(std::make_shared<InferReqWrap>(
+                net, id, std::bind(&InferRequestsQueue::putIdleRequest, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)));
             _idleIds.push(id);
         }
         resetTimes();
@@ -98,15 +111,17 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueingDelays.clear();
     }
 
     double getDurationInMilliseconds() {
         return std::chrono::duration_cast<ns>(_endTime - _startTime).count() * 0.000001;
     }
 
-    void putIdleRequest(size_t id, const double latency) {
+    void putIdleRequest(size_t id, const double latency, const double queueingDelay) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _queueingDelays.push_back(queueingDelay);
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -134,6 +149,10 @@ public:
         return _latencies;
     }
 
+    std::vector<double> getQueueingDelays() {
+        return _queueingDelays;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -143,4 +162,5 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueingDelays;
 };
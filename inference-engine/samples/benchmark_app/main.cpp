@@ -4,15 +4,18 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <gna/gna_config.hpp>
 #include <gpu/gpu_config.hpp>
 #include <inference_engine.hpp>
 #include <map>
 #include <memory>
+#include <random>
 #include <samples/args_helper.hpp>
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <vpu/vpu_plugin_config.hpp>
@@ -56,6 +59,18 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
 
+    if (FLAGS_rate < 0) {
+        throw std::logic_error("Incorrect arrival rate. Please set -rate option to a positive value.");
+    }
+
+    if (FLAGS_rate > 0 && FLAGS_api != "async") {
+        throw std::logic_error("Open loop mode is supported only for async API. Please set -api option to `async` value.");
+    }
+
+    if (FLAGS_arrival != "constant" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `constant` or `poisson` value.");
+    }
+
     if (!FLAGS_report_type.empty() && FLAGS_report_type != noCntReport && FLAGS_report_type != averageCntReport && FLAGS_report_type != detailedCntReport) {
         std::string err = "only " + std::string(noCntReport) + "/" + std::string(averageCntReport) + "/" + std::string(detailedCntReport) +
                           " report types are supported (invalid -report_type option value)";
@@ -101,12 +116,59 @@ static void next_step(const std::string additional_info = "") {
 
 template <typename T>
 T getMedianValue(const std::vector<T>& vec) {
+    if (vec.empty()) {
+        return static_cast<T>(0);
+    }
     std::vector<T> sortedVec(vec);
     std::sort(sortedVec.begin(), sortedVec.end());
     return (sortedVec.size() % 2 != 0) ? sortedVec[sortedVec.size() / 2ULL]
                                        : (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
 }
 
+template <typename T>
+T getPercentileValue(const std::vector<T>& sortedVec, double percentile) {
+    // nearest-rank method, so the tail percentiles are actually observed values
+    if (sortedVec.empty()) {
+        return static_cast<T>(0);
+    }
+    auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sortedVec.size()));
+    return sortedVec[std::min(std::max<size_t>(rank, 1ULL), sortedVec.size()) - 1ULL];
+}
+
+template <typename T>
+T getAverageValue(const std::vector<T>& vec) {
+    T sum = static_cast<T>(0);
+    for (auto&& value : vec) {
+        sum += value;
+    }
+    return vec.empty() ? sum : sum / vec.size();
+}
+
+/**
+ * @brief Counts the latencies in the buckets of geometrically growing width between the minimal and maximal values,
+ * so both the bulk of the distribution and its tail are visible
+ */
+StatisticsReport::Parameters getLatencyHistogram(const std::vector<double>& sortedLatencies, size_t bucketsCount) {
+    StatisticsReport::Parameters histogram;
+    if (sortedLatencies.empty())
+        return histogram;
+    const double minValue = std::max(sortedLatencies.front(), 0.001);
+    const double maxValue = std::max(sortedLatencies.back(), minValue);
+    const double ratio = std::pow(maxValue / minValue, 1.0 / bucketsCount);
+    double bound = minValue;
+    size_t index = 0;
+    for (size_t bucket = 0; bucket < bucketsCount; bucket++) {
+        bound = (bucket + 1 == bucketsCount) ? maxValue : bound * ratio;
+        size_t count = 0;
+        while (index < sortedLatencies.size() && sortedLatencies[index] <= bound) {
+            index++;
+            count++;
+        }
+        histogram.push_back({"<= " + double_to_string(bound), std::to_string(count)});
+    }
+    return histogram;
+}
+
 /**
  * @brief The entry point of the benchmark application
  */
@@ -471,9 +533,12 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        // Open loop mode: the requests arrive at the target rate independently of the completion of the previous ones
+        const bool openLoop = FLAGS_rate > 0;
+
         // Iteration limit
         uint32_t niter = FLAGS_niter;
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        if ((niter > 0) && (FLAGS_api == "async") && !openLoop) {
             niter = ((niter + nireq - 1) / nireq) * nireq;
             if (FLAGS_niter != niter) {
                 slog::warn << "Number of iterations was aligned by request number from " << FLAGS_niter << " to " << niter << " using number of requests "
@@ -504,6 +569,12 @@ int main(int argc, char* argv[]) {
                                           {"number of parallel infer requests", std::to_string(nireq)},
                                           {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
                                       });
+            if (openLoop) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG, {
+                                                                                          {"target arrival rate (requests/s)", double_to_string(FLAGS_rate)},
+                                                                                          {"arrival distribution", FLAGS_arrival},
+                                                                                      });
+            }
             for (auto& nstreams : device_nstreams) {
                 std::stringstream ss;
                 ss << "number of " << nstreams.first << " streams";
@@ -543,6 +614,9 @@ int main(int argc, char* argv[]) {
             if (!device_ss.str().empty()) {
                 ss << " using " << device_ss.str();
             }
+            if (openLoop) {
+                ss << ", " << FLAGS_arrival << " arrivals at " << double_to_string(FLAGS_rate) << " requests/s";
+            }
         }
         ss << ", limits: ";
         if (duration_seconds > 0) {
@@ -584,8 +658,22 @@ int main(int argc, char* argv[]) {
          * executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
+        // arrival times of the open loop mode, the generator is seeded to make the runs reproducible
+        std::mt19937 arrivalGenerator(0);
+        std::exponential_distribution<double> poissonIntervals(openLoop ? FLAGS_rate : 1.0);
+        auto nextArrivalInterval = [&]() {
+            const double seconds = (FLAGS_arrival == "poisson") ? poissonIntervals(arrivalGenerator) : 1.0 / FLAGS_rate;
+            return std::chrono::duration_cast<ns>(std::chrono::duration<double>(seconds));
+        };
+        auto arrivalTime = startTime;
+
         while ((niter != 0LL && iteration < niter) || (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+            if (openLoop) {
+                // the request which arrives when all infer requests are busy waits for an idle one,
+                // this time is counted as its queueing delay
+                std::this_thread::sleep_until(arrivalTime);
+            }
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 IE_THROW() << "No idle Infer Requests!";
@@ -601,7 +689,12 @@ int main(int argc, char* argv[]) {
                 // well, but as it uses just error codes it has no details like ‘what()’
                 // method of `std::exception` So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->startAsync();
+                if (openLoop) {
+                    inferRequest->startAsync(arrivalTime);
+                    arrivalTime += nextArrivalInterval();
+                } else {
+                    inferRequest->startAsync();
+                }
             }
             iteration++;
 
@@ -624,9 +717,27 @@ int main(int argc, char* argv[]) {
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        // in open loop mode the latency of the request is counted from its arrival, so it includes the queueing delay
+        auto computeTimes = inferRequestsQueue.getLatencies();
+        auto queueingDelays = inferRequestsQueue.getQueueingDelays();
+        auto latencies = computeTimes;
+        if (openLoop) {
+            for (size_t i = 0; i < latencies.size(); i++) {
+                latencies[i] += queueingDelays[i];
+            }
+        }
+        std::sort(latencies.begin(), latencies.end());
+        std::sort(queueingDelays.begin(), queueingDelays.end());
+
+        double latency = getMedianValue<double>(latencies);
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency : batchSize * 1000.0 * iteration / totalDuration;
+        const std::vector<std::pair<std::string, double>> latencyPercentiles = {
+            {"p50", getPercentileValue(latencies, 50.0)},
+            {"p90", getPercentileValue(latencies, 90.0)},
+            {"p99", getPercentileValue(latencies, 99.0)},
+            {"p99.9", getPercentileValue(latencies, 99.9)},
+        };
 
         if (statistics) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
@@ -637,6 +748,19 @@ int main(int argc, char* argv[]) {
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {
                                                                                              {"latency (ms)", double_to_string(latency)},
                                                                                          });
+                for (auto&& percentile : latencyPercentiles) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {{"latency " + percentile.first + " (ms)", double_to_string(percentile.second)}});
+                }
+                if (openLoop) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                  {"average queueing delay (ms)", double_to_string(getAverageValue(queueingDelays))},
+                                                  {"queueing delay p99 (ms)", double_to_string(getPercentileValue(queueingDelays, 99.0))},
+                                                  {"average compute time (ms)", double_to_string(getAverageValue(computeTimes))},
+                                              });
+                }
+                statistics->addParameters(StatisticsReport::Category::LATENCY_HISTOGRAM, getLatencyHistogram(latencies, 20));
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, {{"throughput", double_to_string(fps)}});
         }
@@ -684,8 +808,19 @@ int main(int argc, char* argv[]) {
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            std::cout << "Percentiles:";
+            for (auto&& percentile : latencyPercentiles) {
+                std::cout << " " << percentile.first << " " << double_to_string(percentile.second) << " ms";
+            }
+            std::cout << std::endl;
+            if (openLoop) {
+                std::cout << "Queueing:   " << double_to_string(getAverageValue(queueingDelays)) << " ms average, "
+                          << double_to_string(getPercentileValue(queueingDelays, 99.0)) << " ms p99" << std::endl;
+                std::cout << "Compute:    " << double_to_string(getAverageValue(computeTimes)) << " ms average" << std::endl;
+            }
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
@@ -33,6 +33,7 @@ public:
         COMMAND_LINE_PARAMETERS,
         RUNTIME_CONFIG,
         EXECUTION_RESULTS,
+        LATENCY_HISTOGRAM,
     };
 
     explicit StatisticsReport(Config config): _config(std::move(config)) {
@@ -0,0 +1,556 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+#include <unordered_map>
+
+#include <ie_metric_helpers.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_icore.hpp>
+#include <ie_algorithm.hpp>
+#include <ie_ngraph_utils.hpp>
+#include <blob_factory.hpp>
+#include "auto_batch.hpp"
+
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+namespace {
+    std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                    const std::map<std::string, std::string> & local) {
+        for (auto && kvp : local) {
+            config[kvp.first] = kvp.second;
+        }
+        return config;
+    }
+
+    // the batch can be sliced into the contiguous per-request slots only if the batch is the outermost dimension
+    bool isBatchOutermost(const TensorDesc& desc) {
+        switch (desc.getLayout()) {
+            case Layout::NCHW:
+            case Layout::NHWC:
+            case Layout::NCDHW:
+            case Layout::NDHWC:
+            case Layout::NC:
+                return desc.getDims()[0] == 1;
+            default:
+                return false;
+        }
+    }
+
+    // the batched blob is sliced into the contiguous per-request slots of slotSize bytes
+    LockedMemory<void> mapBatchedBlob(const AutoBatchExecutableNetwork::WorkerInferRequest& workerRequest,
+                                          const std::string& name, size_t slotSize) {
+        auto batchedBlob = as<MemoryBlob>(workerRequest._inferRequest->GetBlob(name));
+        if (!batchedBlob) {
+            IE_THROW(NotImplemented) << "BATCH device supports only memory blobs of the device network, "
+                                     << "the blob of '" << name << "' is not";
+        }
+        if (batchedBlob->byteSize() != slotSize * workerRequest._batchSize) {
+            IE_THROW() << "The blob of '" << name << "' of the device network is not batched along the outermost dimension";
+        }
+        return batchedBlob->rwmap();
+    }
+}  // namespace
+
+// ------------------------------AutoBatchInferRequest----------------------------
+AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap&   networkInputs,
+                                             const OutputsDataMap&  networkOutputs)
+        : IInferRequestInternal(networkInputs, networkOutputs) {
+    // the slot of the batch is known only when the batch is collected, so the data is copied to and from the slots
+    for (const auto &it : _networkInputs) {
+        _inputs[it.first] = make_blob_with_precision(it.second->getTensorDesc());
+        _inputs[it.first]->allocate();
+    }
+    for (const auto &it : _networkOutputs) {
+        _outputs[it.first] = make_blob_with_precision(it.second->getTensorDesc());
+        _outputs[it.first]->allocate();
+    }
+}
+
+void AutoBatchInferRequest::PrepareInputs() {
+    // this request is already in BUSY state, so using the internal functions safely
+    execDataPreprocessing(_inputs);
+    for (const auto &it : _networkInputs) {
+        if (!as<MemoryBlob>(GetBlob(it.first))) {
+            IE_THROW(NotImplemented) << "BATCH device supports only memory blobs as inputs, the blob of '"
+                                     << it.first << "' is not";
+        }
+    }
+    for (const auto &it : _networkOutputs) {
+        if (!as<MemoryBlob>(GetBlob(it.first))) {
+            IE_THROW(NotImplemented) << "BATCH device supports only memory blobs as outputs, the blob of '"
+                                     << it.first << "' is not";
+        }
+    }
+}
+
+void AutoBatchInferRequest::CopyInputsToSlot(AutoBatchExecutableNetwork::WorkerInferRequest* workerRequest, int batchId) {
+    _workerRequest = workerRequest;
+    _batchId = batchId;
+    for (const auto &it : _networkInputs) {
+        auto src = as<MemoryBlob>(GetBlob(it.first));
+        const auto slotSize = src->byteSize();
+        auto dstMap = mapBatchedBlob(*_workerRequest, it.first, slotSize);
+        auto srcMap = src->rmap();
+        std::memcpy(dstMap.as<uint8_t*>() + _batchId * slotSize, srcMap.as<const uint8_t*>(), slotSize);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromSlot() {
+    for (const auto &it : _networkOutputs) {
+        auto dst = as<MemoryBlob>(GetBlob(it.first));
+        const auto slotSize = dst->byteSize();
+        auto srcMap = mapBatchedBlob(*_workerRequest, it.first, slotSize);
+        auto dstMap = dst->wmap();
+        std::memcpy(dstMap.as<uint8_t*>(), srcMap.as<const uint8_t*>() + _batchId * slotSize, slotSize);
+    }
+}
+
+std::map<std::string, InferenceEngineProfileInfo> AutoBatchInferRequest::GetPerformanceCounts() const {
+    IE_THROW(NotImplemented);
+}
+
+void AutoBatchInferRequest::InferImpl() {
+    IE_THROW(NotImplemented);
+}
+
+// ------------------------------AutoBatchAsyncInferRequest----------------------------
+AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
+    const AutoBatchInferRequest::Ptr&           inferRequest,
+    const bool                                  needPerfCounters,
+    const AutoBatchExecutableNetwork::Ptr&      autoBatchExecutableNetwork,
+    const ITaskExecutor::Ptr&                   callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _autoBatchExecutableNetwork{autoBatchExecutableNetwork},
+    _inferRequest{inferRequest},
+    _needPerfCounters{needPerfCounters} {
+    // this executor puts the request to the batch while the task (checking the result) is run on the batch completion
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_autoBatchExecutableNetwork->ScheduleToWorkerInferRequest(_this->_inferRequest.get(), std::move(task));
+        };
+        AutoBatchAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        // the inputs are checked in the user's thread, so the wrong blobs of the request do not fail the whole batch
+        { /*TaskExecutor*/ std::make_shared<ImmediateExecutor>(), /*task*/ [this] {
+              _inferRequest->PrepareInputs();
+        }},
+        // final task in the pipeline, run for every request of the completed batch:
+        { /*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+              auto& workerRequest = *_inferRequest->_workerRequest;
+              if (nullptr != workerRequest._exceptionPtr) {
+                  std::rethrow_exception(workerRequest._exceptionPtr);
+              }
+              _inferRequest->CopyOutputsFromSlot();
+              if (_needPerfCounters)
+                  _perfMap = workerRequest._inferRequest->GetPerformanceCounts();
+        }}
+    };
+}
+
+void AutoBatchAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+std::map<std::string, InferenceEngineProfileInfo> AutoBatchAsyncInferRequest::GetPerformanceCounts() const {
+    CheckState();
+    return std::move(_perfMap);
+}
+
+AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
+    StopAndWait();
+}
+
+// ------------------------------AutoBatchExecutableNetwork----------------------------
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(const SoExecutableNetworkInternal&                          networkForDevice,
+                                                       const DeviceInformation&                                    networkDevice,
+                                                       const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
+                                                       const bool                                                  needPerfCounters) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _network{networkForDevice},
+    _device{networkDevice},
+    _config{config},
+    _needPerfCounters{needPerfCounters},
+    _timeout{std::stoi(config.at(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT).as<std::string>())},
+    _batchSizeHistogram{new std::atomic<unsigned int>[networkDevice.batchForDevice]} {
+    _taskExecutor.reset();
+    for (int i = 0; i < _device.batchForDevice; i++) {
+        _batchSizeHistogram[i] = 0;
+    }
+    _thread = std::thread([this] {
+        WorkerThreadLoop();
+    });
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    /* NOTE: The user requests hold the network, so all of them are already destroyed and none of the requests is
+     *       pending. The worker thread is stopped first, then the batched requests wait for the completion callbacks
+     */
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _terminate = true;
+    }
+    _cond.notify_one();
+    _thread.join();
+    for (auto&& workerRequest : _workerRequests) {
+        workerRequest->_inferRequest = {};
+    }
+    _workerRequests.clear();
+}
+
+void AutoBatchExecutableNetwork::ScheduleToWorkerInferRequest(AutoBatchInferRequest* request, Task task) {
+    size_t numPending = 0;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _pendingRequests.push_back({request, std::move(task), std::chrono::steady_clock::now()});
+        numPending = _pendingRequests.size();
+    }
+    // the worker thread waits either for the first request or for the full batch
+    if (numPending == 1 || numPending == static_cast<size_t>(_device.batchForDevice))
+        _cond.notify_one();
+}
+
+void AutoBatchExecutableNetwork::WorkerThreadLoop() {
+    const auto batchSize = static_cast<size_t>(_device.batchForDevice);
+    std::unique_lock<std::mutex> lock{_mutex};
+    while (true) {
+        _cond.wait(lock, [&] {
+            return _terminate || (!_idleWorkerRequests.empty() && !_pendingRequests.empty());
+        });
+        if (_terminate)
+            break;
+        // the rest of the batch is collected until the timeout counted from the oldest pending request is over
+        _cond.wait_until(lock, _pendingRequests.front()._time + _timeout, [&] {
+            return _terminate || _pendingRequests.size() >= batchSize;
+        });
+        if (_terminate)
+            break;
+        // any idle batched request takes the oldest pending requests, so the slots are filled in the arrival order
+        auto workerRequestPtr = _idleWorkerRequests.back();
+        _idleWorkerRequests.pop_back();
+        const auto numCollected = (std::min)(batchSize, _pendingRequests.size());
+        std::vector<PendingRequest> collected{std::make_move_iterator(_pendingRequests.begin()),
+                                              std::make_move_iterator(_pendingRequests.begin() + numCollected)};
+        _pendingRequests.erase(_pendingRequests.begin(), _pendingRequests.begin() + numCollected);
+        _batchSizeHistogram[numCollected - 1]++;
+        lock.unlock();
+        // partial batch is executed at the full batch size, the data of the slots without requests is ignored
+        auto& workerRequest = *workerRequestPtr;
+        try {
+            workerRequest._exceptionPtr = nullptr;
+            for (size_t i = 0; i < collected.size(); i++) {
+                collected[i]._request->CopyInputsToSlot(workerRequestPtr, static_cast<int>(i));
+                workerRequest._completionTasks.push_back(std::move(collected[i]._task));
+            }
+            workerRequest._inferRequest->StartAsync();
+        } catch (...) {
+            // the requests which have not taken the slot yet are completed with the exception as well
+            for (size_t i = workerRequest._completionTasks.size(); i < collected.size(); i++) {
+                collected[i]._request->_workerRequest = workerRequestPtr;
+                workerRequest._completionTasks.push_back(std::move(collected[i]._task));
+            }
+            CompleteBatch(workerRequestPtr, std::current_exception());
+        }
+        lock.lock();
+    }
+}
+
+void AutoBatchExecutableNetwork::CompleteBatch(WorkerInferRequest* workerRequestPtr, std::exception_ptr exceptionPtr) {
+    // runs the tasks of the requests from the completed batch, these copy the outputs or rethrow the exception
+    workerRequestPtr->_exceptionPtr = exceptionPtr;
+    {
+        auto completionTasks = std::move(workerRequestPtr->_completionTasks);
+        workerRequestPtr->_completionTasks.clear();
+        for (auto&& task : completionTasks) {
+            task();
+        }
+    }
+    // the batched request is reused only after all the outputs are copied from its slots
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _idleWorkerRequests.push_back(workerRequestPtr);
+    }
+    _cond.notify_one();
+}
+
+RemoteContext::Ptr AutoBatchExecutableNetwork::GetContext() const {
+    return _network->GetContext();
+}
+
+InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                                              InferenceEngine::OutputsDataMap networkOutputs) {
+    // every batchForDevice user requests add a batched request, so all the created requests can run at once
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_numRequestsCreated % _device.batchForDevice == 0) {
+        auto workerRequest = std::make_shared<WorkerInferRequest>();
+        workerRequest->_inferRequest = { _network, _network->CreateInferRequest() };
+        workerRequest->_batchSize = _device.batchForDevice;
+        auto* workerRequestPtr = workerRequest.get();
+        workerRequest->_inferRequest->SetCallback([this, workerRequestPtr] (std::exception_ptr exceptionPtr) {
+            CompleteBatch(workerRequestPtr, exceptionPtr);
+        });
+        _workerRequests.push_back(workerRequest);
+        _idleWorkerRequests.push_back(workerRequestPtr);
+        _cond.notify_one();
+    }
+    _numRequestsCreated++;
+    return std::make_shared<AutoBatchInferRequest>(networkInputs, networkOutputs);
+}
+
+IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    return std::make_shared<AutoBatchAsyncInferRequest>(std::static_pointer_cast<AutoBatchInferRequest>(syncRequestImpl),
+                                                        _needPerfCounters,
+                                                        std::static_pointer_cast<AutoBatchExecutableNetwork>(shared_from_this()),
+                                                        _callbackExecutor);
+}
+
+void AutoBatchExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
+    IE_THROW(NotImplemented) << "BATCH device does not support the Network's SetConfig, "
+                             << "the batch size and the timeout are set when the network is loaded";
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetConfig(const std::string &name) const {
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        return it->second;
+    } else {
+        IE_THROW(NotFound) << name <<" not found in the ExecutableNetwork config";
+    }
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::string &name) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        unsigned int res = 0u;
+        try {
+            res = _network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const InferenceEngine::Exception &iie) {
+            IE_THROW()
+                    << "The device used with the BATCH should "
+                    << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                    << "Failed to query the metric for the " << _device.deviceName << " with error:" << iie.what();
+        }
+        // every batched request serves the full batch of the user requests
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res * _device.batchForDevice);
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _network->GetMetric(
+            METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(AUTO_BATCH_SIZE_HISTOGRAM)) {
+        std::vector<unsigned int> histogram(_device.batchForDevice);
+        for (int i = 0; i < _device.batchForDevice; i++) {
+            histogram[i] = _batchSizeHistogram[i];
+        }
+        IE_SET_METRIC_RETURN(AUTO_BATCH_SIZE_HISTOGRAM, histogram);
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(AUTO_BATCH_SIZE_HISTOGRAM)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = {
+            AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG,
+            AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT };
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        IE_THROW() << "Unsupported Network metric: " << name;
+    }
+}
+
+// ------------------------------AutoBatchInferencePlugin----------------------------
+std::map<std::string, std::string> AutoBatchInferencePlugin::GetSupportedConfig(
+    const std::map<std::string, std::string> & config, const std::string & deviceName) const {
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+DeviceInformation AutoBatchInferencePlugin::ParseMetaDevice(const std::string& deviceWithBatch,
+                                                            const std::map<std::string, std::string> & config) const {
+    auto openingBracket = deviceWithBatch.find_first_of('(');
+    auto closingBracket = deviceWithBatch.find_first_of(')', openingBracket);
+    auto deviceWithID = deviceWithBatch.substr(0, openingBracket);
+
+    int batch = -1;
+    if (closingBracket != std::string::npos && openingBracket < closingBracket) {
+        batch = std::stoi(deviceWithBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1));
+    }
+    if (batch <= 0) {
+        IE_THROW() << "Batch value for '" << deviceWithID << "' must be set in brackets and be > 0, while '"
+                   << deviceWithBatch << "' is passed";
+    }
+
+    DeviceIDParser deviceParser(deviceWithID);
+    std::string deviceName = deviceParser.getDeviceName();
+    std::map<std::string, std::string> tconfig = mergeConfigs(_config, config);
+
+    // set device ID if any
+    std::string deviceIDLocal = deviceParser.getDeviceID();
+    if (!deviceIDLocal.empty()) {
+        tconfig[PluginConfigParams::KEY_DEVICE_ID] = deviceIDLocal;
+    }
+
+    return { deviceName, GetSupportedConfig(tconfig, deviceName), batch };
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetConfig(const std::string& name,
+        const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG) || name == AUTO_BATCH_CONFIG_KEY(TIMEOUT)) {
+        auto it = _config.find(name);
+        if (it == _config.end()) {
+            IE_THROW() << "Value for " << name << " is not set";
+        } else {
+            return { it->second };
+        }
+    } else {
+        IE_THROW() << "Unsupported config key: " << name;
+    }
+}
+
+void AutoBatchInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    for (auto && kvp : config) {
+        _config[kvp.first] = kvp.second;
+    }
+}
+
+static const Version version = {{2, 1}, CI_BUILD_NUMBER, "AutoBatchPlugin"};
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
+
+AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
+    _pluginName = "BATCH";
+    _config[AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT] = "5";
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string device_name = { "BATCH" };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = {
+            AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG,
+            AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT };
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        IE_THROW() << "Unsupported metric key " << name;
+    }
+}
+
+IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(const CNNNetwork &network,
+                                                                             const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with BATCH device via InferenceEngine::Core object";
+    }
+
+    if (network.getFunction() == nullptr) {
+        IE_THROW() << "BATCH device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        IE_THROW() << "KEY_AUTO_BATCH_DEVICE_CONFIG key is not set for BATCH device";
+    }
+    auto timeout = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT);
+    try {
+        if (std::stoi(timeout->second) < 0)
+            throw std::out_of_range("negative timeout");
+    } catch (const std::exception&) {
+        IE_THROW() << "Wrong value " << timeout->second << " for KEY_AUTO_BATCH_TIMEOUT, "
+                   << "expected non-negative number of milliseconds";
+    }
+
+    auto metaDevice = ParseMetaDevice(deviceConfig->second, fullConfig);
+
+    // the requests are collected into the batch of the network reshaped to the requested batch size
+    auto inputsInfo = network.getInputsInfo();
+    auto outputsInfo = network.getOutputsInfo();
+    for (auto&& info : inputsInfo) {
+        if (!isBatchOutermost(info.second->getTensorDesc()))
+            IE_THROW(NotImplemented) << "BATCH device supports only networks with the inputs of batch 1 in "
+                                     << "N* layouts, the input '" << info.first << "' is not";
+    }
+    for (auto&& info : outputsInfo) {
+        if (!isBatchOutermost(info.second->getTensorDesc()))
+            IE_THROW(NotImplemented) << "BATCH device supports only networks with the outputs of batch 1 in "
+                                     << "N* layouts, the output '" << info.first << "' is not";
+    }
+    auto batchedNetwork = details::cloneNetwork(network);
+    auto shapes = batchedNetwork.getInputShapes();
+    for (auto&& shape : shapes) {
+        shape.second[0] = metaDevice.batchForDevice;
+    }
+    batchedNetwork.reshape(shapes);
+    for (auto&& info : batchedNetwork.getOutputsInfo()) {
+        if (info.second->getTensorDesc().getDims()[0] != static_cast<size_t>(metaDevice.batchForDevice))
+            IE_THROW(NotImplemented) << "BATCH device supports only networks which outputs follow the batch of the "
+                                     << "inputs, the output '" << info.first << "' does not";
+    }
+
+    auto executableNetworkForDevice = GetCore()->LoadNetwork(batchedNetwork, metaDevice.deviceName, metaDevice.config);
+
+    std::unordered_map<std::string, InferenceEngine::Parameter> networkConfig;
+    networkConfig.insert(*deviceConfig);
+    networkConfig.insert(*timeout);
+    networkConfig.insert(metaDevice.config.begin(), metaDevice.config.end());
+
+    // checking the perf counters config from the loaded network to respect both device's plugin and load-specific setting
+    bool enablePerfCounters = false;
+    try {
+        enablePerfCounters =
+            executableNetworkForDevice->GetConfig(PluginConfigParams::KEY_PERF_COUNT).as<std::string>() ==
+            PluginConfigParams::YES;
+    } catch (...) {
+    }
+    return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkForDevice,
+                                                        metaDevice,
+                                                        networkConfig,
+                                                        enablePerfCounters);
+}
+
+QueryNetworkResult AutoBatchInferencePlugin::QueryNetwork(const CNNNetwork&                         network,
+                                                          const std::map<std::string, std::string>& config) const {
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        IE_THROW() << "KEY_AUTO_BATCH_DEVICE_CONFIG key is not set for BATCH device";
+    }
+    auto metaDevice = ParseMetaDevice(deviceConfig->second, fullConfig);
+    auto queryResult = GetCore()->QueryNetwork(network, metaDevice.deviceName, metaDevice.config);
+    for (auto&& layerQr : queryResult.supportedLayersMap) {
+        layerQr.second = GetName();
+    }
+    return queryResult;
+}
+
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,166 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
+
+namespace AutoBatchPlugin {
+
+using DeviceName = std::string;
+
+struct DeviceInformation {
+    DeviceName deviceName;
+    std::map<std::string, std::string> config;
+    int batchForDevice;
+};
+
+class AutoBatchInferRequest;
+
+class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+    /**
+     * @brief Batched request of the device network. The slots (indices in the batch) of the batched inputs and
+     * outputs are given to the user requests when the batch is collected, so any `_batchSize` requests of the
+     * network share any of the batched requests.
+     */
+    struct WorkerInferRequest {
+        using Ptr = std::shared_ptr<WorkerInferRequest>;
+        InferenceEngine::SoIInferRequestInternal                        _inferRequest;
+        int                                                             _batchSize = 0;
+        // tasks of the currently executed requests to run on the batch completion, the i-th request owns the i-th slot
+        std::vector<InferenceEngine::Task>                              _completionTasks;
+        std::exception_ptr                                              _exceptionPtr = nullptr;
+    };
+
+    /**
+     * @brief The user request waiting in the shared queue to be put to a batch
+     */
+    struct PendingRequest {
+        AutoBatchInferRequest*                                          _request;
+        InferenceEngine::Task                                           _task;
+        std::chrono::steady_clock::time_point                           _time;
+    };
+
+    explicit AutoBatchExecutableNetwork(const InferenceEngine::SoExecutableNetworkInternal&                 networkForDevice,
+                                        const DeviceInformation&                                            networkDevice,
+                                        const std::unordered_map<std::string, InferenceEngine::Parameter>&  config,
+                                        const bool                                                          needPerfCounters = false);
+
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+    InferenceEngine::Parameter GetConfig(const std::string &name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string &name) const override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                       InferenceEngine::OutputsDataMap networkOutputs) override;
+    InferenceEngine::RemoteContext::Ptr GetContext() const override;
+    ~AutoBatchExecutableNetwork();
+
+    // puts the request to the shared queue, the task is run when the batched inference of the request is completed
+    void ScheduleToWorkerInferRequest(AutoBatchInferRequest* request, InferenceEngine::Task task);
+
+protected:
+    void WorkerThreadLoop();
+    void CompleteBatch(WorkerInferRequest* workerRequest, std::exception_ptr exceptionPtr);
+
+    InferenceEngine::SoExecutableNetworkInternal                _network;
+    DeviceInformation                                           _device;
+    std::unordered_map<std::string, InferenceEngine::Parameter> _config;
+    bool                                                        _needPerfCounters = false;
+    std::chrono::milliseconds                                   _timeout;
+    // guards the queue of the pending requests, the idle batched requests and the termination flag
+    std::mutex                                                  _mutex;
+    std::condition_variable                                     _cond;
+    std::deque<PendingRequest>                                  _pendingRequests;
+    std::vector<WorkerInferRequest*>                            _idleWorkerRequests;
+    bool                                                        _terminate = false;
+    std::vector<WorkerInferRequest::Ptr>                        _workerRequests;
+    size_t                                                      _numRequestsCreated = 0;
+    std::thread                                                 _thread;
+    // the i-th element counts the batched inferences which were started with (i + 1) collected requests
+    std::unique_ptr<std::atomic<unsigned int>[]>                _batchSizeHistogram;
+};
+
+class AutoBatchInferRequest : public InferenceEngine::IInferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<AutoBatchInferRequest>;
+    explicit AutoBatchInferRequest(const InferenceEngine::InputsDataMap&                   networkInputs,
+                                   const InferenceEngine::OutputsDataMap&                  networkOutputs);
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    void InferImpl() override;
+
+    // Auto-Batching impl specific: pre-processes the inputs and checks that these can be copied to the batch
+    void PrepareInputs();
+    // Auto-Batching impl specific: takes the slot of the batched request and copies the inputs there
+    void CopyInputsToSlot(AutoBatchExecutableNetwork::WorkerInferRequest* workerRequest, int batchId);
+    // Auto-Batching impl specific: copies the taken slot of the batched request outputs to the user output blobs
+    void CopyOutputsFromSlot();
+
+    // the batched request and the slot taken by the request for the current inference
+    AutoBatchExecutableNetwork::WorkerInferRequest* _workerRequest = nullptr;
+    int                                             _batchId = 0;
+};
+
+class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchAsyncInferRequest>;
+
+    explicit AutoBatchAsyncInferRequest(const AutoBatchInferRequest::Ptr&           inferRequest,
+                                        const bool                                  needPerfCounters,
+                                        const AutoBatchExecutableNetwork::Ptr&      autoBatchExecutableNetwork,
+                                        const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    ~AutoBatchAsyncInferRequest();
+
+protected:
+    AutoBatchExecutableNetwork::Ptr                                     _autoBatchExecutableNetwork;
+    AutoBatchInferRequest::Ptr                                          _inferRequest;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _perfMap;
+    bool                                                                _needPerfCounters = false;
+};
+
+class AutoBatchInferencePlugin : public InferenceEngine::IInferencePlugin {
+public:
+    AutoBatchInferencePlugin();
+    ~AutoBatchInferencePlugin() = default;
+
+    InferenceEngine::IExecutableNetworkInternal::Ptr LoadExeNetworkImpl(const InferenceEngine::CNNNetwork&        network,
+                                                                       const std::map<std::string, std::string>& config) override;
+
+    void SetConfig(const std::map<std::string, std::string>& config) override;
+    InferenceEngine::Parameter GetConfig(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & options) const override;
+    InferenceEngine::QueryNetworkResult QueryNetwork(const InferenceEngine::CNNNetwork&        network,
+                                                     const std::map<std::string, std::string>& config) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+
+    DeviceInformation ParseMetaDevice(const std::string & deviceWithBatch,
+                                      const std::map<std::string, std::string> & config) const;
+
+protected:
+    std::map<std::string, std::string> GetSupportedConfig(const std::map<std::string, std::string>& config,
+                                                          const DeviceName & deviceName) const;
+};
+
+}  // namespace AutoBatchPlugin
@@ -1527,7 +1527,10 @@ InferenceEngine::IExecutableNetworkInternal::Ptr GNAPlugin::ImportNetwork(std::i
     graphCompiler.setGNAMemoryPtr(gnamem);
     void *basePtr = nullptr;
     gnamem->reserve_ptr(&basePtr, header.gnaMemSize);
-    gnamem->commit();
+    // the whole GNA memory is read from the model, so only the alignment tail needs zeroing
+    gnamem->commit(false);
+    std::fill(reinterpret_cast<uint8_t *>(basePtr) + header.gnaMemSize,
+              reinterpret_cast<uint8_t *>(basePtr) + gnamem->getTotalBytes(), 0);
 #if GNA_LIB_VER == 2
     gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>(header.layersCount)));
 #else
@@ -64,8 +64,9 @@ class GNAMemory : public GNAMemRequestsQueue {
 
     /**
      * @brief calculates size required for all requests, allocates memory and updates pointers
+     * @param zeroFill - set to false if the whole heap is overwritten right after the commit (e.g. on import)
      */
-    void commit() {
+    void commit(bool zeroFill = true) {
         // 1st stage -- looking for expandable bind requests:
         for (auto &originated : _future_heap) {
             if (originated._type & REQUEST_BIND) continue;
@@ -88,7 +89,7 @@ class GNAMemory : public GNAMemRequestsQueue {
         _total = _rw_section_size + _ro_section_size;
 
         // allocation with memory setting to 0 internally
-        heap = allocate(_total);
+        heap = allocate(_total, zeroFill);
         auto setupOffsets = [&](std::function<bool(MemRequest & request)> filter, size_t offset) {
             for (auto &re : _future_heap) {
                 if (re._type == REQUEST_BIND) continue;
@@ -191,11 +192,13 @@ class GNAMemory : public GNAMemRequestsQueue {
     }
 
 
-    std::shared_ptr<uint8_t> allocate(size_t bytes) {
+    std::shared_ptr<uint8_t> allocate(size_t bytes, bool zeroFill = true) {
         std::shared_ptr<uint8_t> sp(_allocator.allocate(bytes), [=](uint8_t *p) {
             _allocator.deallocate(p, bytes);
         });
-        std::fill(sp.get(), sp.get() + bytes, 0);
+        if (zeroFill) {
+            std::fill(sp.get(), sp.get() + bytes, 0);
+        }
         return sp;
     }
 
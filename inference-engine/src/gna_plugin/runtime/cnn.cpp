@@ -9,10 +9,14 @@
 #include <gna_plugin_log.hpp>
 
 #include "cnn.h"
+#include "floatmath.h"
+#include "gna_float_runtime_parallel.hpp"
 #include "backend/dnn_types.h"
 #include "backend/gna_limitations.hpp"
 #include "gna_lib_ver_selector.hpp"
 
+using GNAPluginNS::runtime::parallel_ranges;
+
 
 void CNNFilter32(intel_dnn_component_t *component) {
     float *ptr_filters = reinterpret_cast<float *>(component->op.conv1D.ptr_filters);
@@ -33,17 +37,16 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < num_filter_outputs; j++) {
-        float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
-            float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
+    const uint32_t num_filters = component->op.conv1D.num_filters;
+    parallel_ranges(num_filter_outputs, num_filters * num_filter_coefficients, [&](size_t start, size_t end) {
+        for (size_t j = start; j < end; j++) {
+            const float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
+            for (uint32_t i = 0; i < num_filters; i++) {
+                const float *ptr_coef = ptr_filters + i * num_filter_coefficients;
+                ptr_outputs[j * num_filters + i] = ptr_biases[i] + sdot_unrolled(num_filter_coefficients, ptr_in, ptr_coef);
             }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
         }
-    }
+    });
 }
 
 void CNNMaxPoolLegacy(intel_dnn_component_t *component, intel_dnn_number_type_t number_type, const bool sumPoolingOverRide) {
@@ -97,33 +100,31 @@ void CNNMaxPoolLegacy(intel_dnn_component_t *component, intel_dnn_number_type_t
             }
         }
     } else {
-        float *ptr_inputs = reinterpret_cast<float *>(component->ptr_inputs);
+        const float *ptr_inputs = reinterpret_cast<float *>(component->ptr_inputs);
         float *ptr_outputs = reinterpret_cast<float *>(component->ptr_outputs);
+        const uint32_t num_rows_out = (num_rows_in + num_pool_step - 1) / num_pool_step;
 
-        for (uint32_t i = 0; i < in_c; i++) {
-            int32_t m = 0;
-            if (sumPoolingOverRide) {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float sum = 0.0;
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
-                    for (uint32_t k = j; k < num_end; k++) {
-                        sum += ptr_inputs[k * in_c + i];
-                    }
-                    ptr_outputs[m * in_c + i] = sum;
-                    m++;
-                }
-            } else {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float max = -1e20f;
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
-                    for (uint32_t k = j; k < num_end; k++) {
-                        if (ptr_inputs[k * in_c + i] > max) max = ptr_inputs[k * in_c + i];
+        // channels are innermost in memory, so every pooled row is computed for all the channels at once
+        parallel_ranges(num_rows_out, in_c * num_pool_size, [&](size_t start, size_t end) {
+            for (size_t m = start; m < end; m++) {
+                const uint32_t j = m * num_pool_step;
+                const uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
+                float *ptr_out = ptr_outputs + m * in_c;
+                std::fill(ptr_out, ptr_out + in_c, sumPoolingOverRide ? 0.0f : -1e20f);
+                for (uint32_t k = j; k < num_end; k++) {
+                    const float *ptr_in = ptr_inputs + k * in_c;
+                    if (sumPoolingOverRide) {
+                        for (uint32_t i = 0; i < in_c; i++) {
+                            ptr_out[i] += ptr_in[i];
+                        }
+                    } else {
+                        for (uint32_t i = 0; i < in_c; i++) {
+                            ptr_out[i] = (ptr_in[i] > ptr_out[i]) ? ptr_in[i] : ptr_out[i];
+                        }
                     }
-                    ptr_outputs[m * in_c + i] = max;
-                    m++;
                 }
             }
-        }
+        });
     }
 }
 
@@ -136,21 +137,24 @@ T getQubeIndex(T a1, T a2, T a3, T A2, T A3) {
 }
 } // namespace
 
-float MaxPool2D32SingleHWC(const unsigned poolWinH, const unsigned poolWinW,
+// computes all the channels of the single output position, channels are contiguous in both input and output
+void MaxPool2D32SingleHWC(const unsigned poolWinH, const unsigned poolWinW,
     const float* input, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
+    const unsigned oh, const unsigned ow, const unsigned OC,
     const uint32_t poolStrideH,
-    const uint32_t poolStrideW) {
-    float output = std::numeric_limits<float>::lowest();
+    const uint32_t poolStrideW,
+    float* output) {
+    std::fill(output, output + OC, std::numeric_limits<float>::lowest());
     const auto winStartH = oh * poolStrideH;
     const auto winStartW = ow * poolStrideW;
     for (unsigned winIdxH = 0; winIdxH < poolWinH && winStartH + winIdxH < IH; winIdxH++) {
         for (unsigned winIdxW = 0; winIdxW < poolWinW && winStartW + winIdxW < IW; winIdxW++) {
-            const auto inputIndex = getQubeIndex(winStartH + winIdxH, winStartW + winIdxW, oc, IW, IC);
-            output = (std::max)(output, input[inputIndex]);
+            const float* inputPixel = input + getQubeIndex(winStartH + winIdxH, winStartW + winIdxW, 0u, IW, IC);
+            for (unsigned oc = 0; oc < OC; oc++) {
+                output[oc] = (std::max)(output[oc], inputPixel[oc]);
+            }
         }
     }
-    return output;
 }
 
 void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
@@ -169,65 +173,55 @@ void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
     const auto poolStrideW = component->op.maxpool.poolingStrideXY[0];
     const auto poolStrideH = component->op.maxpool.poolingStrideXY[1];
 
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = MaxPool2D32SingleHWC(poolWinH, poolWinW,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    poolStrideH,
-                    poolStrideW);
-            }
+    parallel_ranges(OH * OW, OC * poolWinH * poolWinW, [&](size_t start, size_t end) {
+        for (size_t position = start; position < end; position++) {
+            const unsigned oh = position / OW;
+            const unsigned ow = position % OW;
+            MaxPool2D32SingleHWC(poolWinH, poolWinW,
+                ptr_inputs, IH, IW, IC,
+                oh, ow, OC,
+                poolStrideH,
+                poolStrideW,
+                ptr_outputs + getQubeIndex(oh, ow, 0u, OW, OC));
         }
-    }
+    });
 }
 
 #if GNA_LIB_VER == 2
 
-bool matchesPaddedArea(unsigned filterIndex, unsigned outputIndex, unsigned inputSize, unsigned paddingSize, unsigned stride) {
-    const auto paddedIndex = stride * outputIndex + filterIndex;
-    if (paddedIndex >= inputSize + 2 * paddingSize) {
-        THROW_GNA_EXCEPTION << "In: isZeroPaddingCase, paddedIndex >= inputSize + 2 * paddingSize";
-    }
-    if (paddedIndex < paddingSize || paddedIndex >= inputSize + paddingSize) {
-        return true;
-    }
-    return false;
+// range [begin, end) of the filter indexes which hit the input rather than its zero padding
+void getValidFilterRange(unsigned filterSize, unsigned outputIndex, unsigned inputSize, unsigned paddingSize, unsigned stride,
+    unsigned& begin, unsigned& end) {
+    const auto paddedStart = stride * outputIndex;
+    begin = paddedStart < paddingSize ? paddingSize - paddedStart : 0;
+    end = inputSize + paddingSize > paddedStart ? (std::min)(filterSize, inputSize + paddingSize - paddedStart) : 0;
+    end = (std::max)(begin, end);
 }
 
-float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsigned KH, const unsigned KW, const unsigned KC,
+// computes all the filters of the single output position, the padded area is skipped by clipping the filter window
+// and the filter row fits the contiguous input row of KW * KC elements, so it is a single dot product
+void CNN2DFilter32SingleHWC(const float* biases, const float* filters, const unsigned kernelStride,
+    const unsigned KH, const unsigned KW, const unsigned KC,
     const float* image, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
+    const unsigned oh, const unsigned ow, const unsigned OC,
     const std::array<uint32_t, 2>& convStride,
-    const std::array<uint32_t, 2>& zeroPadding) {
-
-    const auto cSH = convStride[0];
-    const auto cSW = convStride[1];
-
-    const auto zPH = zeroPadding[0];
-    const auto zPW = zeroPadding[1];
-    float output = 0;
-    for (unsigned kh = 0; kh < KH; kh++) {
-        for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
-            }
+    const std::array<uint32_t, 2>& zeroPadding,
+    float* output) {
+    unsigned khBegin, khEnd, kwBegin, kwEnd;
+    getValidFilterRange(KH, oh, IH, zeroPadding[0], convStride[0], khBegin, khEnd);
+    getValidFilterRange(KW, ow, IW, zeroPadding[1], convStride[1], kwBegin, kwEnd);
+    const auto rowSize = (kwEnd - kwBegin) * KC;
+
+    for (unsigned oc = 0; oc < OC; oc++) {
+        const float* filter = filters + oc * kernelStride;
+        float sum = 0;
+        for (unsigned kh = khBegin; kh < khEnd; kh++) {
+            const auto ih = (convStride[0] * oh + kh) - zeroPadding[0];
+            const auto iw = (convStride[1] * ow + kwBegin) - zeroPadding[1];
+            sum += sdot_unrolled(rowSize, image + getQubeIndex(ih, iw, 0u, IW, IC), filter + getQubeIndex(kh, kwBegin, 0u, KW, KC));
         }
+        output[oc] = sum + biases[oc];
     }
-    output += bias;
-    return output;
 }
 
 void CNN2DFilter32(intel_dnn_component_t* component) {
@@ -252,27 +246,36 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     const auto kw = component->tensors[2].dimensions[2]; // NHWC
     const auto kc = component->tensors[2].dimensions[3]; // NHWC
 
+    const auto& convStride = component->op.conv2D.convStride;
+    const auto& zeroPadding = component->op.conv2D.zeroPadding;
+
     if (kn != OC) {
         THROW_GNA_EXCEPTION << "Number of filters should be equal to output depth!" << layer_name;
     }
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    component->op.conv2D.convStride,
-                    component->op.conv2D.zeroPadding);
-            }
-        }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+    if (OH > 0 && convStride[0] * (OH - 1) + kh > IH + 2 * zeroPadding[0]) {
+        THROW_GNA_EXCEPTION << "Filter exceeds padded input height!" << layer_name;
+    }
+    if (OW > 0 && convStride[1] * (OW - 1) + kw > IW + 2 * zeroPadding[1]) {
+        THROW_GNA_EXCEPTION << "Filter exceeds padded input width!" << layer_name;
     }
+    // kernel padded to 16B = 4 * sizeof(float)
+    const auto kernelStride = ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+
+    parallel_ranges(OH * OW, OC * kh * kw * kc, [&](size_t start, size_t end) {
+        for (size_t position = start; position < end; position++) {
+            const unsigned oh = position / OW;
+            const unsigned ow = position % OW;
+            CNN2DFilter32SingleHWC(ptr_biases, ptr_filters, kernelStride, kh, kw, kc,
+                ptr_inputs, IH, IW, IC,
+                oh, ow, OC,
+                convStride,
+                zeroPadding,
+                ptr_outputs + getQubeIndex(oh, ow, 0u, OW, OC));
+        }
+    });
 }
 
 #endif
@@ -1,13 +1,34 @@
 // Copyright (C) 2018-2021 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the CPU (software) runtime
 //
 
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 
 #include "floatmath.h"
+#include "gna_float_runtime_parallel.hpp"
+
+using GNAPluginNS::runtime::parallel_ranges;
+
+namespace {
+// Every output of C = A * B is the dot product of a row of A and a column of B, the columns of B are packed
+// into contiguous rows once so that all the dot products run over contiguous memory
+const float *pack_columns(const float *B, const MKL_INT ldb, const MKL_INT K, const MKL_INT N, std::vector<float> &packed) {
+    if (N == 1 && ldb == 1) {
+        return B;
+    }
+    packed.resize(static_cast<size_t>(K) * N);
+    for (MKL_INT k = 0; k < K; k++) {
+        for (MKL_INT j = 0; j < N; j++) {
+            packed[static_cast<size_t>(j) * K + k] = B[k * ldb + j];
+        }
+    }
+    return packed.data();
+}
+}  // namespace
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -27,15 +48,16 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        std::vector<float> packed;
+        auto Bt = pack_columns(B, ldb, K, N, packed);
+        parallel_ranges(M, static_cast<size_t>(N) * K, [&](size_t start, size_t end) {
+            for (size_t row = start; row < end; row++) {
+                for (MKL_INT col = 0; col < N; col++) {
+                    float sum = (beta == 1.0) ? C[row * ldc + col] : 0;
+                    C[row * ldc + col] = sum + sdot_unrolled(K, A + row * lda, Bt + static_cast<size_t>(col) * K);
                 }
-                C[i * ldc + j] = sum;
             }
-        }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -105,16 +127,17 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        std::vector<float> packed;
+        auto Bt = pack_columns(B, ldb, K, N, packed);
+        parallel_ranges(L, static_cast<size_t>(N) * K, [&](size_t start, size_t end) {
+            for (size_t idx = start; idx < end; idx++) {
+                const size_t row = OutputList[idx];
+                for (MKL_INT col = 0; col < N; col++) {
+                    float sum = (beta == 1.0) ? C[idx * ldc + col] : 0;
+                    C[idx * ldc + col] = sum + sdot_unrolled(K, A + row * lda, Bt + static_cast<size_t>(col) * K);
                 }
-                C[l * ldc + j] = sum;
             }
-        }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -153,20 +176,34 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
-    uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
-
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
+    const uint32_t num_columns = K1 + K2;
+
+    parallel_ranges(N, num_columns, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            const float *X_row = X + i * num_columns;
+            C[i] = B[i] + sdot_unrolled(K1, A1, X_row) + sdot_unrolled(K2, A2, X_row + K1);
         }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
+    });
+}
+
+float sdot_unrolled(const uint32_t N, const float *X, const float *Y) {
+    // independent partial sums break the dependency between iterations so the loop is vectorized
+    constexpr size_t num_lanes = 16;
+    float partial[num_lanes] = {};
+    const size_t num_blocks = N / num_lanes;
+    for (size_t b = 0; b < num_blocks; b++, X += num_lanes, Y += num_lanes) {
+        for (size_t l = 0; l < num_lanes; l++) {
+            partial[l] += X[l] * Y[l];
         }
-        C[i] = sum;
     }
+    float sum = 0;
+    for (size_t l = 0; l < num_lanes; l++) {
+        sum += partial[l];
+    }
+    for (size_t i = num_blocks * num_lanes; i < N; i++, X++, Y++) {
+        sum += *X * *Y;
+    }
+    return sum;
 }
 
 #ifdef __cplusplus
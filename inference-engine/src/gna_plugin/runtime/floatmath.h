@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstdlib>
 #include <cstdio>
 
@@ -58,6 +59,7 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C);
+float sdot_unrolled(const uint32_t N, const float *X, const float *Y);
 
 #ifdef __cplusplus
 }
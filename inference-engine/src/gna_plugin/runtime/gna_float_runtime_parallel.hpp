@@ -0,0 +1,47 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include <ie_parallel.hpp>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief minimal number of multiply-adds (or elementwise operations) worth to be run on a separate thread,
+ * smaller primitives are computed on the calling thread to not pay the threading overhead
+ */
+constexpr size_t kMinWorkPerThread = 16 * 1024;
+
+/**
+ * @brief splits [0, num_items) into contiguous ranges computed by func(start, end) in parallel,
+ * the number of threads is limited by the total work so small primitives stay single threaded
+ */
+template <typename F>
+void parallel_ranges(size_t num_items, size_t work_per_item, const F& func) {
+    if (num_items == 0) {
+        return;
+    }
+    const size_t max_threads = static_cast<size_t>(parallel_get_max_threads());
+    const size_t work = num_items * (std::max)(work_per_item, static_cast<size_t>(1));
+    const size_t num_threads = (std::min)({max_threads, num_items, work / kMinWorkPerThread + 1});
+    if (num_threads <= 1) {
+        func(static_cast<size_t>(0), num_items);
+        return;
+    }
+    InferenceEngine::parallel_nt(static_cast<int>(num_threads), [&](int ithr, int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(num_items, static_cast<size_t>(nthr), static_cast<size_t>(ithr), start, end);
+        if (start < end) {
+            func(start, end);
+        }
+    });
+}
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -25,6 +25,7 @@
 #endif
 
 #include "pwl.h"
+#include "gna_float_runtime_parallel.hpp"
 #include "gna_plugin_log.hpp"
 #include "gna_slope_scale.h"
 #include "round_float_define.hpp"
@@ -952,11 +953,12 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
-void PwlApply32(intel_dnn_component_t *component,
-                uint32_t num_row_start,
-                uint32_t num_row_end,
-                uint32_t num_col_start,
-                uint32_t num_col_end) {
+namespace {
+void PwlApply32Range(intel_dnn_component_t *component,
+                     uint32_t num_row_start,
+                     uint32_t num_row_end,
+                     uint32_t num_col_start,
+                     uint32_t num_col_end) {
     intel_piecewiselinear_t *transform = reinterpret_cast<intel_piecewiselinear_t *>(&component->op.pwl);
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
@@ -1111,3 +1113,28 @@ void PwlApply32(intel_dnn_component_t *component,
             THROW_GNA_EXCEPTION << component->original_layer_name << ", Unknown piecewise linear function type: " << transform->func_id.type;
     }
 }
+}  // namespace
+
+void PwlApply32(intel_dnn_component_t *component,
+                uint32_t num_row_start,
+                uint32_t num_row_end,
+                uint32_t num_col_start,
+                uint32_t num_col_end) {
+    const auto type = component->op.pwl.func_id.type;
+    // checked before splitting the work, so the exception is not thrown from the worker threads
+    if (type == kActNone || type == kActLeakyRelu || type == kActCustom || type >= kActNumType) {
+        THROW_GNA_EXCEPTION << component->original_layer_name << ", Unknown piecewise linear function type: " << type;
+    }
+    const uint32_t num_rows = num_row_end - num_row_start + 1;
+    const uint32_t num_cols = num_col_end - num_col_start + 1;
+    // elements are independent, the work is split by rows, or by columns when there is the single row
+    if (num_rows > 1) {
+        GNAPluginNS::runtime::parallel_ranges(num_rows, num_cols, [&](size_t start, size_t end) {
+            PwlApply32Range(component, num_row_start + start, num_row_start + end - 1, num_col_start, num_col_end);
+        });
+    } else {
+        GNAPluginNS::runtime::parallel_ranges(num_cols, 1, [&](size_t start, size_t end) {
+            PwlApply32Range(component, num_row_start, num_row_end, num_col_start + start, num_col_start + end - 1);
+        });
+    }
+}
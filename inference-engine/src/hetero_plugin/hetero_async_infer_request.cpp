@@ -2,8 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <utility>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include "hetero_async_infer_request.hpp"
 
 using namespace HeteroPlugin;
@@ -14,33 +17,83 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
                                                  const ITaskExecutor::Ptr&          callbackExecutor) :
     AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
     _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
-    _pipeline.clear();
-    for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
-        struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(SoIInferRequestInternal & inferRequest) : _inferRequest(inferRequest) {
-                _inferRequest->SetCallback(
-                [this] (std::exception_ptr exceptionPtr) mutable {
-                    _exceptionPtr = exceptionPtr;
-                    auto capturedTask = std::move(_task);
-                    capturedTask();
+    // Subgraph requests are started as soon as all the subgraphs producing their inputs are inferred, so independent
+    // subgraphs placed on different devices are inferred concurrently. The executor completes the only pipeline stage
+    // once all the subgraph requests are completed
+    struct SubgraphsExecutor : ITaskExecutor {
+        explicit SubgraphsExecutor(HeteroInferRequest::SubRequestsList& inferRequests) :
+            _inferRequests(inferRequests),
+            _dependents(inferRequests.size()),
+            _numPendingDependencies(new std::atomic<std::size_t>[inferRequests.size()]) {
+            for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+                for (auto&& dependency : _inferRequests[requestId]._dependencies) {
+                    _dependents[dependency].push_back(requestId);
+                }
+                _inferRequests[requestId]._request->SetCallback(
+                [this, requestId] (std::exception_ptr exceptionPtr) mutable {
+                    OnRequestCompleted(requestId, exceptionPtr);
                 });
             }
-            void run(Task task) override {
-                _task = std::move(task);
-                _inferRequest->StartAsync();
-            };
-            SoIInferRequestInternal &  _inferRequest;
-            std::exception_ptr         _exceptionPtr;
-            Task                       _task;
+        }
+        void run(Task task) override {
+            _task = std::move(task);
+            _exceptionPtr = nullptr;
+            _numPendingRequests = _inferRequests.size();
+            for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+                _numPendingDependencies[requestId] = _inferRequests[requestId]._dependencies.size();
+            }
+            for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+                if (_inferRequests[requestId]._dependencies.empty()) {
+                    StartRequest(requestId);
+                }
+            }
         };
-
-        auto requestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request);
-        _pipeline.emplace_back(requestExecutor, [requestExecutor] {
-            if (nullptr != requestExecutor->_exceptionPtr) {
-                std::rethrow_exception(requestExecutor->_exceptionPtr);
+        void StartRequest(std::size_t requestId) {
+            try {
+                _inferRequests[requestId]._request->StartAsync();
+            } catch (...) {
+                OnRequestCompleted(requestId, std::current_exception());
             }
-        });
-    }
+        }
+        void OnRequestCompleted(std::size_t requestId, std::exception_ptr exceptionPtr) {
+            bool failed = false;
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                if (nullptr != exceptionPtr && nullptr == _exceptionPtr) {
+                    _exceptionPtr = exceptionPtr;
+                }
+                failed = nullptr != _exceptionPtr;
+            }
+            for (auto&& dependent : _dependents[requestId]) {
+                if (0 == --_numPendingDependencies[dependent]) {
+                    // dependents of the failed request are not started, but are completed to finish the stage
+                    if (failed) {
+                        OnRequestCompleted(dependent, nullptr);
+                    } else {
+                        StartRequest(dependent);
+                    }
+                }
+            }
+            if (0 == --_numPendingRequests) {
+                auto capturedTask = std::move(_task);
+                capturedTask();
+            }
+        }
+        HeteroInferRequest::SubRequestsList&            _inferRequests;
+        std::vector<std::vector<std::size_t>>           _dependents;
+        std::unique_ptr<std::atomic<std::size_t>[]>     _numPendingDependencies;
+        std::atomic<std::size_t>                        _numPendingRequests = {0};
+        std::mutex                                      _mutex;
+        std::exception_ptr                              _exceptionPtr;
+        Task                                            _task;
+    };
+
+    auto subgraphsExecutor = std::make_shared<SubgraphsExecutor>(_heteroInferRequest->_inferRequests);
+    _pipeline = {{subgraphsExecutor, [subgraphsExecutor] {
+        if (nullptr != subgraphsExecutor->_exceptionPtr) {
+            std::rethrow_exception(subgraphsExecutor->_exceptionPtr);
+        }
+    }}};
 }
 
 void HeteroAsyncInferRequest::StartAsync_ThreadUnsafe() {
@@ -48,6 +101,11 @@ void HeteroAsyncInferRequest::StartAsync_ThreadUnsafe() {
     RunFirstStage(_pipeline.begin(), _pipeline.end());
 }
 
+void HeteroAsyncInferRequest::Infer_ThreadUnsafe() {
+    _heteroInferRequest->updateInOutIfNeeded();
+    RunFirstStage(_pipeline.begin(), _pipeline.end(), _syncCallbackExecutor);
+}
+
 StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
     auto waitStatus = StatusCode::OK;
     try {
@@ -427,6 +427,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
             network._device, metaDevices[network._device]);
     }
+    InitSubgraphDependencies();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&                               heteroModel,
@@ -552,6 +553,30 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
     this->_config = importedConfigs;
     this->_networks = std::move(descs);
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
+    InitSubgraphDependencies();
+}
+
+void HeteroExecutableNetwork::InitSubgraphDependencies() {
+    // subgraphs are ordered, so the producer of the intermediate blob is found before its consumers
+    std::unordered_map<std::string, std::size_t> producers;
+    _subgraphDependencies.assign(_networks.size(), {});
+    for (std::size_t id = 0; id < _networks.size(); ++id) {
+        auto& dependencies = _subgraphDependencies[id];
+        for (auto&& inputInfo : _networks[id]._network->GetInputsInfo()) {
+            auto itName = _blobNameMap.find(inputInfo.first);
+            if (itName == _blobNameMap.end()) {
+                continue;
+            }
+            auto itProducer = producers.find(itName->second);
+            if (itProducer != producers.end() &&
+                std::find(dependencies.begin(), dependencies.end(), itProducer->second) == dependencies.end()) {
+                dependencies.push_back(itProducer->second);
+            }
+        }
+        for (auto&& outputInfo : _networks[id]._network->GetOutputsInfo()) {
+            producers.emplace(outputInfo.first, id);
+        }
+    }
 }
 
 void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
@@ -651,6 +676,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     for (auto&& subnetwork : _networks) {
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
+        desc._dependencies = _subgraphDependencies[index];
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
         inferRequests.push_back(desc);
     }
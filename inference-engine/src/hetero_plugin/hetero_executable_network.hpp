@@ -61,6 +61,7 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork&    network);
     void InitNgraph(const InferenceEngine::CNNNetwork&     network);
+    void InitSubgraphDependencies();
 
     struct NetworkDesc {
         std::string                                   _device;
@@ -73,6 +74,8 @@ private:
     std::string                                  _name;
     std::map<std::string, std::string>           _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    // ids of the subgraphs producing inputs of the subgraph, the subgraphs without dependency are inferred concurrently
+    std::vector<std::vector<std::size_t>>        _subgraphDependencies;
 };
 
 }  // namespace HeteroPlugin
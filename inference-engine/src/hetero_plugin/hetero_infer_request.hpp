@@ -24,6 +24,7 @@ public:
         InferenceEngine::SoExecutableNetworkInternal  _network;
         InferenceEngine::SoIInferRequestInternal      _request;
         openvino::itt::handle_t                       _profilingTask;
+        std::vector<std::size_t>                      _dependencies;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
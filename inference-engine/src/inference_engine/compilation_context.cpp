@@ -23,6 +23,7 @@
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 #include "file_utils.h"
+#include "ie_data_hash.hpp"
 
 #ifdef WIN32
 #define stat _stat
@@ -46,18 +47,8 @@ class OstreamHashWrapper final: public std::streambuf {
 public:
     std::size_t getResult() const { return m_res; }
     std::streamsize xsputn(const char* s, std::streamsize n) override {
-        const std::int64_t* intS = (const std::int64_t *)s;
-        std::streamsize n64 = n / sizeof(std::int64_t);
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
-        }
-
-        std::streamsize rest = n % sizeof(std::int64_t);
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
-        }
+        // the hash of the previous data is the seed, so the result depends on the order of writes
+        m_res = static_cast<std::size_t>(computeDataHash(s, static_cast<size_t>(n), m_res));
         return n;
     }
 };
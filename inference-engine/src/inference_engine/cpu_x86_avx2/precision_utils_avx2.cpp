@@ -0,0 +1,72 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+
+#include <immintrin.h>  // AVX2, F16C
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+size_t f16tof32_avx2(float* dst, const short* src, size_t nelem) {
+    const size_t nvec = nelem - nelem % 8;
+
+    // vcvtph2ps handles NaN, infinity and denormals exactly as the scalar f16tof32
+    for (size_t i = 0; i < nvec; i += 8) {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+
+    return nvec;
+}
+
+size_t f32tof16_avx2(short* dst, const float* src, size_t nelem) {
+    const size_t nvec = nelem - nelem % 8;
+
+    // vcvtps2ph can't be used here: it rounds to nearest even, keeps denormals and overflows to infinity,
+    // so the branches of the scalar f32tof16 are evaluated for all lanes and blended instead
+    const __m256i abs_mask = _mm256_set1_epi32(0x7FFFFFFF);
+    const __m256i exp_mask_f32 = _mm256_set1_epi32(0x7F800000);
+    const __m256i sign_mask_f16 = _mm256_set1_epi32(0x8000);
+    const __m256i low_word_mask = _mm256_set1_epi32(0xFFFF);
+    const __m256i exp_bias_diff = _mm256_set1_epi32((127 - 15) << 23);
+    const __m256i nan_bit_f16 = _mm256_set1_epi32(0x0200);
+    const __m256i inf_f16 = _mm256_set1_epi32(0x7C00);
+    const __m256i min_f16 = _mm256_set1_epi32(1 << 10);
+    const __m256i max_f16 = _mm256_set1_epi32(((15 + 15) << 10) | 0x3FF);
+
+    const __m256 half_ulp_scale = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 11) << 23));
+    const __m256 min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 half_min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 15) << 23));
+    const __m256 max16 = _mm256_castsi256_ps(_mm256_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    for (size_t i = 0; i < nvec; i += 8) {
+        const __m256i u = _mm256_castps_si256(_mm256_loadu_ps(src + i));
+        const __m256i s = _mm256_and_si256(_mm256_srli_epi32(u, 16), sign_mask_f16);
+        const __m256i a = _mm256_and_si256(u, abs_mask);
+
+        // halfULP is a power of two, so the sum is rounded once whether or not it gets fused
+        const __m256 half_ulp = _mm256_mul_ps(_mm256_castsi256_ps(_mm256_and_si256(a, exp_mask_f32)), half_ulp_scale);
+        const __m256 v = _mm256_add_ps(_mm256_castsi256_ps(a), half_ulp);
+
+        __m256i r = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(v), exp_bias_diff), 23 - 10);
+        r = _mm256_blendv_epi8(r, max_f16, _mm256_castps_si256(_mm256_cmp_ps(v, max16, _CMP_GE_OQ)));
+        r = _mm256_blendv_epi8(r, min_f16, _mm256_castps_si256(_mm256_cmp_ps(v, min16, _CMP_LT_OQ)));
+        r = _mm256_blendv_epi8(r, _mm256_setzero_si256(), _mm256_castps_si256(_mm256_cmp_ps(v, half_min16, _CMP_LT_OQ)));
+
+        // NaN keeps the exponent bits of f32 which overflow the 16 bit result exactly as in the scalar code
+        const __m256i nan = _mm256_or_si256(_mm256_srli_epi32(a, 23 - 10), nan_bit_f16);
+        r = _mm256_blendv_epi8(r, inf_f16, _mm256_cmpeq_epi32(a, exp_mask_f32));
+        r = _mm256_blendv_epi8(r, nan, _mm256_cmpgt_epi32(a, exp_mask_f32));
+
+        r = _mm256_and_si256(_mm256_or_si256(r, s), low_word_mask);
+        r = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0xD8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(r));
+    }
+
+    return nvec;
+}
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
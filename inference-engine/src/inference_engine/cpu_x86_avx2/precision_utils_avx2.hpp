@@ -0,0 +1,26 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stddef.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+//------------------------------------------------------------------------
+//
+// FP16 <-> FP32 array conversions manually vectored for AVX2 + F16C
+// Both functions convert the largest prefix which is multiple of 8 elements
+// and return its length, the rest is left for the scalar code
+//
+//------------------------------------------------------------------------
+
+size_t f16tof32_avx2(float* dst, const short* src, size_t nelem);
+
+// Produces bit-exact results of PrecisionUtils::f32tof16 (rounding, saturation and flushing of denormals)
+size_t f32tof16_avx2(short* dst, const float* src, size_t nelem);
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -7,14 +7,17 @@
 #include <string>
 #include <vector>
 #include <mutex>
+#include <atomic>
 #include <sys/stat.h>
 
 #include <ie_core.hpp>
 #include <ie_icore.hpp>
+#include <ie_parallel.hpp>
 #include <ngraph/opsets/opset.hpp>
 #include <ngraph/ngraph.hpp>
 #include <ngraph/graph_util.hpp>
 #include <ngraph/pass/constant_folding.hpp>
+#include <ngraph/runtime/parallel.hpp>
 
 #include "compilation_context.hpp"
 #include "cpp/ie_plugin.hpp"
@@ -35,6 +38,19 @@ namespace InferenceEngine {
 
 namespace {
 
+/**
+ * @brief Runs parallel loops of nGraph reference kernels (constant folding, reference CPU nodes) with the
+ * Inference Engine threading
+ */
+void ngraphParallelFor(size_t workAmount, const ngraph::runtime::ParallelForBody& body) {
+    parallel_nt(parallel_get_max_threads(), [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+        if (start < end)
+            body(start, end);
+    });
+}
+
 template <typename T>
 struct Parsed {
     std::string _deviceName;
@@ -51,6 +67,9 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG] = deviceName.substr(6);
     } else if (deviceName_.find("AUTO") == 0) {
         deviceName_ = "AUTO";
         if (deviceName.size() > std::string("AUTO").size()) {
@@ -196,6 +215,23 @@ class Core::Impl : public ICore {
 
                 config.erase(it);
             }
+
+            it = config.find(CONFIG_KEY(MMAP_WEIGHTS));
+            if (it != config.end()) {
+                if (it->second == CONFIG_VALUE(YES)) {
+                    _mmapWeights = true;
+                } else if (it->second == CONFIG_VALUE(NO)) {
+                    _mmapWeights = false;
+                } else {
+                    IE_THROW() << "Wrong value for property key " << CONFIG_KEY(MMAP_WEIGHTS) << ". Expected only YES/NO";
+                }
+
+                config.erase(it);
+            }
+        }
+
+        bool isMmapWeights() const {
+            return _mmapWeights.load();
         }
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -207,6 +243,7 @@ class Core::Impl : public ICore {
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        std::atomic<bool> _mmapWeights = {false};
     };
 
     // Core settings (cache config, etc)
@@ -396,6 +433,9 @@ public:
         opsetNames.insert("opset5");
         opsetNames.insert("opset6");
         opsetNames.insert("opset7");
+#if IE_THREAD != IE_THREAD_SEQ
+        ngraph::runtime::set_parallel_for_impl(ngraphParallelFor);
+#endif
     }
 
     ~Impl() override = default;
@@ -477,7 +517,7 @@ public:
 
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "Core::Impl::ReadNetwork from file");
-        return details::ReadNetwork(modelPath, binPath, extensions);
+        return details::ReadNetwork(modelPath, binPath, extensions, coreConfig.isMmapWeights());
     }
 
     CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const override {
@@ -485,6 +525,18 @@ public:
         return details::ReadNetwork(model, weights, extensions);
     }
 
+    CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights,
+                           const std::vector<IExtensionPtr>& exts) const override {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "Core::Impl::ReadNetwork from memory with extensions");
+        // extensions added to the Core are propagated to plugins, so the same extension can be passed twice
+        auto allExtensions = extensions;
+        for (const auto& ext : exts) {
+            if (std::find(allExtensions.begin(), allExtensions.end(), ext) == allExtensions.end())
+                allExtensions.push_back(ext);
+        }
+        return details::ReadNetwork(model, weights, allExtensions);
+    }
+
     // TODO: In future this method can be added to ICore interface
     SoExecutableNetworkInternal LoadNetwork(const CNNNetwork& network, const RemoteContext::Ptr& context,
                                             const std::map<std::string, std::string>& config) {
@@ -616,6 +668,15 @@ public:
             }
         }
 
+        // BATCH case
+        {
+            if (deviceName.find("BATCH:") == 0) {
+                IE_THROW()
+                    << "You can get specific metrics with the GetMetric only for the BATCH itself (without devices). "
+                       "To get individual devices's metrics call GetMetric for each device separately";
+            }
+        }
+
         auto parsed = parseDeviceNameIntoConfig(deviceName);
 
         // we need to return a copy of Parameter object which is created on Core side,
@@ -899,6 +960,12 @@ std::map<std::string, Version> Core::GetVersions(const std::string& deviceName)
                 deviceNames = DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
             }
             deviceNames.push_back("MULTI");
+        } else if (deviceName.find("BATCH") == 0) {
+            auto pos = deviceName.find_first_of(":");
+            if (pos != std::string::npos) {
+                deviceNames = DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
+            }
+            deviceNames.push_back("BATCH");
         } else if (deviceName.find("AUTO") == 0) {
             auto pos = deviceName.find_first_of(":");
             if (pos != std::string::npos) {
@@ -967,6 +1034,9 @@ RemoteContext::Ptr Core::CreateContext(const std::string& deviceName, const Para
     if (deviceName.find("AUTO") == 0) {
         IE_THROW() << "AUTO device does not support remote context";
     }
+    if (deviceName.find("BATCH") == 0) {
+        IE_THROW() << "BATCH device does not support remote context";
+    }
 
     auto parsed = parseDeviceNameIntoConfig(deviceName, params);
     return _impl->GetCPPPluginByName(parsed._deviceName).CreateContext(parsed._config);
@@ -982,6 +1052,9 @@ RemoteContext::Ptr Core::GetDefaultContext(const std::string& deviceName) {
     if (deviceName.find("AUTO") == 0) {
         IE_THROW() << "AUTO device does not support remote context";
     }
+    if (deviceName.find("BATCH") == 0) {
+        IE_THROW() << "BATCH device does not support remote context";
+    }
 
     auto parsed = parseDeviceNameIntoConfig(deviceName, ParamMap());
     return _impl->GetCPPPluginByName(parsed._deviceName).GetDefaultContext(parsed._config);
@@ -1000,6 +1073,10 @@ void Core::AddExtension(IExtensionPtr extension, const std::string& deviceName_)
         IE_THROW()
             << "AUTO device does not support extensions. Please, set extensions directly to fallback devices";
     }
+    if (deviceName_.find("BATCH") == 0) {
+        IE_THROW()
+            << "BATCH device does not support extensions. Please, set extensions directly to the underlying device";
+    }
 
     _impl->AddExtension(extension);
 }
@@ -1087,6 +1164,12 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
                                "You can configure the devices with SetConfig before creating the AUTO on top.";
     }
 
+    // BATCH case
+    if (deviceName.find("BATCH:") == 0) {
+        IE_THROW() << "SetConfig is supported only for BATCH itself (without devices). "
+                               "You can configure the devices with SetConfig before creating the BATCH on top.";
+    }
+
     // GPU.0, FPGA.1 cases
     if (deviceName.find(".") != std::string::npos) {
         IE_THROW() << "SetConfig is supported only for device family itself (without particular device .#). "
@@ -1126,6 +1209,14 @@ Parameter Core::GetConfig(const std::string& deviceName, const std::string& name
                    "GetConfig is also possible for the individual devices before creating the AUTO on top.";
         }
     }
+    // BATCH case
+    {
+        if (deviceName.find("BATCH:") == 0) {
+            IE_THROW()
+                << "You can only GetConfig of the BATCH itself (without devices). "
+                   "GetConfig is also possible for the individual devices before creating the BATCH on top.";
+        }
+    }
 
     auto parsed = parseDeviceNameIntoConfig(deviceName);
 
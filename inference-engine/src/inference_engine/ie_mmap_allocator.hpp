@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ie_api.h"
+#include "ie_allocator.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Creates an allocator which maps a file into memory instead of allocating it.
+ *        The mapping is private (copy-on-write), so its pages are shared through the page cache
+ *        between all processes which map the same file until somebody writes to them.
+ *        The allocator handles a single mapping at a time; the mapped size must not exceed the file size.
+ * @param path Path to the file to map
+ * @return A shared pointer to the allocator
+ */
+INFERENCE_ENGINE_API_CPP(std::shared_ptr<IAllocator>) CreateMmapAllocator(const std::string& path);
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "ie_mmap_allocator.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -121,6 +122,11 @@ void registerReaders() {
     if (irReaderv10)
         readers.emplace("xml", irReaderv10);
 
+    // try to load binary IR reader if library exists
+    auto irBinaryReader = create_if_exists("IRBinary", std::string("inference_engine_ir_binary_reader") + std::string(IE_BUILD_POSTFIX));
+    if (irBinaryReader)
+        readers.emplace("irb", irBinaryReader);
+
     // try to load IR reader v7 if library exists
     auto irReaderv7 = create_if_exists("IRv7", std::string("inference_engine_ir_v7_reader") + std::string(IE_BUILD_POSTFIX));
     if (irReaderv7)
@@ -150,7 +156,8 @@ void assertIfIRv7LikeModel(std::istream & modelStream) {
 
 }  // namespace
 
-CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
+CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts,
+                                bool mmapWeights) {
     // Register readers if it is needed
     registerReaders();
 
@@ -199,22 +206,40 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
 #else
                 std::string weights_path = bPath;
 #endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    IE_THROW() << "Weights file " << bPath << " cannot be opened!";
-
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
-
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
-
-                {
-                    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "ReadNetworkWeights");
-                    weights->allocate();
-                    binStream.read(weights->buffer(), fileSize);
-                    binStream.close();
+                Blob::Ptr weights;
+                if (mmapWeights) {
+                    // The mapped file is shared with Constant operations without copying, so its pages
+                    // are loaded lazily and shared via page cache between processes which read the same model
+                    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "ReadNetworkWeightsMmap");
+                    const auto fileSize = FileUtils::fileSize(weights_path);
+                    if (fileSize > 0) {
+                        weights = make_shared_blob<uint8_t>({Precision::U8, { static_cast<size_t>(fileSize) }, C },
+                                                            details::CreateMmapAllocator(bPath));
+                        weights->allocate();
+                        // fallback to the regular reading if the file cannot be mapped
+                        if (weights->cbuffer().as<const uint8_t*>() == nullptr)
+                            weights = nullptr;
+                    }
+                }
+
+                if (!weights) {
+                    std::ifstream binStream;
+                    binStream.open(weights_path, std::ios::binary);
+                    if (!binStream.is_open())
+                        IE_THROW() << "Weights file " << bPath << " cannot be opened!";
+
+                    binStream.seekg(0, std::ios::end);
+                    size_t fileSize = binStream.tellg();
+                    binStream.seekg(0, std::ios::beg);
+
+                    weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
+
+                    {
+                        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_RT, "ReadNetworkWeights");
+                        weights->allocate();
+                        binStream.read(weights->buffer(), fileSize);
+                        binStream.close();
+                    }
                 }
 
                 // read model with weights
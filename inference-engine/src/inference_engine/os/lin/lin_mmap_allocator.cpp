@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "ie_mmap_allocator.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+class MmapAllocator : public IAllocator {
+public:
+    explicit MmapAllocator(std::string path) : _path(std::move(path)) {}
+
+    ~MmapAllocator() {
+        if (_data != nullptr) {
+            munmap(_data, _size);
+        }
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        if (_data != nullptr || size == 0) {
+            return nullptr;
+        }
+
+        int fd = open(_path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            return nullptr;
+        }
+
+        struct stat sb = {};
+        if (fstat(fd, &sb) == -1 || static_cast<size_t>(sb.st_size) < size) {
+            close(fd);
+            return nullptr;
+        }
+
+        // the file is opened for reading only, but private mapping still allows to modify
+        // the data in place: the touched pages are copied and the file stays unchanged
+        void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED) {
+            return nullptr;
+        }
+
+        _data = data;
+        _size = size;
+        return _data;
+    }
+
+    bool free(void* handle) noexcept override {
+        if (handle == nullptr || handle != _data) {
+            return false;
+        }
+        munmap(_data, _size);
+        _data = nullptr;
+        _size = 0;
+        return true;
+    }
+
+private:
+    std::string _path;
+    void* _data = nullptr;
+    size_t _size = 0;
+};
+
+std::shared_ptr<IAllocator> CreateMmapAllocator(const std::string& path) {
+    return std::make_shared<MmapAllocator>(path);
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+
+#include <windows.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "ie_mmap_allocator.hpp"
+#include "file_utils.h"
+
+namespace InferenceEngine {
+namespace details {
+
+class MmapAllocator : public IAllocator {
+public:
+    explicit MmapAllocator(std::string path) : _path(std::move(path)) {}
+
+    ~MmapAllocator() {
+        if (_data != nullptr) {
+            UnmapViewOfFile(_data);
+        }
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        if (_data != nullptr || size == 0) {
+            return nullptr;
+        }
+
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+        HANDLE file = CreateFileW(FileUtils::multiByteCharToWString(_path.c_str()).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+        HANDLE file = CreateFileA(_path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif
+        if (file == INVALID_HANDLE_VALUE) {
+            return nullptr;
+        }
+
+        LARGE_INTEGER fileSize = {};
+        if (!GetFileSizeEx(file, &fileSize) || static_cast<size_t>(fileSize.QuadPart) < size) {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        // copy-on-write view: the data may be modified in place while the file stays unchanged
+        HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            return nullptr;
+        }
+
+        void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, size);
+        // the view keeps a reference to the mapping object
+        CloseHandle(mapping);
+        if (data == nullptr) {
+            return nullptr;
+        }
+
+        _data = data;
+        return _data;
+    }
+
+    bool free(void* handle) noexcept override {
+        if (handle == nullptr || handle != _data) {
+            return false;
+        }
+        UnmapViewOfFile(_data);
+        _data = nullptr;
+        return true;
+    }
+
+private:
+    std::string _path;
+    void* _data = nullptr;
+};
+
+std::shared_ptr<IAllocator> CreateMmapAllocator(const std::string& path) {
+    return std::make_shared<MmapAllocator>(path);
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
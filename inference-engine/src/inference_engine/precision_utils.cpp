@@ -6,19 +6,46 @@
 
 #include <stdint.h>
 
+#include "ie_system_conf.h"
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+#endif
+
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
 void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
     const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
+    size_t i = 0;
+
+#ifdef HAVE_AVX2
+    // F16C is available on every CPU with AVX2
+    if (with_cpu_x86_avx2()) {
+        i = f16tof32_avx2(dst, _src, nelem);
+        if (scale != 1.f || bias != 0.f) {
+            for (size_t j = 0; j < i; j++) {
+                dst[j] = dst[j] * scale + bias;
+            }
+        }
+    }
+#endif
 
-    for (size_t i = 0; i < nelem; i++) {
+    for (; i < nelem; i++) {
         dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
     }
 }
 
 void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
+    size_t i = 0;
+
+#ifdef HAVE_AVX2
+    // scale and bias are applied in the scalar loop to keep rounding of the intermediate result unchanged
+    if (scale == 1.f && bias == 0.f && with_cpu_x86_avx2()) {
+        i = f32tof16_avx2(dst, src, nelem);
+    }
+#endif
+
+    for (; i < nelem; i++) {
         dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
     }
 }
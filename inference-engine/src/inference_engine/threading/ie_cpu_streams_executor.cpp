@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <memory>
@@ -12,6 +13,7 @@
 #include <atomic>
 #include <climits>
 #include <cassert>
+#include <cstdint>
 #include <utility>
 
 #include "threading/ie_thread_local.hpp"
@@ -25,6 +27,85 @@ using namespace openvino;
 
 namespace InferenceEngine {
 struct CPUStreamsExecutor::Impl {
+    /**
+     * Bounded multi-producer/multi-consumer lock-free queue (D. Vyukov's algorithm).
+     * Every stream thread owns one queue and steals tasks from the queues of other streams when its own one is empty.
+     */
+    struct TaskQueue {
+        struct Cell {
+            std::atomic<std::size_t>    _sequence;
+            Task                        _task;
+        };
+
+        explicit TaskQueue(const std::size_t capacity) :
+            _cells(capacity),
+            _mask(capacity - 1) {
+            assert((capacity & _mask) == 0);
+            for (std::size_t i = 0; i < capacity; ++i) {
+                _cells[i]._sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        bool TryPush(Task& task) {
+            Cell* cell = nullptr;
+            auto pos = _enqueuePos.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &_cells[pos & _mask];
+                auto seq = cell->_sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+                if (0 == diff) {
+                    if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;  // the queue is full
+                } else {
+                    pos = _enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+            cell->_task = std::move(task);
+            cell->_sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool TryPop(Task& task) {
+            Cell* cell = nullptr;
+            auto pos = _dequeuePos.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &_cells[pos & _mask];
+                auto seq = cell->_sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+                if (0 == diff) {
+                    if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;  // the queue is empty
+                } else {
+                    pos = _dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+            task = std::move(cell->_task);
+            cell->_task = nullptr;
+            cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+            return true;
+        }
+
+        std::vector<Cell>           _cells;
+        const std::size_t           _mask;
+        // producers and consumers positions are kept on separate cache lines
+        char                        _pad0[64];
+        std::atomic<std::size_t>    _enqueuePos = {0};
+        char                        _pad1[64];
+        std::atomic<std::size_t>    _dequeuePos = {0};
+        char                        _pad2[64];
+    };
+
+    static constexpr std::size_t taskQueueCapacity = 1024;
+    // Number of attempts to find a task before the stream thread goes to sleep.
+    // Waking up the sleeping thread is a futex round-trip that is more expensive than a short task itself.
+    static constexpr int spinIterations = 128;
+
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer: public custom::task_scheduler_observer {
@@ -194,21 +275,29 @@ struct CPUStreamsExecutor::Impl {
             }
         }
         #endif
+        for (auto streamId = 0; streamId < std::max(1, _config._streams); ++streamId) {
+            _taskQueues.emplace_back(new TaskQueue{taskQueueCapacity});
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
+                    bool popped = TryPop(streamId, task);
+                    for (int spin = 0; !popped && spin < spinIterations; ++spin) {
+                        std::this_thread::yield();
+                        popped = TryPop(streamId, task);
                     }
-                    if (task) {
+                    if (popped) {
+                        _pendingTasks.fetch_sub(1);
                         Execute(task, *(_streams.local()));
+                    } else {
+                        _sleepingThreads.fetch_add(1);
+                        {
+                            std::unique_lock<std::mutex> lock(_mutex);
+                            _queueCondVar.wait(lock, [&] { return _pendingTasks.load() > 0 || (stopped = _isStopped); });
+                        }
+                        _sleepingThreads.fetch_sub(1);
                     }
                 }
             });
@@ -216,11 +305,47 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
-        {
+        bool pushed = false;
+        // keep tasks order: while there are tasks in the overflow queue, new ones are appended to it too
+        if (0 == _overflowTasks.load()) {
+            const auto queuesCount = _taskQueues.size();
+            const auto first = _enqueueIndex.fetch_add(1, std::memory_order_relaxed);
+            for (std::size_t i = 0; i < queuesCount && !pushed; ++i) {
+                pushed = _taskQueues[(first + i) % queuesCount]->TryPush(task);
+            }
+        }
+        if (!pushed) {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
+            _overflowTasks.fetch_add(1);
+        }
+        _pendingTasks.fetch_add(1);
+        // the stream thread increments the counter of sleeping threads before checking for pending tasks,
+        // so either it observes the new task or it is notified here
+        if (_sleepingThreads.load() > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
+    }
+
+    bool TryPop(const int streamId, Task& task) {
+        // own queue is checked first, then tasks are stolen from other streams
+        const auto queuesCount = _taskQueues.size();
+        for (std::size_t i = 0; i < queuesCount; ++i) {
+            if (_taskQueues[(streamId + i) % queuesCount]->TryPop(task)) {
+                return true;
+            }
+        }
+        if (_overflowTasks.load() > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                _overflowTasks.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -256,9 +381,15 @@ struct CPUStreamsExecutor::Impl {
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
+    std::vector<std::unique_ptr<TaskQueue>> _taskQueues;
+    std::atomic<std::size_t>                _enqueueIndex = {0};
+    std::atomic<int>                        _pendingTasks = {0};
+    std::atomic<int>                        _sleepingThreads = {0};
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
+    // overflow queue used when all lock-free queues are full
     std::queue<Task>                        _taskQueue;
+    std::atomic<int>                        _overflowTasks = {0};
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
@@ -273,6 +404,9 @@ struct CPUStreamsExecutor::Impl {
 };
 
 
+constexpr std::size_t CPUStreamsExecutor::Impl::taskQueueCapacity;
+constexpr int CPUStreamsExecutor::Impl::spinIterations;
+
 int CPUStreamsExecutor::GetStreamId() {
     auto stream = _impl->_streams.local();
     return stream->_streamId;
@@ -3,12 +3,14 @@
 //
 
 #include "config.h"
+#include "mkldnn_primitive_cache.hpp"
 
 #include <string>
 #include <map>
 #include <algorithm>
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_common.h"
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
@@ -20,6 +22,8 @@ namespace MKLDNNPlugin {
 using namespace InferenceEngine;
 
 Config::Config() {
+    primitiveCacheCapacity = MKLDNNPrimitiveCache::defaultCapacity;
+
     // this is default mode
     streamExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::CORES;
 
@@ -94,6 +98,44 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION) {
+            if (val == PluginConfigParams::YES) parallelGraphExecution = true;
+            else if (val == PluginConfigParams::NO) parallelGraphExecution = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_SNIPPETS) {
+            if (val == PluginConfigParams::YES) snippetsTokenization = true;
+            else if (val == PluginConfigParams::NO) snippetsTokenization = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SNIPPETS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_RUNTIME_RESHAPE_CACHE_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_RESHAPE_CACHE_SIZE
+                                    << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_RESHAPE_CACHE_SIZE
+                                    << ". Expected only non-negative integer numbers";
+            runtimeReshapeCacheSize = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY
+                                    << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY
+                                    << ". Expected only non-negative integer numbers";
+            primitiveCacheCapacity = static_cast<size_t>(val_i);
+        } else if (key == PluginConfigParams::KEY_CACHE_DIR) {
+            cacheDir = val;
         } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
             if (val == PluginConfigParams::YES) {
                 if (with_cpu_x86_avx512_core()) {
@@ -151,6 +193,8 @@ void Config::updateProperties() {
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
+        _config.insert({ CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY, std::to_string(primitiveCacheCapacity) });
+        _config.insert({ PluginConfigParams::KEY_CACHE_DIR, cacheDir });
         IE_SUPPRESS_DEPRECATED_START
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
         IE_SUPPRESS_DEPRECATED_END
@@ -25,6 +25,12 @@ struct Config {
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
+    bool parallelGraphExecution = false;
+    bool snippetsTokenization = false;
+    int runtimeReshapeCacheSize = 0;
+    size_t primitiveCacheCapacity;
+    // the model cache directory set by the core, the network before transformations is kept for export only if it's set
+    std::string cacheDir = "";
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
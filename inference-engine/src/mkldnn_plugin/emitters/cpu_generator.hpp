@@ -0,0 +1,37 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <cpu/x64/jit_generator.hpp>
+
+#include "snippets/generator.hpp"
+
+namespace MKLDNNPlugin {
+
+// Target machine for snippets code generation on x64 CPUs with a fixed vector ISA
+class CPUTargetMachine : public ngraph::snippets::TargetMachine {
+public:
+    explicit CPUTargetMachine(mkldnn::impl::cpu::x64::cpu_isa_t host_isa);
+
+    bool is_supported() const override;
+    ngraph::snippets::code get_snippet() const override;
+    size_t get_lanes() const override;
+
+private:
+    std::unique_ptr<mkldnn::impl::cpu::x64::jit_generator> h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+class CPUGenerator : public ngraph::snippets::Generator {
+public:
+    explicit CPUGenerator(mkldnn::impl::cpu::x64::cpu_isa_t isa);
+    ~CPUGenerator() = default;
+
+    // checks if the target machine has an emitter for the operation
+    bool is_supported_op(const std::shared_ptr<ngraph::Node>& op) const;
+};
+
+}  // namespace MKLDNNPlugin
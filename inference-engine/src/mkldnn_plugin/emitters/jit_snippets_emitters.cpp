@@ -0,0 +1,258 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+
+#include <cstddef>
+#include "snippets/snippets_isa.hpp"
+#include "snippets/op/kernel.hpp"
+#include "snippets/op/tile.hpp"
+
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// R8, R9, ... keep pointers to the inputs and outputs, the next register keeps the work amount
+constexpr int reg64_tmp_start = 8;
+
+size_t innermost_dim(const ngraph::Shape& shape) {
+    return shape.empty() ? 1 : shape.back();
+}
+
+} // namespace
+
+/// KERNEL ///
+KernelEmitter::KernelEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n), code(ngraph::as_type_ptr<ngraph::snippets::op::Kernel>(n)->region) {}
+
+void KernelEmitter::emit_code(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                              const std::vector<size_t>& pool, const std::vector<size_t>& gpr) const {
+    const size_t num_params = in[0] + in[1];
+    if (num_params > SNIPPETS_MAX_PTRS)
+        IE_THROW() << "Snippet kernel supports up to " << SNIPPETS_MAX_PTRS << " inputs and outputs, got " << num_params;
+
+    h->preamble();
+
+    for (size_t i = 0; i < num_params; i++)
+        h->mov(Reg64(reg64_tmp_start + i), h->ptr[abi_param1 + GET_OFF(ptrs) + i * sizeof(void*)]);
+    h->mov(Reg64(reg64_tmp_start + num_params), h->ptr[abi_param1 + GET_OFF(work_amount)]);
+
+    // vector registers are assigned from the first 16 ones, so the rest can be used by emitters without saving
+    std::vector<size_t> vec_pool;
+    if (host_isa_ == cpu::x64::avx512_common) {
+        for (size_t i = 16; i < 32; i++)
+            vec_pool.push_back(i);
+    }
+
+    for (auto& c : code)
+        c.first->emit_code(c.second.first, c.second.second, vec_pool, {});
+
+    h->postamble();
+}
+
+/// TILE ///
+TileEmitter::TileEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n), code(ngraph::as_type_ptr<ngraph::snippets::op::Tile>(n)->region) {}
+
+void TileEmitter::emit_code(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                            const std::vector<size_t>& pool, const std::vector<size_t>& gpr) const {
+    const size_t inc = in[0];
+    Reg64 amount = Reg64(reg64_tmp_start + in[1]);
+
+    Label for_body;
+    Label for_end;
+
+    h->cmp(amount, inc);
+    h->jl(for_end, CodeGenerator::T_NEAR);
+
+    h->L(for_body);
+    for (auto& c : code)
+        c.first->emit_code(c.second.first, c.second.second, pool, gpr);
+    h->sub(amount, inc);
+    h->cmp(amount, inc);
+    h->jge(for_body, CodeGenerator::T_NEAR);
+
+    h->L(for_end);
+}
+
+/// FAKE BROADCAST ///
+FakeBroadcastEmitter::FakeBroadcastEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    use_broadcast = innermost_dim(n->get_input_shape(0)) != innermost_dim(n->get_output_shape(0));
+}
+
+void FakeBroadcastEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                     const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void FakeBroadcastEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src0 = Vmm(in[0]);
+    Xmm xmm_src0 = Xmm(in[0]);
+    Vmm vmm_dst  = Vmm(out[0]);
+
+    if (use_broadcast) {
+        h->uni_vbroadcastss(vmm_dst, xmm_src0);
+    } else if (in[0] != out[0]) {
+        h->uni_vmovups(vmm_dst, vmm_src0);
+    }
+}
+
+/// SCALAR ///
+ScalarEmitter::ScalarEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    value = ngraph::as_type_ptr<ngraph::snippets::op::Scalar>(n)->cast_vector<float>()[0];
+    prepare_table();
+}
+
+void ScalarEmitter::register_table_entries() {
+    push_arg_entry_of("scalar", float2int(value), true);
+}
+
+void ScalarEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                              const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                              const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void ScalarEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    h->uni_vmovups(Vmm(out[0]), table_val("scalar"));
+}
+
+/// MEMORY ///
+MemoryEmitter::MemoryEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    auto& rt = n->get_rt_info();
+    auto it = rt.find("effectiveAddress");
+    if (it == rt.end() || !ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second))
+        IE_THROW() << "Effective address is not assigned for " << n->get_friendly_name();
+    ea = static_cast<size_t>(ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second)->get());
+}
+
+/// STORE ///
+void StoreEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                             const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                             const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void StoreEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 out_reg(ea);
+    h->uni_vmovups(h->ptr[out_reg], Vmm(in[0]));
+    h->add(out_reg, cpu_isa_traits<isa>::vlen);
+}
+
+/// SCALAR STORE ///
+void ScalarStoreEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                   const emitter_context *emit_context) const {
+    Reg64 out_reg(ea);
+    h->uni_vmovss(h->ptr[out_reg], Xmm(in[0]));
+    h->add(out_reg, sizeof(float));
+}
+
+/// LOAD ///
+LoadEmitter::LoadEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : MemoryEmitter(h, isa, n) {
+    shouldPostIncrement = innermost_dim(n->get_input_shape(0)) != 1;
+}
+
+void LoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                            const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                            const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void LoadEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 in_reg(ea);
+    if (shouldPostIncrement) {
+        h->uni_vmovups(Vmm(out[0]), h->ptr[in_reg]);
+        h->add(in_reg, cpu_isa_traits<isa>::vlen);
+    } else {
+        // the innermost dimension is broadcasted, only the first element is valid and it's followed by a broadcast move
+        h->uni_vmovss(Xmm(out[0]), h->ptr[in_reg]);
+    }
+}
+
+/// SCALAR LOAD ///
+void ScalarLoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                  const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                  const emitter_context *emit_context) const {
+    Reg64 in_reg(ea);
+    h->uni_vmovss(Xmm(out[0]), h->ptr[in_reg]);
+    if (shouldPostIncrement)
+        h->add(in_reg, sizeof(float));
+}
+
+/// BROADCAST LOAD ///
+void BroadcastLoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                     const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void BroadcastLoadEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    // the pointer is not incremented since the same value is used for the whole innermost dimension
+    h->uni_vbroadcastss(Vmm(out[0]), h->ptr[Reg64(ea)]);
+}
+
+}  // namespace MKLDNNPlugin
@@ -7,9 +7,24 @@
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
-                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<MKLDNNInferRequest*>(inferRequest.get())->SetAsyncRequest(this);
+                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor,
+                                                               const InferenceEngine::ITaskExecutor::Ptr& conversionExecutor)
+    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor),
+      _inferRequest(static_cast<MKLDNNInferRequest*>(inferRequest.get())) {
+    _inferRequest->SetAsyncRequest(this);
+    if (conversionExecutor) {
+        _pipeline = {
+            {conversionExecutor, [this] {
+                _inferRequest->InferPreprocess();
+            }},
+            {taskExecutor, [this] {
+                _inferRequest->InferCompute(true);
+            }},
+            {conversionExecutor, [this] {
+                _inferRequest->InferPostprocess();
+            }}
+        };
+    }
 }
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
@@ -13,10 +13,18 @@ namespace MKLDNNPlugin {
 
 class MKLDNNAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
 public:
+    /**
+     * @param conversionExecutor if set, input and output conversions run on it as separate pipeline stages around
+     *        the graph execution stage run by taskExecutor
+     */
     MKLDNNAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr &inferRequest,
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
-                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                            const InferenceEngine::ITaskExecutor::Ptr &conversionExecutor = nullptr);
     ~MKLDNNAsyncInferRequest();
+
+private:
+    MKLDNNInferRequest* _inferRequest;
 };
 
 }  // namespace MKLDNNPlugin
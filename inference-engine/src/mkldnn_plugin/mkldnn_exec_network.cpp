@@ -10,6 +10,7 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
+#include "utils/serialize.hpp"
 #include "nodes/mkldnn_memory_node.hpp"
 #include <threading/ie_executor_manager.hpp>
 
@@ -19,6 +20,9 @@
 #include <unordered_set>
 #include <utility>
 #include <cstring>
+#include <sstream>
+#include <chrono>
+#include <future>
 #include <ngraph/opsets/opset1.hpp>
 #include <transformations/utils/utils.hpp>
 
@@ -35,13 +39,17 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const NetworkReshaper &reshaper,
+                                     const std::shared_ptr<InferenceEngine::CNNNetwork> &originalNetwork) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
-        _network(network) {
+        _network(network),
+    _reshaper(reshaper),
+    _originalNetwork(originalNetwork) {
     auto function = network.getFunction();
     if (function == nullptr) {
         IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
@@ -62,6 +70,12 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        // in the throughput mode input and output conversions of requests run on their own threads to overlap with
+        // the graph execution of other requests instead of occupying the stream threads
+        if (streamsExecutorConfig._streams > 1) {
+            _conversionExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+                IStreamsExecutor::Config{"CPUConversionExecutor", streamsExecutorConfig._streams, 1, IStreamsExecutor::ThreadBindingType::NONE});
+        }
     }
     if (0 != cfg.streamExecutorConfig._streams) {
         _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
@@ -113,6 +127,16 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 }
 
 MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
+    return GetGraph(_graphs, _network, _numaNodesWeights);
+}
+
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph(ShapeVariant &variant) {
+    return GetGraph(variant._graphs, variant._network, variant._numaNodesWeights);
+}
+
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph(std::deque<Graph> &graphs,
+                                                           const InferenceEngine::CNNNetwork &network,
+                                                           NumaNodesWeights &numaNodesWeights) {
     int streamId = 0;
     int numaNodeId = 0;
     auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
@@ -120,7 +144,7 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
     }
-    auto graphLock = Graph::Lock(_graphs[streamId % _graphs.size()]);
+    auto graphLock = Graph::Lock(graphs[streamId % graphs.size()]);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
@@ -129,7 +153,7 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph.CreateGraph(network, extensionManager, numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -146,6 +170,66 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
     return graphLock;
 }
 
+MKLDNNExecNetwork::ShapeVariantPtr MKLDNNExecNetwork::GetShapeVariant(const InferenceEngine::ICNNNetwork::InputShapes &shapes) {
+    if (!_reshaper)
+        IE_THROW() << "Runtime reshape is not enabled for network " << _name;
+
+    std::ostringstream keyStream;
+    for (const auto& shape : shapes) {
+        keyStream << shape.first << ":";
+        for (auto dim : shape.second)
+            keyStream << dim << ",";
+        keyStream << ";";
+    }
+    const auto key = keyStream.str();
+
+    std::promise<ShapeVariantPtr> promise;
+    std::shared_future<ShapeVariantPtr> future;
+    bool reshapeHere = false;
+    {
+        std::lock_guard<std::mutex> lock{_shapeVariantsMutex};
+        auto found = std::find_if(_shapeVariants.begin(), _shapeVariants.end(),
+                                  [&](const std::pair<std::string, std::shared_future<ShapeVariantPtr>>& variant) {
+                                      return variant.first == key;
+                                  });
+        if (found != _shapeVariants.end()) {
+            _shapeVariants.splice(_shapeVariants.begin(), _shapeVariants, found);
+            future = _shapeVariants.front().second;
+        } else {
+            future = promise.get_future().share();
+            _shapeVariants.emplace_front(key, future);
+            while (_shapeVariants.size() > static_cast<size_t>(std::max(1, _cfg.runtimeReshapeCacheSize))) {
+                // graphs that are still in use are kept alive by the infer requests
+                _shapeVariants.pop_back();
+            }
+            reshapeHere = true;
+        }
+    }
+    if (!reshapeHere) {
+        // another request reshapes the network for these shapes, or has already done it
+        return future.get();
+    }
+
+    // the reshape is done outside of the mutex, so requests with other shapes are not blocked by it
+    try {
+        auto variant = std::make_shared<ShapeVariant>();
+        variant->_network = _reshaper(shapes);
+        variant->_graphs.resize(_graphs.size());
+        promise.set_value(variant);
+        return variant;
+    } catch (...) {
+        {
+            // the failed variant is not cached, so the reshape is retried by the next request
+            std::lock_guard<std::mutex> lock{_shapeVariantsMutex};
+            _shapeVariants.remove_if([&](const std::pair<std::string, std::shared_future<ShapeVariantPtr>>& variant) {
+                return variant.first == key;
+            });
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -157,10 +241,24 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
             graphLock._graph.setProperty(properties);
         }
     }
+    std::lock_guard<std::mutex> lock{_shapeVariantsMutex};
+    for (auto& variant : _shapeVariants) {
+        // graphs of the variants which are being reshaped are not created yet, they will get the updated config
+        if (variant.second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            continue;
+        for (auto& g : variant.second.get()->_graphs) {
+            auto graphLock = Graph::Lock(g);
+            if (graphLock._graph.IsReady()) {
+                graphLock._graph.setProperty(properties);
+            }
+        }
+    }
 }
 
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    return std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor, _conversionExecutor);
 }
 
 InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
@@ -170,6 +268,21 @@ InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
     return GetGraph()._graph.dump();
 }
 
+void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::Export");
+
+    CNNNetworkSerializer serializer(modelStream, extensionManager->Extensions());
+    if (_originalNetwork) {
+        serializer.write(*_originalNetwork, false);
+    } else if (CNNNetworkSerializer::canSerialize(_network.getFunction(), extensionManager->Extensions())) {
+        serializer.write(_network, true);
+    } else {
+        // the network before transformations is kept only when the model cache is enabled
+        IE_THROW(NotImplemented) << "The network can't be exported after the CPU plugin transformations, "
+                                 << "set " << CONFIG_KEY(CACHE_DIR) << " before loading the network to export it";
+    }
+}
+
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
     if (_graphs.size() == 0)
         IE_THROW() << "No graph was found";
@@ -16,6 +16,9 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <functional>
+#include <list>
+#include <future>
 
 namespace MKLDNNPlugin {
 
@@ -23,6 +26,11 @@ class MKLDNNExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefa
 public:
     typedef std::shared_ptr<MKLDNNExecNetwork> Ptr;
 
+    /**
+     * @brief Produces a network ready for MKLDNNGraph compilation (reshaped and transformed) for the given input shapes
+     */
+    using NetworkReshaper = std::function<InferenceEngine::CNNNetwork(const InferenceEngine::ICNNNetwork::InputShapes&)>;
+
     std::shared_ptr<InferenceEngine::IInferRequestInternal>
     CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                            InferenceEngine::OutputsDataMap networkOutputs) override;
@@ -30,7 +38,9 @@ public:
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const NetworkReshaper &reshaper = {},
+                      const std::shared_ptr<InferenceEngine::CNNNetwork> &originalNetwork = nullptr);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -40,6 +50,8 @@ public:
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    void Export(std::ostream& modelStream) override;
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
@@ -62,6 +74,8 @@ protected:
     // WARNING: Do not use _graphs directly.
     std::deque<Graph>                           _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // runs input and output conversions of asynchronous requests, not set if they run on the stream threads
+    InferenceEngine::ITaskExecutor::Ptr         _conversionExecutor;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -69,7 +83,34 @@ protected:
      */
     Graph::Lock GetGraph();
 
+    /* Compiled graphs for input shapes that differ from the network ones (see KEY_CPU_RUNTIME_RESHAPE_CACHE_SIZE).
+     * Every variant has its own weights cache since constant subgraphs may be folded differently for different shapes.
+     */
+    struct ShapeVariant {
+        InferenceEngine::CNNNetwork             _network;
+        NumaNodesWeights                        _numaNodesWeights;
+        std::deque<Graph>                       _graphs;
+    };
+    using ShapeVariantPtr = std::shared_ptr<ShapeVariant>;
+
+    NetworkReshaper                             _reshaper;
+    // the network before plugin transformations, it is exported instead of the transformed one if it is set
+    std::shared_ptr<InferenceEngine::CNNNetwork> _originalNetwork;
+    std::mutex                                  _shapeVariantsMutex;
+    // most recently used variant goes first, the variant is reshaped outside of the mutex by the first request needing it
+    std::list<std::pair<std::string, std::shared_future<ShapeVariantPtr>>> _shapeVariants;
+
+    /* Returns the variant compiled for given input shapes. Reshapes and transforms the original network on cache miss
+     * and evicts the least recently used variant if the cache is full.
+     * NOTE: The variant should be kept alive by the caller while its graphs are used.
+     */
+    ShapeVariantPtr GetShapeVariant(const InferenceEngine::ICNNNetwork::InputShapes &shapes);
+    Graph::Lock GetGraph(ShapeVariant &variant);
+
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
+
+private:
+    Graph::Lock GetGraph(std::deque<Graph> &graphs, const InferenceEngine::CNNNetwork &network, NumaNodesWeights &numaNodesWeights);
 };
 
 }  // namespace MKLDNNPlugin
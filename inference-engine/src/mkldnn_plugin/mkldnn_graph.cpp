@@ -33,6 +33,7 @@
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include <ie_parallel.hpp>
 
 #include "utils/general_utils.h"
 #include "utils/debug_capabilities.h"
@@ -75,6 +76,8 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
         ForgetGraphData();
     // disable caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // a single stream may use cores of all the nodes, so its memory is not bound
+    numaNodeId = weightsCache ? weightsCache->getNumaNodeId() : -1;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -338,6 +341,8 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    InitExecutionLevels();
+
     Allocate();
 
     CreatePrimitives();
@@ -510,6 +515,66 @@ void MKLDNNGraph::InitEdges() {
     }
 }
 
+void MKLDNNGraph::InitExecutionLevels() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitExecutionLevels");
+
+    executionLevels.clear();
+    nodesExecLevel.clear();
+
+    // Parallel execution relies on nested TBB parallelism and is not compatible with per-node blob dumping
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO) && !defined(CPU_DEBUG_CAPS)
+    if (!config.parallelGraphExecution)
+        return;
+
+    // Level of the node is the length of the longest path from graph inputs,
+    // so all producers of the node are placed to previous levels.
+    // graphNodes are sorted topologically, therefore all parents are visited first.
+    nodesExecLevel.resize(graphNodes.size(), 0);
+    int lastStatefulLevel = -1;
+    int levelsCount = 0;
+    for (auto &node : graphNodes) {
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            level = std::max(level, nodesExecLevel[parent->execIndex] + 1);
+        }
+
+        // ReadValue/Assign pairs communicate through the variable state rather than graph edges,
+        // so keep their relative order as in the sequential schedule
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput) {
+            level = std::max(level, lastStatefulLevel + 1);
+            lastStatefulLevel = level;
+        }
+
+        nodesExecLevel[node->execIndex] = level;
+        levelsCount = std::max(levelsCount, level + 1);
+    }
+
+    executionLevels.resize(levelsCount);
+    for (auto &node : graphNodes) {
+        if (!node->isConstant())
+            executionLevels[nodesExecLevel[node->execIndex]].push_back(node);
+    }
+
+    executionLevels.erase(std::remove_if(executionLevels.begin(), executionLevels.end(),
+                                         [](const std::vector<MKLDNNNodePtr>& level) { return level.empty(); }),
+                          executionLevels.end());
+
+    // There is nothing to execute concurrently, so fall back to the sequential schedule
+    if (std::none_of(executionLevels.begin(), executionLevels.end(),
+                     [](const std::vector<MKLDNNNodePtr>& level) { return level.size() > 1; })) {
+        executionLevels.clear();
+        nodesExecLevel.clear();
+    }
+#endif
+}
+
+int MKLDNNGraph::getExecPoint(const MKLDNNNodePtr& node) const {
+    // In the parallel mode all nodes of one level are alive at the same time, so memory
+    // lifetimes are expressed in levels instead of positions in the sequential order
+    return nodesExecLevel.empty() ? node->execIndex : nodesExecLevel[node->execIndex];
+}
+
 static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
@@ -598,8 +663,8 @@ void MKLDNNGraph::AllocateWithReuse() {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = getExecPoint(edge->getParent());
+            int e_finish = getExecPoint(edge->getChild());
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -651,6 +716,8 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    // the workspace is used by the stream only, so it is placed on the stream's node before the first touch
+    memWorkspace->BindToNumaNode(numaNodeId);
 
     if (edge_clusters.empty())
         return;
@@ -705,7 +772,7 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
-void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool withNormalization) {
     if (!IsReady()) IE_THROW()<< "Wrong state. Topology not ready.";
 
     auto input = inputNodesMap.find(name);
@@ -725,7 +792,7 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         }
 
         // todo: make sure 'name' exists in this map...
-        if (_normalizePreprocMap.find(name) != _normalizePreprocMap.end()) {
+        if (withNormalization && _normalizePreprocMap.find(name) != _normalizePreprocMap.end()) {
             if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
                 _normalizePreprocMap[name].NormalizeImage(outDims, reinterpret_cast<float *>(inter_data_ptr),
                                                           in->getTensorDesc().getLayout());
@@ -801,6 +868,22 @@ void MKLDNNGraph::PullOutputData(const BlobMap &out) {
     }
 }
 
+void MKLDNNGraph::InferNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, MKLDNNInferRequest* request, int batch) {
+    if (request != nullptr) {
+        request->ThrowIfCanceled();
+    }
+
+    PERF(node);
+
+    if (batch > 0)
+        node->setDynamicBatchLim(batch);
+
+    if (!node->isConstant()) {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+        node->execute(stream);
+    }
+}
+
 void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
@@ -808,24 +891,33 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
 
     mkldnn::stream stream(eng);
 
-    ENABLE_CPU_DEBUG_CAP(NodeDumper nd(config.debugCaps, infer_count));
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!executionLevels.empty()) {
+        for (auto &level : executionLevels) {
+            if (level.size() == 1) {
+                InferNode(level.front(), stream, request, batch);
+                continue;
+            }
 
-    for (int i = 0; i < graphNodes.size(); i++) {
-        if (request != nullptr) {
-            request->ThrowIfCanceled();
+            // Nested parallel regions of the nodes are executed in the same (stream's) arena.
+            // mkldnn::stream must not be shared between threads, so each node gets its own one.
+            tbb::parallel_for(size_t(0), level.size(), [&](size_t i) {
+                mkldnn::stream nodeStream(eng);
+                InferNode(level[i], nodeStream, request, batch);
+            });
         }
 
-        PERF(graphNodes[i]);
+        if (infer_count != -1) infer_count++;
+        return;
+    }
+#endif
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+    ENABLE_CPU_DEBUG_CAP(NodeDumper nd(config.debugCaps, infer_count));
 
+    for (int i = 0; i < graphNodes.size(); i++) {
         ENABLE_CPU_DEBUG_CAP(nd.dumpInputBlobs(graphNodes[i]));
 
-        if (!graphNodes[i]->isConstant()) {
-            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
-            graphNodes[i]->execute(stream);
-        }
+        InferNode(graphNodes[i], stream, request, batch);
 
         ENABLE_CPU_DEBUG_CAP(nd.dumpOutputBlobs(graphNodes[i]));
     }
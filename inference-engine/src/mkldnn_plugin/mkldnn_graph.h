@@ -56,7 +56,7 @@ public:
         return _normalizePreprocMap.find(name) != _normalizePreprocMap.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool withNormalization = true);
     void PullOutputData(const InferenceEngine::BlobMap &out);
 
     void Infer(MKLDNNInferRequest* request = nullptr, int batch = -1);
@@ -182,6 +182,8 @@ protected:
         outputNodesMap.clear();
         graphNodes.clear();
         graphEdges.clear();
+        executionLevels.clear();
+        nodesExecLevel.clear();
         _normalizePreprocMap.clear();
     }
     Status status { NotReady };
@@ -194,12 +196,20 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    // NUMA node the intermediate buffers are bound to, -1 - no binding
+    int numaNodeId = -1;
 
     std::map<std::string, MKLDNNNodePtr> inputNodesMap;
     std::map<std::string, MKLDNNNodePtr> outputNodesMap;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
+    // Wavefront schedule used when parallel graph execution is enabled.
+    // Nodes of the same level have no dependencies on each other and may run concurrently.
+    std::vector<std::vector<MKLDNNNodePtr>> executionLevels;
+    // Execution level of each node, indexed by MKLDNNNode::execIndex
+    std::vector<int> nodesExecLevel;
+
     std::map<std::string, NormalizePreprocess> _normalizePreprocMap;
     std::string _name;
 
@@ -214,6 +224,7 @@ protected:
     void InitDescriptors();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
+    void InitExecutionLevels();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
@@ -225,6 +236,8 @@ protected:
 
 private:
     void EnforceBF16();
+    void InferNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, MKLDNNInferRequest* request, int batch);
+    int getExecPoint(const MKLDNNNodePtr& node) const;
 };
 
 }  // namespace MKLDNNPlugin
@@ -4,6 +4,7 @@
 
 #include "mkldnn_infer_request.h"
 #include "mkldnn_extension_utils.h"
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <map>
@@ -33,7 +34,14 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
 
     if (execNetwork->_graphs.size() == 0)
         IE_THROW() << "No graph was found";
-    graph = &(execNetwork->GetGraph()._graph);
+    {
+        auto graphLock = execNetwork->GetGraph();
+        graph = &(graphLock._graph);
+        for (const auto& input : _networkInputs) {
+            if (graph->hasMeanImageFor(input.first))
+                meanImageInputs.insert(input.first);
+        }
+    }
 
     // Allocate all input blobs
     for (const auto& it : _networkInputs) {
@@ -73,40 +81,85 @@ MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
     --(execNetwork->_numRequests);
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
-    bool needConvert = inPrec != inputBlob->getTensorDesc().getPrecision();
-
+void MKLDNNPlugin::MKLDNNInferRequest::convertInput(const std::string& inputName, const InferenceEngine::Blob::Ptr& inputBlob,
+                                                    InferenceEngine::Precision inPrec) {
     if (inputBlob->cbuffer().as<const void *>() == nullptr) {
         IE_THROW() << "Input blob has no allocated memory";
     }
 
-    InferenceEngine::Blob::Ptr iconv;
-    if (needConvert) {
-        iconv = make_blob_with_precision(inPrec, InferenceEngine::TensorDesc(inPrec, inputBlob->getTensorDesc().getDims(),
-                                         inputBlob->getTensorDesc().getLayout()));
+    const auto& inputDesc = inputBlob->getTensorDesc();
+    if (inPrec == inputDesc.getPrecision()) {
+        convertedInputs.erase(inputName);
+        return;
+    }
+
+    const InferenceEngine::TensorDesc convDesc(inPrec, inputDesc.getDims(), inputDesc.getLayout());
+    auto& iconv = convertedInputs[inputName];
+    if (!iconv || iconv->getTensorDesc() != convDesc) {
+        iconv = make_blob_with_precision(inPrec, convDesc);
         iconv->allocate();
-        if (inputBlob->size() != iconv->size())
-            IE_THROW() << "Can't copy tensor: input and converted tensors have different number of elements: " << inputBlob->size() << " and "
-                               << iconv->size();
-
-        void *srcData = inputBlob->cbuffer().as<void *>();
-        void *dstData = iconv->buffer().as<void *>();
-        if (dstData == nullptr) {
-            IE_THROW() << "Converted input blob has no allocated memory";
-        }
-        cpu_convert(srcData, dstData, inputBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
     }
 
-    graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
+    void *srcData = inputBlob->cbuffer().as<void *>();
+    void *dstData = iconv->buffer().as<void *>();
+    if (dstData == nullptr) {
+        IE_THROW() << "Converted input blob has no allocated memory";
+    }
+    cpu_convert(srcData, dstData, inputDesc.getPrecision(), inPrec, iconv->size());
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
+bool MKLDNNPlugin::MKLDNNInferRequest::fusedPreprocessing(const std::string& inputName,
+                                                          const InferenceEngine::PreProcessDataPtr& preprocData) {
+    // the color conversion, resize and normalization are done in one pass writing the FP32 graph input directly,
+    // instead of producing U8 blob which is converted, copied to the graph and normalized there
+    const auto& inputDesc = _inputs[inputName]->getTensorDesc();
+    const InferenceEngine::TensorDesc fusedDesc(InferenceEngine::Precision::FP32, inputDesc.getDims(), inputDesc.getLayout());
+    auto& iconv = convertedInputs[inputName];
+    const bool reallocated = !iconv || iconv->getTensorDesc() != fusedDesc;
+    if (reallocated) {
+        iconv = make_blob_with_precision(fusedDesc);
+        iconv->allocate();
+        externalPtr.erase(inputName);
+    }
+
+    if (!preprocData->executeFused(iconv, _networkInputs[inputName]->getPreProcess(), false, m_curBatch)) {
+        externalPtr.erase(inputName);
+        return false;
+    }
+
+    normalizedInputs.insert(inputName);
+    return true;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::bindNormalizedInputs() {
+    for (const auto& name : normalizedInputs) {
+        const auto& normalized = convertedInputs.at(name);
+        void* normalizedPtr = normalized->buffer();
+        auto ptr = externalPtr.find(name);
+        if (ptr != externalPtr.end() && ptr->second == normalizedPtr)
+            continue;
+
+        // the normalized blob is owned by the request, so the graph may read it without copying
+        auto input = graph->inputNodesMap.find(name);
+        if (input != graph->inputNodesMap.end() && input->second->getChildEdgeAt(0)->getBlob()->getTensorDesc() == normalized->getTensorDesc() &&
+            !graph->getProperty().batchLimit) {
+            externalPtr[name] = normalizedPtr;
+        } else if (ptr != externalPtr.end()) {
+            externalPtr.erase(ptr);
+        }
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::ConvertInputData() {
     for (auto input : _inputs) {
         if (!_networkInputs[input.first]) {
             IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << input.first;
         }
+        if (normalizedInputs.count(input.first)) {
+            continue;
+        }
         auto inPrec = input.second->getTensorDesc().getPrecision();
-        if (graph->hasMeanImageFor(input.first) && one_of(inPrec, InferenceEngine::Precision::U8, InferenceEngine::Precision::BOOL)) {
+        if (meanImageInputs.count(input.first) && one_of(inPrec, InferenceEngine::Precision::U8, InferenceEngine::Precision::BOOL)) {
             inPrec = InferenceEngine::Precision::FP32;
         } else {
             inPrec = normalizeToSupportedPrecision(inPrec);
@@ -122,42 +175,93 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
             input.second->getTensorDesc().setLayout(_networkInputs[input.first]->getLayout());
         }
 
-        pushInput(input.first, input.second, inPrec);
+        convertInput(input.first, input.second, inPrec);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
+    for (const auto& input : _inputs) {
+        auto converted = convertedInputs.find(input.first);
+        graph->PushInputData(input.first, converted != convertedInputs.end() ? converted->second : input.second,
+                             !normalizedInputs.count(input.first));
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PullOutputData(bool deferOutputConversion) {
+    if (!deferOutputConversion) {
+        deferredOutputs.clear();
+        graph->PullOutputData(_outputs);
+        return;
+    }
+
+    // outputs of other precisions are copied to intermediate blobs, so the graph memory is released for other requests
+    // without waiting for the conversion
+    auto outputs = _outputs;
+    for (auto& output : outputs) {
+        auto graphOutput = graph->outputNodesMap.find(output.first);
+        if (graphOutput == graph->outputNodesMap.end())
+            continue;
+        const auto& desc = output.second->getTensorDesc();
+        const auto graphPrec = MKLDNNExtensionUtils::DataTypeToIEPrecision(graphOutput->second->getParentEdgeAt(0)->getMemory().GetDataType());
+        if (graphPrec == desc.getPrecision()) {
+            deferredOutputs.erase(output.first);
+            continue;
+        }
+
+        const InferenceEngine::TensorDesc deferredDesc(graphPrec, desc.getDims(), desc.getLayout());
+        auto& deferred = deferredOutputs[output.first];
+        if (!deferred || deferred->getTensorDesc() != deferredDesc) {
+            deferred = make_blob_with_precision(deferredDesc);
+            deferred->allocate();
+        }
+        output.second = deferred;
     }
+    graph->PullOutputData(outputs);
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
+void MKLDNNPlugin::MKLDNNInferRequest::BindStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
             auto cur_id = cur_node->getId();
+            // Remove suffix with pair ID as it is done for the state names
+            auto suffix_idx = cur_id.find("/id=");
+            if (suffix_idx != std::string::npos)
+                cur_id = cur_id.substr(0, suffix_idx);
+
+            void* readBuffer = nullptr;
+            void* writeBuffer = nullptr;
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+                    IE_ASSERT(cur_state != nullptr);
+                    IE_ASSERT(cur_state->GetState()->byteSize() == cur_node->getStore()->GetSize())
+                        << "Variable state " << cur_id << " does not match the graph memory.";
+                    readBuffer = cur_state->GetReadBuffer();
+                    writeBuffer = cur_state->GetWriteBuffer();
+                    break;
                 }
             }
+            cur_node->bindState(readBuffer, writeBuffer);
         }
     }
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
+void MKLDNNPlugin::MKLDNNInferRequest::SwapStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            if (!cur_node->isStateStored())
+                continue;
             auto cur_id = cur_node->getId();
+            auto suffix_idx = cur_id.find("/id=");
+            if (suffix_idx != std::string::npos)
+                cur_id = cur_id.substr(0, suffix_idx);
+
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    std::static_pointer_cast<MKLDNNVariableState>(state)->SwapBuffers();
+                    break;
                 }
             }
         }
@@ -166,34 +270,133 @@ void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
 
 
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
+    InferPreprocess();
+    InferCompute(false);
+    InferPostprocess();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::InferPreprocess() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNInferRequest::InferPreprocess");
+    ThrowIfCanceled();
+
+    for (auto& input : _inputs) {
+        auto it = _preProcData.find(input.first);
+        if (it == _preProcData.end())
+            continue;
+        if (!meanImageInputs.count(input.first) || !fusedPreprocessing(input.first, it->second)) {
+            normalizedInputs.erase(input.first);
+            it->second->execute(input.second, _networkInputs[input.first]->getPreProcess(), false, m_curBatch);
+        }
+    }
+
+    ThrowIfCanceled();
+
+    ConvertInputData();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::InferCompute(bool deferOutputConversion) {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
-    auto graphLock = execNetwork->GetGraph();
+    shapeVariant.reset();
+    InferenceEngine::ICNNNetwork::InputShapes inputShapes;
+    if (execNetwork->_reshaper && getReshapedInputShapes(inputShapes)) {
+        if (memoryStates.size() != 0)
+            IE_THROW() << "Runtime reshape is not supported for networks with memory states";
+        shapeVariant = execNetwork->GetShapeVariant(inputShapes);
+    }
+    auto graphLock = shapeVariant ? execNetwork->GetGraph(*shapeVariant) : execNetwork->GetGraph();
     graph = &(graphLock._graph);
 
     ThrowIfCanceled();
 
-    execDataPreprocessing(_inputs);
-
-    changeDefaultPtr();
+    // Blobs may change their shapes between calls if runtime reshape is enabled, so zero-copy is not used in such a case
+    if (!execNetwork->_reshaper) {
+        bindNormalizedInputs();
+        changeDefaultPtr();
+    } else {
+        updateOutputBlobs();
+    }
 
     ThrowIfCanceled();
 
     PushInputData();
 
     if (memoryStates.size() != 0) {
-        PushStates();
+        BindStates();
     }
 
     graph->Infer(this, m_curBatch);
 
     if (memoryStates.size() != 0) {
-        PullStates();
+        SwapStates();
     }
 
     ThrowIfCanceled();
 
-    graph->PullOutputData(_outputs);
+    PullOutputData(deferOutputConversion);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::InferPostprocess() {
+    if (deferredOutputs.empty())
+        return;
+
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNInferRequest::InferPostprocess");
+    for (const auto& deferred : deferredOutputs) {
+        const auto& output = _outputs.at(deferred.first);
+        const auto& dims = output->getTensorDesc().getDims();
+        size_t size = output->size();
+        // only the processed part of the batch is copied by the graph
+        if (m_curBatch > 0 && !dims.empty() && dims[0] != 0)
+            size = size / dims[0] * std::min<size_t>(m_curBatch, dims[0]);
+        cpu_convert(deferred.second->cbuffer().as<void *>(), output->buffer().as<void *>(),
+                    deferred.second->getTensorDesc().getPrecision(), output->getTensorDesc().getPrecision(), size);
+    }
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::getReshapedInputShapes(InferenceEngine::ICNNNetwork::InputShapes& shapes) const {
+    bool reshaped = false;
+    for (const auto& input : _networkInputs) {
+        auto blob = _inputs.find(input.first);
+        if (blob == _inputs.end()) {
+            IE_THROW() << "Input blob is not set for input " << input.first;
+        }
+        const auto& dims = blob->second->getTensorDesc().getDims();
+        reshaped = reshaped || dims != input.second->getTensorDesc().getDims();
+        shapes[input.first] = dims;
+    }
+    return reshaped;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::updateOutputBlobs() {
+    InferenceEngine::BlobMap blobs;
+    graph->getOutputBlobs(blobs);
+    for (auto& output : _outputs) {
+        auto graphOutput = blobs.find(output.first);
+        if (graphOutput == blobs.end())
+            continue;
+        const auto& dims = graphOutput->second->getTensorDesc().getDims();
+        const auto& desc = output.second->getTensorDesc();
+        if (desc.getDims() == dims)
+            continue;
+
+        auto layout = dims.size() == desc.getDims().size() ? desc.getLayout() : InferenceEngine::TensorDesc::getLayoutByDims(dims);
+        output.second = make_blob_with_precision(InferenceEngine::TensorDesc(desc.getPrecision(), dims, layout));
+        output.second->allocate();
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    if (!execNetwork->_reshaper) {
+        IInferRequestInternal::checkBlobs();
+        return;
+    }
+    // the network dims are not the reference ones if runtime reshape is enabled
+    for (auto const& input : _inputs) {
+        checkBlob(input.second, input.first, true, input.second->getTensorDesc().getDims());
+    }
+    for (auto const& output : _outputs) {
+        checkBlob(output.second, output.first, false, output.second->getTensorDesc().getDims());
+    }
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts() const {
@@ -241,7 +444,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
             }
         }
         data = _inputs[name];
-        checkBlob(data, name, true);
+        checkBlob(data, name, true, execNetwork->_reshaper ? data->getTensorDesc().getDims() : InferenceEngine::SizeVector{});
         // check if preprocess required, but still wasn't set
         auto preProcessedInput = std::find_if(std::begin(_networkInputs), std::end(_networkInputs),
             [&](const std::pair<std::string, InferenceEngine::InputInfo::Ptr>& pair)
@@ -300,7 +503,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
             }
         }
         data = _outputs[name];
-        checkBlob(data, name, false);
+        checkBlob(data, name, false, execNetwork->_reshaper ? data->getTensorDesc().getDims() : InferenceEngine::SizeVector{});
     }
     if (!data) {
         IE_THROW() << "Cannot find blob with name: " << name;
@@ -349,21 +552,29 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
         } else {
-            size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-                ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
-                : 1;
-            if (dataSize != inputSize) {
-                IE_THROW() << "Input blob size is not equal network input size ("
-                                   << dataSize << "!=" << inputSize << ").";
-            }
+            // Input of the same rank but with different dims is accepted if runtime reshape is enabled
+            const bool reshaped = execNetwork->_reshaper &&
+                foundInput->getTensorDesc().getDims().size() == data->getTensorDesc().getDims().size() &&
+                foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims();
+            if (!reshaped) {
+                size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                    ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
+                    : 1;
+                if (dataSize != inputSize) {
+                    IE_THROW() << "Input blob size is not equal network input size ("
+                                       << dataSize << "!=" << inputSize << ").";
+                }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-                IE_THROW(ParameterMismatch) << "Failed to set input blob. Dimensions mismatch.";
+                if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Dimensions mismatch.";
+                }
             }
 
-            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-                foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY) {
+                if (reshaped ? foundInput->getTensorDesc().getLayout() != data->getTensorDesc().getLayout()
+                             : foundInput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                    IE_THROW(ParameterMismatch) << "Failed to set input blob. Blocking descriptor mismatch.";
+                }
             }
 
             InferenceEngine::BlobMap blobs;
@@ -5,14 +5,15 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_exec_network.h"
 #include <memory>
 #include <string>
 #include <map>
+#include <set>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
 
-class MKLDNNExecNetwork;
 class MKLDNNAsyncInferRequest;
 
 class MKLDNNInferRequest : public InferenceEngine::IInferRequestInternal {
@@ -26,6 +27,24 @@ public:
 
     void InferImpl() override;
 
+    // Stages of InferImpl(). MKLDNNAsyncInferRequest may run the conversion stages on their own executor, so input and
+    // output conversions of one request overlap with the graph execution of another one.
+
+    /**
+     * @brief Runs the preprocessing and converts inputs to the precisions supported by the graph
+     */
+    void InferPreprocess();
+    /**
+     * @brief Executes the graph of the current stream
+     * @param deferOutputConversion if true, outputs which precisions differ from the graph ones are copied to
+     *        intermediate blobs and converted by InferPostprocess() after the graph is released
+     */
+    void InferCompute(bool deferOutputConversion);
+    /**
+     * @brief Converts outputs deferred by InferCompute()
+     */
+    void InferPostprocess();
+
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
 
     void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr &data) override;
@@ -47,19 +66,45 @@ public:
      */
     void ThrowIfCanceled() const;
 
+protected:
+    void checkBlobs() override;
+
 private:
+    /**
+     * @brief Runs the pre-processing of the input fused with its normalization
+     * @return false if the fused pre-processing is not applicable for the input
+     */
+    bool fusedPreprocessing(const std::string& inputName, const InferenceEngine::PreProcessDataPtr& preprocData);
+    // lets the graph read the blobs written by the fused pre-processing without copying, must be called under the graph lock
+    void bindNormalizedInputs();
+    void ConvertInputData();
     void PushInputData();
-    void PushStates();
-    void PullStates();
+    void PullOutputData(bool deferOutputConversion);
+    // points the memory nodes of the graph to the buffers of the variable states, so the states are not copied
+    void BindStates();
+    // makes the states written by the inference current
+    void SwapStates();
 
-    void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
+    void convertInput(const std::string& inputName, const InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
+    bool getReshapedInputShapes(InferenceEngine::ICNNNetwork::InputShapes& shapes) const;
+    void updateOutputBlobs();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    // keeps the graphs compiled for non-default input shapes alive while the request refers to them
+    MKLDNNExecNetwork::ShapeVariantPtr  shapeVariant;
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+    // inputs converted to the graph precisions, the blobs are reused while input descriptors are not changed
+    InferenceEngine::BlobMap            convertedInputs;
+    // inputs which are normalized by the fused pre-processing, so the graph must not normalize them again
+    std::set<std::string>               normalizedInputs;
+    // inputs normalized by the graph, collected under the graph lock so the pre-processing stage does not access the graph
+    std::set<std::string>               meanImageInputs;
+    // outputs of the graph precisions waiting for the conversion to the user precisions
+    InferenceEngine::BlobMap            deferredOutputs;
 };
 }  // namespace MKLDNNPlugin
@@ -60,6 +60,8 @@ void MKLDNNMemory::Create(const memory::dims& dims, memory::data_type data_type,
 }
 
 void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bool pads_zeroing) {
+    numaBinding.reset();
+    ownData = data == nullptr;
     if (data == nullptr) {
         prim.reset(new memory(desc, eng));
 
@@ -89,6 +91,12 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bo
     }
 }
 
+void MKLDNNMemory::BindToNumaNode(int numaNodeId) {
+    if (!ownData || !prim || numaBinding)
+        return;
+    numaBinding = NumaMemoryBinding::bind(prim->get_data_handle(), prim->get_desc().get_size(), numaNodeId);
+}
+
 void MKLDNNMemory::reorderData(const MKLDNNMemory &input, const MKLDNNMemory &output, size_t size) {
     if (size != 0)
         IE_ASSERT(size <= output.GetDescriptor().get_size());
@@ -6,6 +6,7 @@
 
 #include "ie_layouts.h"
 #include "mkldnn_dims.h"
+#include "utils/numa_memory.hpp"
 #include <mkldnn.hpp>
 #include <mkldnn_types.h>
 
@@ -155,6 +156,12 @@ public:
     void SetData(const MKLDNNMemory& memory, size_t size = 0, bool ftz = true) const;
     void FillZero();
 
+    /**
+     * Binds the memory allocated by the object to the NUMA node, does nothing for external data
+     * @param numaNodeId id of the node, negative value means no binding
+     */
+    void BindToNumaNode(int numaNodeId);
+
     static mkldnn::memory::format_tag GetPlainFormat(const mkldnn::memory::dims& dims);
     static InferenceEngine::Layout GetPlainLayout(const mkldnn::memory::dims& dims);
     static bool isConsistant(const mkldnn::memory::dims& dims, mkldnn::memory::format_tag format);
@@ -169,6 +176,8 @@ public:
 private:
     std::shared_ptr<mkldnn::memory> prim;
     mkldnn::engine eng;
+    bool ownData = false;
+    NumaMemoryBinding::Ptr numaBinding;
 };
 
 using MKLDNNMemoryPtr = std::shared_ptr<MKLDNNMemory>;
@@ -10,8 +10,78 @@ using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief Two buffers of the state. It is also the allocator of the state blob: the blob is locked to the current
+ * buffer, so the blob kept by the user follows the swaps and outlives the state.
+ */
+class MKLDNNVariableState::PingPongBuffers : public IAllocator {
+public:
+    explicit PingPongBuffers(const TensorDesc& desc) {
+        for (auto& buffer : buffers) {
+            buffer = make_blob_with_precision(desc);
+            buffer->allocate();
+        }
+    }
+
+    void* read() const {
+        return buffers[current]->buffer();
+    }
+    void* write() const {
+        return buffers[1 - current]->buffer();
+    }
+    void swap() {
+        current = 1 - current;
+    }
+
+    void* lock(void* /*handle*/, LockOp /*op*/) noexcept override {
+        return read();
+    }
+    void unlock(void* /*handle*/) noexcept override {}
+    void* alloc(size_t /*size*/) noexcept override {
+        // the memory is owned by the buffers, the handle only has to be non-null
+        return this;
+    }
+    bool free(void* /*handle*/) noexcept override {
+        return true;
+    }
+
+private:
+    Blob::Ptr buffers[2];
+    size_t current = 0;
+};
+
+MKLDNNVariableState::MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
+        InferenceEngine::IVariableStateInternal{name} {
+    const TensorDesc desc = MKLDNNMemoryDesc(storage->GetDescriptor());
+    buffers = std::make_shared<PingPongBuffers>(desc);
+    cpu_memcpy(buffers->read(), storage->GetData(), storage->GetSize());
+    state = make_blob_with_precision(desc, buffers);
+    state->allocate();
+}
+
+void* MKLDNNVariableState::GetReadBuffer() const {
+    return buffers->read();
+}
+
+void* MKLDNNVariableState::GetWriteBuffer() const {
+    return buffers->write();
+}
+
 void  MKLDNNVariableState::Reset() {
     std::memset(state->buffer(), 0, state->byteSize());
 }
 
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState)
+        IE_THROW(NotAllocated) << "Variable state " << name << " cannot be set to a null blob";
+    if (newState->byteSize() != state->byteSize())
+        IE_THROW(ParameterMismatch) << "Variable state " << name << " has " << state->byteSize()
+                                    << " bytes, but the new state has " << newState->byteSize() << " bytes";
+    cpu_memcpy(state->buffer(), newState->cbuffer(), state->byteSize());
+}
+
+void MKLDNNVariableState::SwapBuffers() {
+    buffers->swap();
+}
+
 }  // namespace MKLDNNPlugin
@@ -9,20 +9,33 @@
 #include "mkldnn_memory.h"
 #include "nodes/common/cpu_memcpy.h"
 
+#include <memory>
 #include <string>
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief Variable state kept in two buffers: the inference reads the current one and writes the new state to the
+ * other one, then the buffers are swapped. The graph edges point to the buffers, so the state is not copied.
+ * The blob returned by GetState always refers to the current buffer, so it stays valid after the swap.
+ */
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
-            InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MKLDNNMemoryDesc(storage->GetDescriptor()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
-    }
+    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+
+    void* GetReadBuffer() const;
+    void* GetWriteBuffer() const;
+    /**
+     * @brief Makes the state written by the last inference current
+     */
+    void SwapBuffers();
+
+private:
+    class PingPongBuffers;
+    std::shared_ptr<PingPongBuffers> buffers;
 };
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+}  // namespace MKLDNNPlugin
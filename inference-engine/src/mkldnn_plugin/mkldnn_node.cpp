@@ -7,6 +7,7 @@
 #include "mkldnn_itt.h"
 
 #include "caseless.hpp"
+#include "ie_data_hash.hpp"
 #include <vector>
 #include <string>
 #include <limits>
@@ -223,7 +224,8 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ExperimentalDetectronPriorGridGenerator", ExperimentalDetectronPriorGridGenerator},
         { "ExperimentalDetectronGenerateProposalsSingleImage", ExperimentalDetectronGenerateProposalsSingleImage},
         { "ExtractImagePatches", ExtractImagePatches},
-        { "NonMaxSuppressionIEInternal", NonMaxSuppression}
+        { "NonMaxSuppressionIEInternal", NonMaxSuppression},
+        { "Subgraph", Subgraph}
 };
 
 Type TypeFromName(const std::string type) {
@@ -629,6 +631,19 @@ void MKLDNNNode::execute(mkldnn::stream strm) {
     }
 }
 
+void MKLDNNNode::appendScratchpad(const mkldnn::primitive_desc_base& pd) {
+    auto scratchpadDesc = pd.scratchpad_desc();
+    if (scratchpadDesc.get_size() == 0) {
+        scratchpadMem.reset();
+        primArgs.erase(DNNL_ARG_SCRATCHPAD);
+        return;
+    }
+
+    scratchpadMem = std::make_shared<MKLDNNMemory>(engine);
+    scratchpadMem->Create(scratchpadDesc);
+    primArgs[DNNL_ARG_SCRATCHPAD] = scratchpadMem->GetPrimitive();
+}
+
 void MKLDNNNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
@@ -820,8 +835,8 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
+            const uint64_t data_hash = InferenceEngine::computeDataHash(
+                    internalBlob->cbuffer(), internalBlob->byteSize());
 
             const std::string string_hash = name + "_" + std::to_string(i)
                                             + "_" + std::to_string(internalBlob->byteSize())
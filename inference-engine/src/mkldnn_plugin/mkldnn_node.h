@@ -192,6 +192,8 @@ static std::string NameFromType(Type type) {
             return "ExtractImagePatches";
         case NonMaxSuppression:
             return "NonMaxSuppression";
+        case Subgraph:
+            return "Subgraph";
         default:
             return "Unknown";
     }
@@ -659,6 +661,14 @@ protected:
     virtual void appendPostOps(mkldnn::post_ops& ops);
     virtual std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr() const { return nullptr; }
 
+    /**
+     * @brief Allocates scratchpad memory of the node and passes it to the primitive as an argument.
+     * Primitives are shared between graphs and streams by MKLDNNPrimitiveCache, so they are created with
+     * user scratchpad mode and must not use the scratchpad owned by the primitive itself.
+     * @param pd Descriptor of the node primitive
+     */
+    void appendScratchpad(const mkldnn::primitive_desc_base& pd);
+
     typedef std::function<MKLDNNMemoryDesc (mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx)>
             GetPrimitiveMemoryFormatFunc;
     std::vector<GetPrimitiveMemoryFormatFunc> internalBlobDesc;
@@ -692,6 +702,7 @@ protected:
     std::vector<PrimitiveDescInfo> supportedPrimitiveDescriptors;
     std::unordered_map<int, mkldnn::memory> primArgs;
     MKLDNNPrimitive prim;
+    MKLDNNMemoryPtr scratchpadMem;
     std::vector<MKLDNNDescriptor> descs;
 
     InferenceEngine::Blob::Ptr ext_scales;
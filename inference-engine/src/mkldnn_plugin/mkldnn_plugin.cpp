@@ -6,11 +6,15 @@
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_primitive_cache.hpp"
 #include "mkldnn_itt.h"
+#include "utils/numa_memory.hpp"
+#include "utils/serialize.hpp"
 
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
 #include <vector>
 #include <tuple>
 #include <unordered_set>
@@ -83,11 +87,15 @@
 #include <low_precision/multiply_to_group_convolution.hpp>
 #include <low_precision/network_helper.hpp>
 
+#include <snippets/pass/collapse_subgraph.hpp>
+
 #include <ie_algorithm.hpp>
 
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
+#include "nodes/mkldnn_snippet_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/inline_snippets.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -367,6 +375,18 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     postLPTPassManager.run_passes(nGraphFunc);
 
     ConvertToCPUSpecificOpset(nGraphFunc);
+
+    if (conf.snippetsTokenization && with_cpu_x86_avx2()) {
+        ngraph::pass::Manager snippetsManager;
+        snippetsManager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
+        // the subgraphs which can't be executed by the snippet node are turned back to the plain operations
+        snippetsManager.register_pass<MKLDNNPlugin::InlineSnippets>();
+        snippetsManager.get_pass_config()->set_callback<MKLDNNPlugin::InlineSnippets>([](const_node_ptr &node) -> bool {
+            std::string errorMessage;
+            return MKLDNNSnippetNode::isSupportedOperation(node, errorMessage);
+        });
+        snippetsManager.run_passes(nGraphFunc);
+    }
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr
@@ -398,20 +418,90 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     Config conf = engConfig;
     conf.readProperties(config);
 
+    // primitive cache is shared by all the networks, so its capacity is changed only if it is requested explicitly
+    if (config.count(CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY)) {
+        MKLDNNPrimitiveCache::getInstance().setCapacity(conf.primitiveCacheCapacity);
+    }
+
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
     CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
 
+    // Runtime reshape requires the network before transformations since plugin specific operations can't be reshaped.
+    // The model cache may need it as well, see below.
+    const bool runtimeReshape = conf.runtimeReshapeCacheSize > 0 && !conf.enableDynamicBatch;
+    std::shared_ptr<CNNNetwork> originalNetwork;
+    if (runtimeReshape || !conf.cacheDir.empty()) {
+        // constants are shared between the clones, so the copy of the network before transformations is cheap
+        originalNetwork = std::make_shared<CNNNetwork>(InferenceEngine::details::cloneNetwork(network));
+    }
+
+    MKLDNNExecNetwork::NetworkReshaper reshaper;
+    if (runtimeReshape) {
+        reshaper = [originalNetwork, conf] (const ICNNNetwork::InputShapes& shapes) {
+            CNNNetwork reshapedNetwork = InferenceEngine::details::cloneNetwork(*originalNetwork);
+            reshapedNetwork.reshape(shapes);
+            Transformation(reshapedNetwork, conf);
+            return reshapedNetwork;
+        };
+    }
+
     Transformation(clonedNetwork, conf);
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    // The transformed network is exported to the model cache if it can be read back as is, so import skips
+    // transformations. Otherwise the original network is exported and transformed again on import.
+    if (originalNetwork && !reshaper &&
+        CNNNetworkSerializer::canSerialize(clonedNetwork.getFunction(), extensionManager->Extensions())) {
+        originalNetwork.reset();
+    }
+
+    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing, reshaper, originalNetwork);
+}
+
+InferenceEngine::IExecutableNetworkInternal::Ptr
+Engine::ImportNetwork(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetwork");
+
+    CNNNetworkDeserializer deserializer(networkModel,
+        [this](const std::string& model, const Blob::CPtr& weights) {
+            return GetCore()->ReadNetwork(model, weights, extensionManager->Extensions());
+        });
+
+    bool transformed = false;
+    CNNNetwork network = deserializer.read(transformed);
+
+    InferenceEngine::IExecutableNetworkInternal::Ptr execNetwork;
+    if (!transformed) {
+        // the network is transformed as usual, e.g. low precision networks or networks with runtime reshape
+        execNetwork = LoadExeNetworkImpl(network, config);
+    } else {
+        Config conf = engConfig;
+        conf.readProperties(config);
+
+        if (config.count(CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY)) {
+            MKLDNNPrimitiveCache::getInstance().setCapacity(conf.primitiveCacheCapacity);
+        }
+
+        if (conf.enableDynamicBatch) {
+            conf.batchLimit = static_cast<int>(network.getBatchSize());
+        }
+
+        execNetwork = std::make_shared<MKLDNNExecNetwork>(network, conf, extensionManager, weightsSharing);
+    }
+
+    SetExeNetworkInfo(execNetwork, constMapCast(network.getInputsInfo()), constMapCast(network.getOutputsInfo()));
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
+
+    if (config.count(CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY)) {
+        MKLDNNPrimitiveCache::getInstance().setCapacity(engConfig.primitiveCacheCapacity);
+    }
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
@@ -449,6 +539,11 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
+        metrics.push_back(CPU_METRIC_KEY(PRIMITIVE_CACHE_HITS));
+        metrics.push_back(CPU_METRIC_KEY(PRIMITIVE_CACHE_MISSES));
+        metrics.push_back(CPU_METRIC_KEY(PRIMITIVE_CACHE_SIZE));
+        metrics.push_back(CPU_METRIC_KEY(NUMA_NODES_BOUND_BYTES));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -495,6 +590,16 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
+    } else if (name == CPU_METRIC_KEY(PRIMITIVE_CACHE_HITS)) {
+        IE_SET_METRIC_RETURN(CPU_PRIMITIVE_CACHE_HITS, MKLDNNPrimitiveCache::getInstance().getHits());
+    } else if (name == CPU_METRIC_KEY(PRIMITIVE_CACHE_MISSES)) {
+        IE_SET_METRIC_RETURN(CPU_PRIMITIVE_CACHE_MISSES, MKLDNNPrimitiveCache::getInstance().getMisses());
+    } else if (name == CPU_METRIC_KEY(PRIMITIVE_CACHE_SIZE)) {
+        IE_SET_METRIC_RETURN(CPU_PRIMITIVE_CACHE_SIZE, static_cast<uint64_t>(MKLDNNPrimitiveCache::getInstance().getSize()));
+    } else if (name == CPU_METRIC_KEY(NUMA_NODES_BOUND_BYTES)) {
+        IE_SET_METRIC_RETURN(CPU_NUMA_NODES_BOUND_BYTES, NumaMemoryBinding::getBoundBytes());
     } else {
         IE_THROW() << "Unsupported metric key " << name;
     }
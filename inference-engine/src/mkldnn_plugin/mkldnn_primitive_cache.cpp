@@ -0,0 +1,167 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_primitive_cache.hpp"
+
+#include <ie_common.h>
+
+#include <string>
+#include <vector>
+#include <utility>
+
+using namespace MKLDNNPlugin;
+
+constexpr size_t MKLDNNPrimitiveCache::defaultCapacity;
+
+namespace {
+
+template <typename T>
+void appendBytes(std::string& key, const T& value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void appendBytes(std::string& key, const void* data, size_t size) {
+    key.append(reinterpret_cast<const char*>(data), size);
+}
+
+bool appendOpDesc(std::string& key, const_dnnl_primitive_desc_t pd, dnnl_primitive_kind_t kind) {
+    dnnl_query_t query;
+    size_t size;
+    switch (kind) {
+        case dnnl_convolution:
+            query = dnnl_query_convolution_d; size = sizeof(dnnl_convolution_desc_t); break;
+        case dnnl_deconvolution:
+            query = dnnl_query_deconvolution_d; size = sizeof(dnnl_deconvolution_desc_t); break;
+        case dnnl_inner_product:
+            query = dnnl_query_inner_product_d; size = sizeof(dnnl_inner_product_desc_t); break;
+        case dnnl_pooling:
+            query = dnnl_query_pooling_d; size = sizeof(dnnl_pooling_desc_t); break;
+        case dnnl_softmax:
+            query = dnnl_query_softmax_d; size = sizeof(dnnl_softmax_desc_t); break;
+        case dnnl_lrn:
+            query = dnnl_query_lrn_d; size = sizeof(dnnl_lrn_desc_t); break;
+        default:
+            return false;
+    }
+
+    const_dnnl_op_desc_t opDesc = nullptr;
+    if (dnnl_primitive_desc_query(pd, query, 0, &opDesc) != dnnl_success || opDesc == nullptr)
+        return false;
+    // operation descriptors are zero-initialized by oneDNN, so they can be compared bytewise
+    appendBytes(key, opDesc, size);
+    return true;
+}
+
+bool appendAttr(std::string& key, const mkldnn::primitive_attr& attr) {
+    // cached primitive may be executed by several streams at once, so it can't use own scratchpad
+    if (attr.get_scratchpad_mode() != mkldnn::scratchpad_mode::user)
+        return false;
+
+    int mask = 0;
+    std::vector<float> scales;
+    attr.get_output_scales(mask, scales);
+    appendBytes(key, mask);
+    appendBytes(key, scales.size());
+    appendBytes(key, scales.data(), scales.size() * sizeof(float));
+
+    const auto postOps = attr.get_post_ops();
+    appendBytes(key, postOps.len());
+    for (int i = 0; i < postOps.len(); i++) {
+        // other post ops either refer to external data or don't expose all their parameters (e.g. sum data type)
+        if (postOps.kind(i) != mkldnn::primitive::kind::eltwise)
+            return false;
+
+        float scale, alpha, beta;
+        mkldnn::algorithm alg;
+        postOps.get_params_eltwise(i, scale, alg, alpha, beta);
+        appendBytes(key, scale);
+        appendBytes(key, alg);
+        appendBytes(key, alpha);
+        appendBytes(key, beta);
+    }
+    return true;
+}
+
+}  // namespace
+
+MKLDNNPrimitiveCache& MKLDNNPrimitiveCache::getInstance() {
+    static MKLDNNPrimitiveCache cache;
+    return cache;
+}
+
+bool MKLDNNPrimitiveCache::makeKey(const mkldnn::primitive_desc_base& pd, std::string& key) {
+    dnnl_primitive_kind_t kind;
+    if (dnnl_primitive_desc_query(pd.get(), dnnl_query_primitive_kind, 0, &kind) != dnnl_success)
+        return false;
+    appendBytes(key, kind);
+
+    // reorder has no operation descriptor, it is fully defined by its memory descriptors
+    if (kind != dnnl_reorder && !appendOpDesc(key, pd.get(), kind))
+        return false;
+
+    // memory descriptors chosen by the implementation (operation descriptor may have 'any' formats)
+    for (const auto& md : {pd.src_desc(), pd.diff_src_desc(), pd.weights_desc(), pd.dst_desc(), pd.diff_dst_desc()})
+        appendBytes(key, md.data);
+
+    // the implementation name defines ISA the kernel is generated for
+    key += pd.impl_info_str();
+    key += '\0';
+
+    return appendAttr(key, pd.get_primitive_attr());
+}
+
+MKLDNNPrimitiveCache::PrimitivePtr MKLDNNPrimitiveCache::getOrCreate(const mkldnn::primitive_desc_base& pd, const Creator& create, bool cacheable) {
+    std::string key;
+    if (!cacheable || getCapacity() == 0 || !makeKey(pd, key))
+        return create();
+
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        auto found = _entries.find(key);
+        if (found != _entries.end()) {
+            _lru.splice(_lru.begin(), _lru, found->second);
+            _hits++;
+            return found->second->second;
+        }
+    }
+
+    // JIT compilation is done without the lock, so concurrently created duplicate is dropped below
+    auto primitive = create();
+    _misses++;
+
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto found = _entries.find(key);
+    if (found != _entries.end()) {
+        _lru.splice(_lru.begin(), _lru, found->second);
+        return found->second->second;
+    }
+    _lru.emplace_front(key, primitive);
+    _entries.emplace(std::move(key), _lru.begin());
+    evict();
+    return primitive;
+}
+
+void MKLDNNPrimitiveCache::evict() {
+    // primitives which are still used by graphs are kept alive by them
+    while (_lru.size() > _capacity) {
+        _entries.erase(_lru.back().first);
+        _lru.pop_back();
+    }
+}
+
+void MKLDNNPrimitiveCache::setCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _capacity = capacity;
+    evict();
+}
+
+size_t MKLDNNPrimitiveCache::getCapacity() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _capacity;
+}
+
+size_t MKLDNNPrimitiveCache::getSize() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _lru.size();
+}
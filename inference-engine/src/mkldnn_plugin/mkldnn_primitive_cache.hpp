@@ -0,0 +1,77 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn.hpp>
+
+#include <unordered_map>
+#include <functional>
+#include <string>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <list>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Process-wide LRU cache of created primitives
+ * Will return a cached primitive or create new one (with JIT compilation of the kernel)
+ *
+ * Primitives are matched by primitive kind, operation descriptor, implementation name and attributes.
+ * Primitives with attributes which are not comparable by value (e.g. post ops referring to external
+ * data or zero points) are created as is and are not stored in the cache.
+ * Cached primitives are executed concurrently by different graphs and streams, so only primitives created
+ * with user scratchpad mode are stored (the scratchpad is passed by the node, see MKLDNNNode::appendScratchpad).
+ *
+ * Is a thread safe
+ */
+class MKLDNNPrimitiveCache {
+public:
+    using PrimitivePtr = std::shared_ptr<mkldnn::primitive>;
+    using Creator = std::function<PrimitivePtr()>;
+
+    static constexpr size_t defaultCapacity = 1024;
+
+    static MKLDNNPrimitiveCache& getInstance();
+
+    /**
+     * @brief Returns a primitive for given primitive descriptor from the cache or creates it
+     * @param pd primitive descriptor the primitive is created for
+     * @param create creates primitive if it was not found in the cache
+     * @param cacheable false if the primitive attributes have settings which can't be compared by value
+     */
+    PrimitivePtr getOrCreate(const mkldnn::primitive_desc_base& pd, const Creator& create, bool cacheable = true);
+
+    template <typename Primitive, typename PrimitiveDesc>
+    PrimitivePtr getOrCreate(const PrimitiveDesc& pd, bool cacheable = true) {
+        return getOrCreate(pd, [&pd] { return std::make_shared<Primitive>(pd); }, cacheable);
+    }
+
+    void setCapacity(size_t capacity);
+    size_t getCapacity() const;
+    size_t getSize() const;
+
+    uint64_t getHits() const { return _hits; }
+    uint64_t getMisses() const { return _misses; }
+
+private:
+    MKLDNNPrimitiveCache() = default;
+
+    static bool makeKey(const mkldnn::primitive_desc_base& pd, std::string& key);
+    void evict();
+
+    using Entry = std::pair<std::string, PrimitivePtr>;
+
+    mutable std::mutex _mutex;
+    size_t _capacity = defaultCapacity;
+    // most recently used primitive goes first
+    std::list<Entry> _lru;
+    std::unordered_map<std::string, std::list<Entry>::iterator> _entries;
+    std::atomic<uint64_t> _hits = {0};
+    std::atomic<uint64_t> _misses = {0};
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,52 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "inline_snippets.hpp"
+#include <map>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <snippets/op/subgraph.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::InlineSnippets, "InlineSnippets", 0);
+
+MKLDNNPlugin::InlineSnippets::InlineSnippets() {
+    auto subgraph = ngraph::pattern::wrap_type<ngraph::snippets::op::Subgraph>();
+
+    ngraph::matcher_pass_callback callback = [this](ngraph::pattern::Matcher &m) {
+        auto snippet = std::dynamic_pointer_cast<ngraph::snippets::op::Subgraph>(m.get_match_root());
+        if (!snippet || transformation_callback(snippet))
+            return false;
+
+        const auto body = snippet->get_body();
+        // outputs of the body are mapped to the outputs of the operations inserted to the outer graph
+        std::map<ngraph::Output<ngraph::Node>, ngraph::Output<ngraph::Node>> outerOutputs;
+        const auto& parameters = body->get_parameters();
+        for (size_t i = 0; i < parameters.size(); i++) {
+            outerOutputs[parameters[i]->output(0)] = snippet->input_value(i);
+        }
+        for (const auto& op : body->get_ordered_ops()) {
+            if (ngraph::is_type<ngraph::opset1::Parameter>(op) || ngraph::is_type<ngraph::opset1::Result>(op))
+                continue;
+            ngraph::OutputVector inputs;
+            for (const auto& input : op->input_values()) {
+                inputs.push_back(outerOutputs.at(input));
+            }
+            auto outerOp = op->clone_with_new_inputs(inputs);
+            outerOp->set_friendly_name(op->get_friendly_name());
+            ngraph::copy_runtime_info(op, outerOp);
+            for (size_t i = 0; i < op->get_output_size(); i++) {
+                outerOutputs[op->output(i)] = outerOp->output(i);
+            }
+        }
+        const auto& results = body->get_results();
+        for (size_t i = 0; i < results.size(); i++) {
+            snippet->output(i).replace(outerOutputs.at(results[i]->input_value(0)));
+        }
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(subgraph, "InlineSnippets");
+    this->register_matcher(m, callback);
+}
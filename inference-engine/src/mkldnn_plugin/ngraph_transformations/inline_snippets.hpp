@@ -0,0 +1,21 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Replaces the snippets Subgraph with the operations of its body. The subgraphs for which the transformation
+ * callback returns true are kept, so the callback tells which subgraphs are supported by the snippet node.
+ */
+class InlineSnippets : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    InlineSnippets();
+};
+
+}  // namespace MKLDNNPlugin
@@ -41,5 +41,7 @@ void MKLDNNPlugin::FullyConnectedNode::validate_and_infer_types() {
 
 bool MKLDNNPlugin::FullyConnectedNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
     visitor.on_attribute("out-size", m_output_size);
+    visitor.on_attribute("out-shape", m_output_shape);
+    visitor.on_attribute("out-type", m_output_type);
     return true;
 }
@@ -27,5 +27,6 @@ void MKLDNNPlugin::LeakyReluNode::validate_and_infer_types() {
 
 bool MKLDNNPlugin::LeakyReluNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
     visitor.on_attribute("negative_slope", m_negative_slope);
+    visitor.on_attribute("out-type", m_output_type);
     return true;
 }
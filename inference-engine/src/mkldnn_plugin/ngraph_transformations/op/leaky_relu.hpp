@@ -13,6 +13,8 @@ public:
     static constexpr ngraph::NodeTypeInfo type_info{"LeakyRelu", 0};
     const ngraph::NodeTypeInfo& get_type_info() const override { return type_info; }
 
+    LeakyReluNode() = default;
+
     LeakyReluNode(const ngraph::Output<ngraph::Node> &data, const float &negative_slope, const ngraph::element::Type output_type);
 
     void validate_and_infer_types() override;
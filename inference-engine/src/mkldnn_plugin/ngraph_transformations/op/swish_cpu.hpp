@@ -13,6 +13,8 @@ public:
     static constexpr ngraph::NodeTypeInfo type_info{"SwishCPU", 0};
     const ngraph::NodeTypeInfo &get_type_info() const override { return type_info; }
 
+    SwishNode() = default;
+
     explicit SwishNode(const ngraph::Output<Node> &input, float alpha = 1.0);
 
     void validate_and_infer_types() override;
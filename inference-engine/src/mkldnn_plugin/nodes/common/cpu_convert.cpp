@@ -5,27 +5,335 @@
 #include "cpu_convert.h"
 #include "cpu_memcpy.h"
 #include "utils/bfloat16.hpp"
+#include "emitters/jit_load_store_emitters.hpp"
 #include <mkldnn_selective_build.h>
+#include <precision_utils.h>
+#include <ngraph/type/float16.hpp>
+#include <cpu/x64/jit_generator.hpp>
 #include <type_traits>
 #include <tuple>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
 #include <ie_parallel.hpp>
 
 using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
 
 namespace {
 
-template<typename srcType, typename dstType>
-void convert(const void *srcPtr, void *dstPtr, const size_t size) {
-    if (std::is_same<srcType, dstType>::value) {
-        cpu_memcpy(dstPtr, srcPtr, size*sizeof(dstType));
-    } else {
-        const srcType *srcData = reinterpret_cast<const srcType *>(srcPtr);
-        dstType *dstData = reinterpret_cast<dstType *>(dstPtr);
+#define GET_OFF(field) offsetof(jit_convert_call_args, field)
 
-        parallel_for(size, [&](size_t i) {
-            dstData[i] = static_cast<dstType>(srcData[i]);
-        });
+struct jit_convert_call_args {
+    const void *src;
+    void *dst;
+    size_t work_amount;
+};
+
+struct jit_convert_config_params {
+    Precision src_prc;
+    Precision dst_prc;
+};
+
+struct jit_uni_convert_kernel {
+    void (*ker_)(const jit_convert_call_args *);
+
+    void operator()(const jit_convert_call_args *args) {
+        assert(ker_);
+        ker_(args);
     }
+
+    explicit jit_uni_convert_kernel(jit_convert_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_convert_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_convert_config_params jcp_;
+};
+
+bool is_float_prc(const Precision& prc) {
+    return prc == Precision::FP32 || prc == Precision::FP16 || prc == Precision::BF16;
+}
+
+// Elements are loaded to FP32 lanes when either side is a floating point type, otherwise to I32 lanes.
+// Integer destinations are saturated, floating point sources are truncated towards zero (NaN gives the lowest value).
+template <cpu_isa_t isa>
+struct jit_uni_convert_kernel_f32 : public jit_uni_convert_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_convert_kernel_f32)
+
+    explicit jit_uni_convert_kernel_f32(jit_convert_config_params jcp) : jit_uni_convert_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        exec_prc = (is_float_prc(jcp_.src_prc) || is_float_prc(jcp_.dst_prc)) ? Precision::FP32 : Precision::I32;
+
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        if (exec_prc == Precision::FP32 && !is_float_prc(jcp_.dst_prc)) {
+            float lowest = 0.f, highest = 0.f;
+            switch (jcp_.dst_prc) {
+                case Precision::U8: lowest = std::numeric_limits<uint8_t>::lowest(); highest = std::numeric_limits<uint8_t>::max(); break;
+                case Precision::I8: lowest = std::numeric_limits<int8_t>::lowest(); highest = std::numeric_limits<int8_t>::max(); break;
+                case Precision::U16: lowest = std::numeric_limits<uint16_t>::lowest(); highest = std::numeric_limits<uint16_t>::max(); break;
+                case Precision::I16: lowest = std::numeric_limits<int16_t>::lowest(); highest = std::numeric_limits<int16_t>::max(); break;
+                // INT32_MAX is rounded up to 2^31 which is converted to 0x80000000 and fixed up after the conversion
+                case Precision::I32: lowest = std::numeric_limits<int32_t>::lowest(); highest = std::numeric_limits<int32_t>::max(); break;
+                default: IE_THROW() << "cpu_convert kernel has unsupported dst precision: " << jcp_.dst_prc;
+            }
+            mov(reg_tmp_32, float2int(lowest));
+            movq(xmm_tmp, reg_tmp_64);
+            uni_vbroadcastss(vmm_lowest, xmm_tmp);
+            mov(reg_tmp_32, float2int(highest));
+            movq(xmm_tmp, reg_tmp_64);
+            uni_vbroadcastss(vmm_highest, xmm_tmp);
+        }
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_zero.getIdx())};
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label main_loop_end_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, unroll * step);
+            jl(main_loop_end_label, T_NEAR);
+
+            for (int i = 0; i < unroll; i++)
+                load(get_vmm_val(i), i * step * jcp_.src_prc.size(), step);
+            for (int i = 0; i < unroll; i++)
+                convert(get_vmm_val(i));
+            for (int i = 0; i < unroll; i++)
+                store(get_vmm_val(i), i * step * jcp_.dst_prc.size(), step);
+
+            add(reg_src, unroll * step * jcp_.src_prc.size());
+            add(reg_dst, unroll * step * jcp_.dst_prc.size());
+            sub(reg_work_amount, unroll * step);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+        L(main_loop_end_label);
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(exit_label, T_NEAR);
+
+            load(get_vmm_val(0), 0, 1);
+            convert(get_vmm_val(0));
+            store(get_vmm_val(0), 0, 1);
+
+            add(reg_src, jcp_.src_prc.size());
+            add(reg_dst, jcp_.dst_prc.size());
+            sub(reg_work_amount, 1);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+        L(exit_label);
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        store_emitter->emit_data();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    static constexpr int unroll = 4;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    Precision exec_prc;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_tmp_64 = r11;
+    Xbyak::Reg32 reg_tmp_32 = r11d;
+    Xbyak::Reg64 reg_load_table = r12;
+    Xbyak::Reg64 reg_load_store_mask = r13;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_zero = Vmm(0);
+    Vmm vmm_lowest = Vmm(5);
+    Vmm vmm_highest = Vmm(6);
+    Vmm vmm_aux = Vmm(7);
+    Xbyak::Xmm xmm_tmp = Xbyak::Xmm(8);
+
+    Vmm get_vmm_val(int idx) {
+        return Vmm(1 + idx);
+    }
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    void load(const Vmm& vmm, int offset, int elt_num) {
+        if (jcp_.src_prc == Precision::FP16) {
+            if (elt_num == step) {
+                vcvtph2ps(vmm, ptr[reg_src + offset]);
+            } else {
+                movzx(reg_tmp_32, word[reg_src + offset]);
+                vmovd(Xbyak::Xmm(vmm.getIdx()), reg_tmp_32);
+                vcvtph2ps(Xbyak::Xmm(vmm.getIdx()), Xbyak::Xmm(vmm.getIdx()));
+            }
+            return;
+        }
+
+        load_emitter->emit_code({static_cast<size_t>(reg_src.getIdx())}, {static_cast<size_t>(vmm.getIdx())},
+            std::make_shared<load_emitter_context>(jcp_.src_prc, exec_prc, elt_num, offset),
+            {}, {load_pool_gpr_idxs});
+    }
+
+    void convert(const Vmm& vmm) {
+        if (exec_prc != Precision::FP32 || is_float_prc(jcp_.dst_prc))
+            return;
+
+        // maxps returns the second operand for NaN
+        uni_vmaxps(vmm, vmm, vmm_lowest);
+        uni_vminps(vmm, vmm, vmm_highest);
+        uni_vroundps(vmm, vmm, 3);  // truncate
+        if (jcp_.dst_prc == Precision::I32) {
+            // 2^31 is converted to 0x80000000, flip it to 0x7FFFFFFF using the sign of the source value
+            uni_vmovups(vmm_aux, vmm);
+            uni_vcvtps2dq(vmm, vmm);
+            if (isa == cpu::x64::avx512_common) {
+                vpandnd(vmm_aux, vmm_aux, vmm);
+                vpsrad(vmm_aux, vmm_aux, 31);
+                vpxord(vmm, vmm, vmm_aux);
+            } else if (isa == cpu::x64::avx2) {
+                vpandn(vmm_aux, vmm_aux, vmm);
+                vpsrad(vmm_aux, vmm_aux, 31);
+                vpxor(vmm, vmm, vmm_aux);
+            } else {
+                pandn(vmm_aux, vmm);
+                psrad(vmm_aux, 31);
+                pxor(vmm, vmm_aux);
+            }
+        } else {
+            uni_vcvtps2dq(vmm, vmm);
+        }
+    }
+
+    void store(const Vmm& vmm, int offset, int elt_num) {
+        if (jcp_.dst_prc == Precision::FP16) {
+            if (elt_num == step) {
+                vcvtps2ph(ptr[reg_dst + offset], vmm, 0);  // round to nearest even
+            } else {
+                vcvtps2ph(xmm_tmp, Xbyak::Xmm(vmm.getIdx()), 0);
+                vpextrw(ptr[reg_dst + offset], xmm_tmp, 0);
+            }
+            return;
+        }
+
+        // the values are already converted to I32 for the integer destinations
+        const auto store_prc = (exec_prc == Precision::FP32 && is_float_prc(jcp_.dst_prc)) ? Precision::FP32 : Precision::I32;
+        store_emitter->emit_code({static_cast<size_t>(vmm.getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+            std::make_shared<store_emitter_context>(store_prc, jcp_.dst_prc, elt_num, offset),
+            {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+    }
+};
+
+bool is_jit_supported(const Precision& prc) {
+    switch (prc) {
+        case Precision::U8:
+        case Precision::I8:
+        case Precision::U16:
+        case Precision::I16:
+        case Precision::I32:
+        case Precision::FP16:
+        case Precision::BF16:
+        case Precision::FP32:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::shared_ptr<jit_uni_convert_kernel> create_convert_kernel(const Precision& srcPrc, const Precision& dstPrc) {
+    if (!is_jit_supported(srcPrc) || !is_jit_supported(dstPrc))
+        return nullptr;
+
+    const bool with_f16 = srcPrc == Precision::FP16 || dstPrc == Precision::FP16;
+    if (with_f16 && !(mayiuse(cpu::x64::avx2) && mkldnn::impl::cpu::x64::cpu().has(Xbyak::util::Cpu::tF16C)))
+        return nullptr;
+    // FP32 -> BF16 store is implemented for AVX512 only
+    if (dstPrc == Precision::BF16 && !mayiuse(cpu::x64::avx512_core))
+        return nullptr;
+
+    const jit_convert_config_params jcp = {srcPrc, dstPrc};
+    std::shared_ptr<jit_uni_convert_kernel> kernel;
+    if (mayiuse(cpu::x64::avx512_common)) {
+        kernel.reset(new jit_uni_convert_kernel_f32<cpu::x64::avx512_common>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        kernel.reset(new jit_uni_convert_kernel_f32<cpu::x64::avx2>(jcp));
+    } else if (mayiuse(cpu::x64::sse41)) {
+        kernel.reset(new jit_uni_convert_kernel_f32<cpu::x64::sse41>(jcp));
+    }
+
+    if (kernel)
+        kernel->create_ker();
+
+    return kernel;
+}
+
+// kernels are generated once per precision pair and shared by all callers
+std::shared_ptr<jit_uni_convert_kernel> get_convert_kernel(const Precision& srcPrc, const Precision& dstPrc) {
+    static std::mutex mutex;
+    static std::unordered_map<uint64_t, std::shared_ptr<jit_uni_convert_kernel>> kernels;
+
+    const uint64_t key = (static_cast<uint64_t>(static_cast<Precision::ePrecision>(srcPrc)) << 32) |
+                         static_cast<uint64_t>(static_cast<Precision::ePrecision>(dstPrc));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = kernels.find(key);
+    if (found == kernels.end()) {
+        found = kernels.emplace(key, create_convert_kernel(srcPrc, dstPrc)).first;
+    }
+    return found->second;
+}
+
+// Elements are split between threads in blocks which are big enough to amortize the threading overhead
+constexpr size_t convert_block_size = 16 * 1024;
+
+template <typename F>
+void parallel_blocks(const size_t size, const F& func) {
+    const size_t blocks = div_up(size, convert_block_size);
+    const int nthr = static_cast<int>(std::min<size_t>(blocks, parallel_get_max_threads()));
+
+    parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(blocks, nthr, ithr, start, end);
+        start *= convert_block_size;
+        end = std::min(end * convert_block_size, size);
+        if (start < end)
+            func(start, end);
+    });
 }
 
 template <Precision::ePrecision p>
@@ -38,6 +346,71 @@ struct PrecisionInfo<Precision::BF16> {
     using value_type = MKLDNNPlugin::bfloat16_t;
 };
 
+template <>
+struct PrecisionInfo<Precision::FP16> {
+    using value_type = ngraph::float16;
+};
+
+template <>
+struct PrecisionInfo<Precision::BOOL> {
+    using value_type = bool;
+};
+
+template <typename T>
+struct is_floating : std::integral_constant<bool, std::is_floating_point<T>::value ||
+                                                  std::is_same<T, MKLDNNPlugin::bfloat16_t>::value ||
+                                                  std::is_same<T, ngraph::float16>::value> {};
+
+template <typename dstType, typename srcType,
+          typename std::enable_if<std::is_same<dstType, bool>::value, int>::type = 0>
+inline uint8_t convert_value(srcType value) {
+    return static_cast<float>(value) != 0.f ? 1 : 0;
+}
+
+template <typename dstType, typename srcType,
+          typename std::enable_if<is_floating<dstType>::value, int>::type = 0>
+inline dstType convert_value(srcType value) {
+    return static_cast<dstType>(static_cast<float>(value));
+}
+
+template <typename dstType, typename srcType,
+          typename std::enable_if<std::is_integral<dstType>::value && !std::is_same<dstType, bool>::value &&
+                                  is_floating<srcType>::value, int>::type = 0>
+inline dstType convert_value(srcType value) {
+    const float f = static_cast<float>(value);
+    if (std::isnan(f) || f <= static_cast<float>(std::numeric_limits<dstType>::lowest()))
+        return std::numeric_limits<dstType>::lowest();
+    if (f >= static_cast<float>(std::numeric_limits<dstType>::max()))
+        return std::numeric_limits<dstType>::max();
+    return static_cast<dstType>(f);
+}
+
+template <typename dstType, typename srcType,
+          typename std::enable_if<std::is_integral<dstType>::value && !std::is_same<dstType, bool>::value &&
+                                  std::is_integral<srcType>::value, int>::type = 0>
+inline dstType convert_value(srcType value) {
+    using src_t = typename std::conditional<std::is_same<srcType, bool>::value, uint8_t, srcType>::type;
+    return PrecisionUtils::saturate_cast<dstType>(static_cast<src_t>(value));
+}
+
+template<typename srcType, typename dstType>
+void convert(const void *srcPtr, void *dstPtr, const size_t size) {
+    if (std::is_same<srcType, dstType>::value) {
+        cpu_memcpy(dstPtr, srcPtr, size*sizeof(dstType));
+    } else {
+        using src_storage_t = typename std::conditional<std::is_same<srcType, bool>::value, uint8_t, srcType>::type;
+        using dst_storage_t = typename std::conditional<std::is_same<dstType, bool>::value, uint8_t, dstType>::type;
+
+        const src_storage_t *srcData = reinterpret_cast<const src_storage_t *>(srcPtr);
+        dst_storage_t *dstData = reinterpret_cast<dst_storage_t *>(dstPtr);
+
+        parallel_blocks(size, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++)
+                dstData[i] = convert_value<dstType>(srcData[i]);
+        });
+    }
+}
+
 struct ConvertContext {
     const void *srcPtr;
     void *dstPtr;
@@ -71,39 +444,66 @@ void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision d
         return;
     }
 
+    if (auto kernel = get_convert_kernel(srcPrc, dstPrc)) {
+        const auto srcData = reinterpret_cast<const uint8_t *>(srcPtr);
+        const auto dstData = reinterpret_cast<uint8_t *>(dstPtr);
+        parallel_blocks(size, [&](size_t start, size_t end) {
+            jit_convert_call_args args;
+            args.src = srcData + start * srcPrc.size();
+            args.dst = dstData + start * dstPrc.size();
+            args.work_amount = end - start;
+            (*kernel)(&args);
+        });
+        return;
+    }
+
     ConvertContext ctx = { srcPtr, dstPtr, size, false };
 
     OV_SWITCH(MKLDNNPlugin, ConvertPrecision, ctx, std::tie(srcPrc, dstPrc),
     MKLDNN_CVT(U8, I8),    MKLDNN_CVT(U8, U16),    MKLDNN_CVT(U8, I16),
     MKLDNN_CVT(U8, I32),   MKLDNN_CVT(U8, U64),    MKLDNN_CVT(U8, I64),
-    MKLDNN_CVT(U8, FP32),  MKLDNN_CVT(U8, BF16),   MKLDNN_CVT(U8, BOOL),
+    MKLDNN_CVT(U8, FP32),  MKLDNN_CVT(U8, FP16),   MKLDNN_CVT(U8, BF16),
+    MKLDNN_CVT(U8, BOOL),
     MKLDNN_CVT(I8, U8),    MKLDNN_CVT(I8, U16),    MKLDNN_CVT(I8, I16),
     MKLDNN_CVT(I8, I32),   MKLDNN_CVT(I8, U64),    MKLDNN_CVT(I8, I64),
-    MKLDNN_CVT(I8, FP32),  MKLDNN_CVT(I8, BF16),   MKLDNN_CVT(I8, BOOL),
+    MKLDNN_CVT(I8, FP32),  MKLDNN_CVT(I8, FP16),   MKLDNN_CVT(I8, BF16),
+    MKLDNN_CVT(I8, BOOL),
     MKLDNN_CVT(U16, U8),   MKLDNN_CVT(U16, I8),    MKLDNN_CVT(U16, I16),
     MKLDNN_CVT(U16, I32),  MKLDNN_CVT(U16, U64),   MKLDNN_CVT(U16, I64),
-    MKLDNN_CVT(U16, FP32), MKLDNN_CVT(U16, BF16),  MKLDNN_CVT(U16, BOOL),
+    MKLDNN_CVT(U16, FP32), MKLDNN_CVT(U16, FP16),  MKLDNN_CVT(U16, BF16),
+    MKLDNN_CVT(U16, BOOL),
     MKLDNN_CVT(I16, U8),   MKLDNN_CVT(I16, I8),    MKLDNN_CVT(I16, U16),
     MKLDNN_CVT(I16, I32),  MKLDNN_CVT(I16, U64),   MKLDNN_CVT(I16, I64),
-    MKLDNN_CVT(I16, FP32), MKLDNN_CVT(I16, BF16),  MKLDNN_CVT(I16, BOOL),
+    MKLDNN_CVT(I16, FP32), MKLDNN_CVT(I16, FP16),  MKLDNN_CVT(I16, BF16),
+    MKLDNN_CVT(I16, BOOL),
     MKLDNN_CVT(I32, U8),   MKLDNN_CVT(I32, I8),    MKLDNN_CVT(I32, U16),
     MKLDNN_CVT(I32, I16),  MKLDNN_CVT(I32, U64),   MKLDNN_CVT(I32, I64),
-    MKLDNN_CVT(I32, FP32), MKLDNN_CVT(I32, BF16),  MKLDNN_CVT(I32, BOOL),
+    MKLDNN_CVT(I32, FP32), MKLDNN_CVT(I32, FP16),  MKLDNN_CVT(I32, BF16),
+    MKLDNN_CVT(I32, BOOL),
     MKLDNN_CVT(U64, U8),   MKLDNN_CVT(U64, I8),    MKLDNN_CVT(U64, U16),
     MKLDNN_CVT(U64, I16),  MKLDNN_CVT(U64, I32),   MKLDNN_CVT(U64, I64),
-    MKLDNN_CVT(U64, FP32), MKLDNN_CVT(U64, BF16),  MKLDNN_CVT(U64, BOOL),
+    MKLDNN_CVT(U64, FP32), MKLDNN_CVT(U64, FP16),  MKLDNN_CVT(U64, BF16),
+    MKLDNN_CVT(U64, BOOL),
     MKLDNN_CVT(I64, U8),   MKLDNN_CVT(I64, I8),    MKLDNN_CVT(I64, U16),
     MKLDNN_CVT(I64, I16),  MKLDNN_CVT(I64, I32),   MKLDNN_CVT(I64, U64),
-    MKLDNN_CVT(I64, FP32), MKLDNN_CVT(I64, BF16),  MKLDNN_CVT(I64, BOOL),
+    MKLDNN_CVT(I64, FP32), MKLDNN_CVT(I64, FP16),  MKLDNN_CVT(I64, BF16),
+    MKLDNN_CVT(I64, BOOL),
     MKLDNN_CVT(FP32, U8),  MKLDNN_CVT(FP32, I8),   MKLDNN_CVT(FP32, U16),
     MKLDNN_CVT(FP32, I16), MKLDNN_CVT(FP32, I32),  MKLDNN_CVT(FP32, U64),
-    MKLDNN_CVT(FP32, I64), MKLDNN_CVT(FP32, BF16), MKLDNN_CVT(FP32, BOOL),
+    MKLDNN_CVT(FP32, I64), MKLDNN_CVT(FP32, FP16), MKLDNN_CVT(FP32, BF16),
+    MKLDNN_CVT(FP32, BOOL),
+    MKLDNN_CVT(FP16, U8),  MKLDNN_CVT(FP16, I8),   MKLDNN_CVT(FP16, U16),
+    MKLDNN_CVT(FP16, I16), MKLDNN_CVT(FP16, I32),  MKLDNN_CVT(FP16, U64),
+    MKLDNN_CVT(FP16, I64), MKLDNN_CVT(FP16, FP32), MKLDNN_CVT(FP16, BF16),
+    MKLDNN_CVT(FP16, BOOL),
     MKLDNN_CVT(BF16, U8),  MKLDNN_CVT(BF16, I8),   MKLDNN_CVT(BF16, U16),
     MKLDNN_CVT(BF16, I16), MKLDNN_CVT(BF16, I32),  MKLDNN_CVT(BF16, U64),
-    MKLDNN_CVT(BF16, I64), MKLDNN_CVT(BF16, FP32), MKLDNN_CVT(BF16, BOOL),
+    MKLDNN_CVT(BF16, I64), MKLDNN_CVT(BF16, FP32), MKLDNN_CVT(BF16, FP16),
+    MKLDNN_CVT(BF16, BOOL),
     MKLDNN_CVT(BOOL, U8),  MKLDNN_CVT(BOOL, I8),   MKLDNN_CVT(BOOL, U16),
     MKLDNN_CVT(BOOL, I16), MKLDNN_CVT(BOOL, I32),  MKLDNN_CVT(BOOL, U64),
-    MKLDNN_CVT(BOOL, I64), MKLDNN_CVT(BOOL, FP32), MKLDNN_CVT(BOOL, BF16));
+    MKLDNN_CVT(BOOL, I64), MKLDNN_CVT(BOOL, FP32), MKLDNN_CVT(BOOL, FP16),
+    MKLDNN_CVT(BOOL, BF16));
 
     if (!ctx.converted)
         IE_THROW() << "cpu_convert can't convert from: " << srcPrc << " precision to: " << dstPrc;
@@ -7,6 +7,9 @@
 /**
  * @brief Copy size elements from buffer specified srcPtr pointer to buffer specified dstPtr.
  * If the precisions srcPrc and dstPrc are different, a conversion from srcPrc to dstPrc is performed.
+ * Integer destinations are saturated, floating point values are truncated towards zero and NaN is converted
+ * to the lowest value of the destination type. The conversions between U8, I8, U16, I16, I32, FP16, BF16 and
+ * FP32 are performed by JIT kernels when supported by the CPU. BOOL destination gets 1 for any non-zero value.
  * @param srcPtr
  * pointer to the buffer to convert from
  * @param dstPtr
@@ -4,6 +4,13 @@
 
 #include "nodes/list.hpp"
 
+#include "ngraph_transformations/op/fully_connected.hpp"
+#include "ngraph_transformations/op/leaky_relu.hpp"
+#include "ngraph_transformations/op/power_static.hpp"
+#include "ngraph_transformations/op/swish_cpu.hpp"
+#include <ngraph_ops/nms_ie_internal.hpp>
+#include <ngraph/opsets/opset.hpp>
+
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
@@ -25,6 +32,19 @@ MKLDNNExtensions::MKLDNNExtensions()
     #undef MKLDNN_EXTENSION_NODE
 }
 
+std::map<std::string, ngraph::OpSet> MKLDNNExtensions::getOpSets() {
+    static const ngraph::OpSet opset = [] {
+        ngraph::OpSet cpuOpset;
+        cpuOpset.insert<MKLDNNPlugin::FullyConnectedNode>();
+        cpuOpset.insert<MKLDNNPlugin::LeakyReluNode>();
+        cpuOpset.insert<MKLDNNPlugin::PowerStaticNode>();
+        cpuOpset.insert<MKLDNNPlugin::SwishNode>();
+        cpuOpset.insert<ngraph::op::internal::NonMaxSuppressionIEInternal>();
+        return cpuOpset;
+    }();
+    return {{"cpu_plugin_opset", opset}};
+}
+
 }  // namespace Cpu
 }  // namespace Extensions
 }  // namespace InferenceEngine
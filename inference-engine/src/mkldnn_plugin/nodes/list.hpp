@@ -83,6 +83,12 @@ public:
 
     void Unload() noexcept override {}
 
+    /**
+     * @brief Returns the opset of CPU plugin specific operations which can be present in the network after plugin
+     * transformations. It allows to serialize such networks to IR and read them back (e.g. for the model cache).
+     */
+    std::map<std::string, ngraph::OpSet> getOpSets() override;
+
     using LayersFactory = openvino::cc::Factory<
                                 std::string,
                                 InferenceEngine::ILayerImplFactory*(const std::shared_ptr<ngraph::Node>& op)>;
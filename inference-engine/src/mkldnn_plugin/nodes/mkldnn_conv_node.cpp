@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_conv_node.h"
+#include "mkldnn_primitive_cache.hpp"
 #include "mkldnn_reorder_node.h"
 #include "mkldnn_input_node.h"
 #include "mkldnn_eltwise_node.h"
@@ -487,11 +488,14 @@ void MKLDNNConvolutionNode::createPrimitive() {
     mkldnn::primitive_attr attr;
     addZeroPoints(attr);
     setPostOps(attr, true);
+    attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
 
     auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
             convolution_forward::desc>(attr);
 
-    prim.reset(new convolution_forward(prim_desc));
+    // zero points and compensations are not exposed by primitive attributes, so such primitives aren't cached
+    const bool cacheable = inputZeroPoints.empty() && weightsZeroPoints.empty() && outputCompensation.empty();
+    prim = MKLDNNPrimitiveCache::getInstance().getOrCreate<convolution_forward>(prim_desc, cacheable);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -499,6 +503,7 @@ void MKLDNNConvolutionNode::createPrimitive() {
         primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getWeights()}, {DNNL_ARG_BIAS, getBias()}, {DNNL_ARG_DST, dst}};
     else
         primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getWeights()}, {DNNL_ARG_DST, dst}};
+    appendScratchpad(prim_desc);
 }
 
 bool MKLDNNConvolutionNode::created() const {
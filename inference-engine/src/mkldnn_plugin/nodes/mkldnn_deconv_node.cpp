@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_deconv_node.h"
+#include "mkldnn_primitive_cache.hpp"
 #include "mkldnn_eltwise_node.h"
 #include "mkldnn_fake_quantize_node.h"
 #include "mkldnn_input_node.h"
@@ -318,25 +319,28 @@ void MKLDNNDeconvolutionNode::createPrimitive() {
     if (prim)
         return;
 
+    attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
     if (isInt8) {
         auto prim_desc = createPrimitiveDescriptor<deconvolution_forward::primitive_desc,
                 deconvolution_forward::desc>(attr);
 
-        prim.reset(new deconvolution_forward(prim_desc));
+        prim = MKLDNNPrimitiveCache::getInstance().getOrCreate<deconvolution_forward>(prim_desc);
 
         auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
         auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
         primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, internalBlobMemory[0]->GetPrimitive()}, {DNNL_ARG_DST, dst}};
+        appendScratchpad(prim_desc);
     } else {
         auto prim_desc = createPrimitiveDescriptor<convolution_backward_data::primitive_desc,
                 convolution_backward_data::desc, convolution_forward::primitive_desc>(attr);
 
-        prim.reset(new convolution_backward_data(prim_desc));
+        prim = MKLDNNPrimitiveCache::getInstance().getOrCreate<convolution_backward_data>(prim_desc);
 
         auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
         auto weights = getParentEdgeAt(1)->getMemory().GetPrimitive();
         auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
         primArgs = {{DNNL_ARG_DIFF_DST, src}, {DNNL_ARG_WEIGHTS, weights}, {DNNL_ARG_DIFF_SRC, dst}};
+        appendScratchpad(prim_desc);
     }
 }
 
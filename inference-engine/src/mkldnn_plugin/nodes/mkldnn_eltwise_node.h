@@ -78,6 +78,8 @@ public:
     float getBeta() const { return beta; }
     float getGamma() const { return gamma; }
     mkldnn::algorithm getMKLDNNAlgorithm() const { return mkldnnAlgorithm; }
+    const std::vector<float>& getScales() const { return scales; }
+    const std::vector<float>& getShifts() const { return shifts; }
 
     bool isWithBroadcast();
     bool isSpecialConvolutionAddFusing() const { return specialConvolutionAddFusing; }
@@ -3,6 +3,7 @@
 //
 
 #include <cmath>
+#include <limits>
 #include <vector>
 #include <string>
 #include <mkldnn_types.h>
@@ -10,9 +11,209 @@
 #include "mkldnn_embedding_bag_sum_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "emitters/jit_load_store_emitters.hpp"
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
+
+// Sums (optionally weighted) table rows of the bag into one output row. The row is processed by blocks of
+// unroll vectors: the block is accumulated in registers over all the bag indices and stored once, while
+// the same block of the next row of the bag is prefetched. Rows are loaded and stored as FP32 or BF16,
+// the accumulation is always done in FP32.
+template <cpu_isa_t isa>
+struct jit_uni_emb_bag_kernel_f32 : public jit_uni_emb_bag_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_emb_bag_kernel_f32)
+
+    explicit jit_uni_emb_bag_kernel_f32(jit_emb_bag_config_params jcp) : jit_uni_emb_bag_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_indices_num, ptr[reg_params + GET_OFF(indices_num)]);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_aux0.getIdx()), static_cast<size_t>(vmm_aux1.getIdx())};
+
+        const int prc_size = jcp_.prc.size();
+        const int block_size = unroll * step;
+        const int full_blocks_num = jcp_.emb_depth / block_size;
+        const int tail_size = jcp_.emb_depth % block_size;
+
+        xor_(reg_block_off, reg_block_off);
+
+        if (full_blocks_num > 0) {
+            Xbyak::Label block_loop_label;
+            L(block_loop_label);
+            {
+                accumulate_block(block_size);
+
+                add(reg_block_off, block_size * prc_size);
+                cmp(reg_block_off, full_blocks_num * block_size * prc_size);
+                jl(block_loop_label, T_NEAR);
+            }
+        }
+        if (tail_size > 0)
+            accumulate_block(tail_size);
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        store_emitter->emit_data();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    static constexpr int unroll = 4;
+    static constexpr int cache_line_size = 64;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_indices = r10;
+    Xbyak::Reg64 reg_weights = r11;
+    Xbyak::Reg64 reg_indices_num = r12;
+    Xbyak::Reg64 reg_load_table = r13;
+    Xbyak::Reg64 reg_load_store_mask = r14;
+    Xbyak::Reg64 reg_idx_ptr = r15;
+    Xbyak::Reg64 reg_weights_ptr = rax;
+    Xbyak::Reg64 reg_work_amount = rbx;
+    Xbyak::Reg64 reg_row = rdx;
+    Xbyak::Reg64 reg_aux = rsi;
+    Xbyak::Reg32 reg_aux_32 = esi;
+    Xbyak::Reg64 reg_block_off = rbp;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_weight = Vmm(8);
+    Xbyak::Xmm xmm_weight = Xbyak::Xmm(8);
+    Vmm vmm_aux0 = Vmm(9);
+    Vmm vmm_aux1 = Vmm(10);
+
+    Vmm get_vmm_acc(int idx) {
+        return Vmm(idx);
+    }
+
+    Vmm get_vmm_val(int idx) {
+        return Vmm(unroll + idx);
+    }
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    // address of the row pointed by the bag index at [reg_idx_ptr + idx_offset]
+    void calc_row_address(const Xbyak::Reg64& reg_addr, int idx_offset) {
+        movsxd(reg_addr, dword[reg_idx_ptr + idx_offset]);
+        imul(reg_addr, reg_addr, static_cast<int>(jcp_.emb_depth * jcp_.prc.size()));
+        add(reg_addr, reg_src);
+    }
+
+    void load_weight() {
+        if (jcp_.prc == Precision::BF16) {
+            movzx(reg_aux_32, word[reg_weights_ptr]);
+            shl(reg_aux_32, 16);
+            vmovd(xmm_weight, reg_aux_32);
+            vbroadcastss(vmm_weight, xmm_weight);
+        } else {
+            uni_vbroadcastss(vmm_weight, ptr[reg_weights_ptr]);
+        }
+    }
+
+    void accumulate_block(int elt_num) {
+        const int prc_size = jcp_.prc.size();
+        const int vec_num = div_up(elt_num, step);
+        const int lines_num = div_up(elt_num * prc_size, cache_line_size);
+
+        for (int i = 0; i < vec_num; i++)
+            uni_vpxor(get_vmm_acc(i), get_vmm_acc(i), get_vmm_acc(i));
+
+        mov(reg_idx_ptr, reg_indices);
+        mov(reg_weights_ptr, reg_weights);
+        mov(reg_work_amount, reg_indices_num);
+
+        Xbyak::Label idx_loop_label;
+        Xbyak::Label idx_loop_end_label;
+        Xbyak::Label prefetch_end_label;
+
+        L(idx_loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(idx_loop_end_label, T_NEAR);
+
+            calc_row_address(reg_row, 0);
+            add(reg_row, reg_block_off);
+
+            // rows are gathered at random, so the next one is requested while the current one is accumulated
+            cmp(reg_work_amount, 1);
+            jle(prefetch_end_label, T_NEAR);
+            calc_row_address(reg_aux, sizeof(int));
+            for (int i = 0; i < lines_num; i++)
+                prefetcht0(ptr[reg_aux + reg_block_off + i * cache_line_size]);
+            L(prefetch_end_label);
+
+            if (jcp_.with_weights)
+                load_weight();
+
+            for (int i = 0; i < vec_num; i++)
+                load(get_vmm_val(i), reg_row, i * step * prc_size, std::min(step, elt_num - i * step));
+            for (int i = 0; i < vec_num; i++) {
+                if (jcp_.with_weights)
+                    uni_vfmadd231ps(get_vmm_acc(i), get_vmm_val(i), vmm_weight);
+                else
+                    uni_vaddps(get_vmm_acc(i), get_vmm_acc(i), get_vmm_val(i));
+            }
+
+            add(reg_idx_ptr, sizeof(int));
+            if (jcp_.with_weights)
+                add(reg_weights_ptr, prc_size);
+            sub(reg_work_amount, 1);
+
+            jmp(idx_loop_label, T_NEAR);
+        }
+        L(idx_loop_end_label);
+
+        mov(reg_row, reg_dst);
+        add(reg_row, reg_block_off);
+        for (int i = 0; i < vec_num; i++)
+            store(get_vmm_acc(i), reg_row, i * step * prc_size, std::min(step, elt_num - i * step));
+    }
+
+    void load(const Vmm& vmm, const Xbyak::Reg64& reg_ptr, int offset, int elt_num) {
+        load_emitter->emit_code({static_cast<size_t>(reg_ptr.getIdx())}, {static_cast<size_t>(vmm.getIdx())},
+            std::make_shared<load_emitter_context>(jcp_.prc, Precision::FP32, elt_num, offset),
+            {}, {load_pool_gpr_idxs});
+    }
+
+    void store(const Vmm& vmm, const Xbyak::Reg64& reg_ptr, int offset, int elt_num) {
+        store_emitter->emit_code({static_cast<size_t>(vmm.getIdx())}, {static_cast<size_t>(reg_ptr.getIdx())},
+            std::make_shared<store_emitter_context>(Precision::FP32, jcp_.prc, elt_num, offset),
+            {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+    }
+};
 
 MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
             const std::shared_ptr<ngraph::Node>& op,
@@ -42,6 +243,43 @@ MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
     }
 }
 
+impl_desc_type MKLDNNEmbeddingBagSumNode::getImplType(const Precision& prc) const {
+    if (prc == Precision::FP32 || prc == Precision::BF16) {
+        if (mayiuse(cpu::x64::avx512_common)) {
+            return impl_desc_type::jit_avx512;
+        } else if (mayiuse(cpu::x64::avx2)) {
+            return impl_desc_type::jit_avx2;
+        } else if (mayiuse(cpu::x64::sse41)) {
+            return impl_desc_type::jit_sse42;
+        }
+    }
+    return impl_desc_type::ref_any;
+}
+
+void MKLDNNEmbeddingBagSumNode::createKernel(const Precision& prc) {
+    _kernel.reset();
+    if (getImplType(prc) == impl_desc_type::ref_any)
+        return;
+    // FP32 -> BF16 store is implemented for AVX512 only
+    if (prc == Precision::BF16 && !mayiuse(cpu::x64::avx512_core))
+        return;
+    // the row offset is computed with 32-bit immediate multiplier
+    if (_embDepth * prc.size() > static_cast<size_t>(std::numeric_limits<int>::max()))
+        return;
+
+    const jit_emb_bag_config_params jcp = {prc, _embDepth, _withWeights};
+    if (mayiuse(cpu::x64::avx512_common)) {
+        _kernel.reset(new jit_uni_emb_bag_kernel_f32<cpu::x64::avx512_common>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        _kernel.reset(new jit_uni_emb_bag_kernel_f32<cpu::x64::avx2>(jcp));
+    } else if (mayiuse(cpu::x64::sse41)) {
+        _kernel.reset(new jit_uni_emb_bag_kernel_f32<cpu::x64::sse41>(jcp));
+    }
+
+    if (_kernel)
+        _kernel->create_ker();
+}
+
 template<typename T>
 void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsData, T* dstData,
                                             const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc) {
@@ -115,8 +353,63 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
     parallel_nt(0, threadBody);
 }
 
+void MKLDNNEmbeddingBagSumNode::processDataJit(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                                               const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t embTableSize = srcDesc.getDims()[0];
+    const size_t outputBagsNum = dstDesc.getDims()[0];
+    const size_t dataSize = srcDesc.getPrecision().size();
+
+    // the default index is not weighted, so the kernel compiled with weights is given the unit weight for it
+    static const float fp32One = 1.f;
+    static const uint16_t bf16One = 0x3F80;
+    const void* unitWeight = srcDesc.getPrecision() == Precision::BF16 ? static_cast<const void*>(&bf16One) : &fp32One;
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(outputBagsNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+
+        auto args = jit_emb_bag_call_args();
+        args.src = srcData;
+
+        for (size_t obi = start; obi < end; obi++) {
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            if (indices == nullptr)
+                indicesSize = 0lu;
+
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (static_cast<size_t>(indices[inIdx]) >= embTableSize) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                }
+            }
+
+            args.dst = dstData + obi * _embDepth * dataSize;
+            args.indices = indices;
+            args.indices_num = indicesSize;
+            args.weights = (withWeights && _withWeights) ? weightsData + weightsIdx * dataSize : unitWeight;
+
+            (*_kernel)(&args);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
                                         const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc) {
+    if (_kernel)
+        return processDataJit(srcData, weightsData, dstData, srcDesc, dstDesc);
+
     switch (srcDesc.getPrecision()) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
@@ -9,9 +9,40 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <cassert>
 
 namespace MKLDNNPlugin {
 
+struct jit_emb_bag_config_params {
+    InferenceEngine::Precision prc;
+    size_t emb_depth;
+    bool with_weights;
+};
+
+struct jit_emb_bag_call_args {
+    const void *src;
+    void *dst;
+    const int *indices;
+    const void *weights;
+    size_t indices_num;
+};
+
+struct jit_uni_emb_bag_kernel {
+    void (*ker_)(const jit_emb_bag_call_args *);
+
+    void operator()(const jit_emb_bag_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_emb_bag_kernel(jit_emb_bag_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_emb_bag_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_emb_bag_config_params jcp_;
+};
+
 class MKLDNNEmbeddingBagSumNode {
 public:
     MKLDNNEmbeddingBagSumNode(
@@ -35,9 +66,15 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
+    // FP32 and BF16 tables are reduced by the JIT kernel, integer ones by the reference implementation
+    impl_desc_type getImplType(const InferenceEngine::Precision& prc) const;
+    void createKernel(const InferenceEngine::Precision& prc);
+
     template<typename T>
     void processData(const T* srcData, const T* weightsData, T* dstData,
                      const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc);
+    void processDataJit(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                        const InferenceEngine::TensorDesc& srcDesc, const InferenceEngine::TensorDesc& dstDesc);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -47,6 +84,8 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::shared_ptr<jit_uni_emb_bag_kernel> _kernel;
 };
 
 }  // namespace MKLDNNPlugin
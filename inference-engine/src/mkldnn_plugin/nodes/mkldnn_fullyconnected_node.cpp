@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_fullyconnected_node.h"
+#include "mkldnn_primitive_cache.hpp"
 #include "mkldnn_eltwise_node.h"
 #include "mkldnn_fake_quantize_node.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
@@ -125,11 +126,12 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
         return;
 
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
+    attr->set_scratchpad_mode(mkldnn::scratchpad_mode::user);
     std::shared_ptr<inner_product_forward::primitive_desc> prim_desc;
     prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
             createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>(*attr));
 
-    prim.reset(new inner_product_forward(*prim_desc));
+    prim = MKLDNNPrimitiveCache::getInstance().getOrCreate<inner_product_forward>(*prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
@@ -138,6 +140,7 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
                     {DNNL_ARG_BIAS, getParentEdgeAt(BIAS_ID)->getMemory().GetPrimitive()}, {DNNL_ARG_DST, dst}};
     else
         primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getParentEdgeAt(WEIGHTS_ID)->getMemory().GetPrimitive()}, {DNNL_ARG_DST, dst}};
+    appendScratchpad(*prim_desc);
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
@@ -15,6 +15,7 @@
 #include <ie_parallel.hpp>
 #include <ie_ngraph_utils.hpp>
 #include <blob_factory.hpp>
+#include <ie_system_conf.h>
 #include "caseless.hpp"
 #include "common/cpu_memcpy.h"
 #include "common/cpu_convert.h"
@@ -337,13 +338,28 @@ void MKLDNNInputNode::cloneBlobIfRequired() {
                 + "_" + ptr;
     };
 
+    // Wraps the constant data without copying. The data may be backed by a memory-mapped weights file,
+    // in such case the pages are shared with other processes until a node repacks the tensor.
+    auto wrapBlob = [&, this] () {
+        MKLDNNMemoryPtr ptr = MKLDNNMemoryPtr(new MKLDNNMemory(getEngine()));
+        ptr->Create(memDesc, constOp->get_data_ptr());
+        return ptr;
+    };
+
+    auto canWrapBlob = [&] () {
+        return isBlobAligned() && !hasSubnormals() && !isWA();
+    };
+
     if (weightCache) {
-        MKLDNNMemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        // Weights cache is kept per NUMA node to have a local copy of the data for the streams of the node,
+        // so the original buffer is shared as is only if there is no other node.
+        const bool isSingleNumaNode = getAvailableNUMANodes().size() <= 1;
+        MKLDNNMemoryPtr ptr = *weightCache->findOrCreate(blobKey(), [&] () {
+            return isSingleNumaNode && canWrapBlob() ? wrapBlob() : cloneBlob();
+        });
         memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(ptr);
-    } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
-        auto ptr = new MKLDNNMemory(getEngine());
-        ptr->Create(memDesc, constOp->get_data_ptr());
-        memoryPtr = MKLDNNMemoryCPtr(ptr);
+    } else if (canWrapBlob()) {
+        memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(wrapBlob());
     } else {
         memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(cloneBlob());
     }
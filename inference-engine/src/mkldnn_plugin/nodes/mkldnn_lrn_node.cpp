@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_lrn_node.h"
+#include "mkldnn_primitive_cache.hpp"
 #include <string>
 #include <mkldnn_extension_utils.h>
 #include <ngraph/opsets/opset1.hpp>
@@ -110,13 +111,16 @@ void MKLDNNLrnNode::createPrimitive() {
     if (prim)
         return;
 
-    auto prim_desc = createPrimitiveDescriptor<mkldnn::lrn_forward::primitive_desc, mkldnn::lrn_forward::desc>();
+    mkldnn::primitive_attr attr;
+    attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
+    auto prim_desc = createPrimitiveDescriptor<mkldnn::lrn_forward::primitive_desc, mkldnn::lrn_forward::desc>(attr);
 
-    prim.reset(new mkldnn::lrn_forward(prim_desc));
+    prim = MKLDNNPrimitiveCache::getInstance().getOrCreate<mkldnn::lrn_forward>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}};
+    appendScratchpad(prim_desc);
 }
 
 bool MKLDNNLrnNode::created() const {
@@ -3,15 +3,18 @@
 //
 
 #include "mkldnn_matmul_node.h"
+#include "mkldnn_primitive_cache.hpp"
+#include "mkldnn_eltwise_node.h"
+#include "mkldnn_fake_quantize_node.h"
 #include <string>
 #include <vector>
 #include <memory>
 #include <algorithm>
-#include <cmath>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
-#include "ie_parallel.hpp"
-#include "common/cpu_memcpy.h"
+#include <mkldnn.hpp>
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "utils/general_utils.h"
 #include <ngraph/opsets/opset1.hpp>
 
 using namespace mkldnn;
@@ -55,8 +58,6 @@ MKLDNNMatMulNode::MKLDNNMatMulNode(const std::shared_ptr<ngraph::Node>& op, cons
         errorPrefix = "Gemm node with name '" + getName() + "'";
 
         const auto matMul = std::dynamic_pointer_cast<const ngraph::opset1::MatMul>(op);
-        alpha = 1;
-        beta = 1;
         transposeA = matMul->get_transpose_a();
         transposeB = matMul->get_transpose_b();
     } else {
@@ -78,8 +79,8 @@ void MKLDNNMatMulNode::getSupportedDescriptors() {
         IE_THROW()  << errorPrefix << " has invalid dims count";
 
     int nDims = inDims0.ndims();
-    xAxis = nDims - 1;
-    yAxis = nDims - 2;
+    auto xAxis = nDims - 1;
+    auto yAxis = nDims - 2;
     auto xAxis0 = transposeA ? yAxis : xAxis;
     auto yAxis0 = transposeA ? xAxis : yAxis;
     auto xAxis1 = transposeB ? yAxis : xAxis;
@@ -90,86 +91,91 @@ void MKLDNNMatMulNode::getSupportedDescriptors() {
     if (inDims0[xAxis0] != inDims1[yAxis1] || inDims0[yAxis0] != outDims[yAxis] || inDims1[xAxis1] != outDims[xAxis])
         IE_THROW()  << errorPrefix << " has incorrect spatial input and output dimensions";
 
+    // batch dimensions equal to 1 are broadcasted by the primitive
     for (int dim_idx = nDims - 3; dim_idx >= 0; dim_idx--) {
         if ((inDims0[dim_idx] != outDims[dim_idx] && inDims0[dim_idx] != 1) ||
             (inDims1[dim_idx] != outDims[dim_idx] && inDims1[dim_idx] != 1)) {
             IE_THROW()  << errorPrefix << " has incorrect input batch dimensions";
         }
+    }
+
+    inputPrecision0 = getOriginalInputPrecisionAtPort(0);
+    inputPrecision1 = getOriginalInputPrecisionAtPort(1);
+    outputPrecision = getOriginalOutputPrecisionAtPort(0);
+    if (!fusedWith.empty()) {
+        outputPrecision = fusedWith[fusedWith.size() - 1]->getOriginalOutputPrecisionAtPort(0);
+    }
 
-        int aOffset = 1;
-        for (int i = dim_idx + 1; i < nDims; i++)
-            aOffset *= inDims0[i];
-        aOffsets.push_back(inDims0[dim_idx] == outDims[dim_idx] ? aOffset : 0);
+    if (!one_of(inputPrecision0, Precision::U8, Precision::I8) || inputPrecision1 != Precision::I8) {
+        if (one_of(Precision::BF16, inputPrecision0, inputPrecision1) && mkldnn::impl::cpu::x64::mayiuse(mkldnn::impl::cpu::x64::avx512_core)) {
+            inputPrecision0 = inputPrecision1 = Precision::BF16;
+            if (outputPrecision != Precision::FP32)
+                outputPrecision = Precision::BF16;
+        } else {
+            inputPrecision0 = inputPrecision1 = outputPrecision = Precision::FP32;
+        }
+    } else if (!one_of(outputPrecision, Precision::FP32, Precision::U8, Precision::I8)) {
+        outputPrecision = Precision::FP32;
+    }
+}
 
-        int bOffset = 1;
-        for (int i = dim_idx + 1; i < nDims; i++)
-            bOffset *= inDims1[i];
-        bOffsets.push_back(inDims1[dim_idx] == outDims[dim_idx] ? bOffset : 0);
+/**
+ * Describes the dense plain tensor, the transposed tensor is described by the swapped dims and strides of two
+ * innermost dimensions, so the primitive reads it as is without a reorder.
+ */
+static mkldnn::memory::desc getStridedDesc(const MKLDNNDims& dims, memory::data_type dataType, bool transpose) {
+    const auto shape = dims.ToSizeVector();
+    const size_t rank = shape.size();
+
+    memory::dims mdims(shape.begin(), shape.end());
+    memory::dims strides(rank, 1);
+    for (size_t i = rank - 1; i > 0; i--)
+        strides[i - 1] = strides[i] * mdims[i];
+
+    if (transpose) {
+        std::swap(mdims[rank - 1], mdims[rank - 2]);
+        std::swap(strides[rank - 1], strides[rank - 2]);
     }
+    return mkldnn::memory::desc(mdims, dataType, strides);
+}
+
+mkldnn::matmul::primitive_desc MKLDNNMatMulNode::createMatMulPrimitiveDescriptor(const mkldnn::primitive_attr &attr) const {
+    auto src = getStridedDesc(getParentEdgeAt(0)->getDims(), MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision0), transposeA);
+    auto weights = getStridedDesc(getParentEdgeAt(1)->getDims(), MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision1), transposeB);
+    auto dst = getStridedDesc(getChildEdgeAt(0)->getDims(), MKLDNNExtensionUtils::IEPrecisionToDataType(outputPrecision), false);
 
-    for (unsigned long dim_idx = aOffsets.size(); dim_idx < 2; dim_idx++)
-        aOffsets.push_back(0);
-    for (unsigned long dim_idx = bOffsets.size(); dim_idx < 2; dim_idx++)
-        bOffsets.push_back(0);
-    for (unsigned long dim_idx = cOffsets.size(); dim_idx < 2; dim_idx++)
-        cOffsets.push_back(0);
+    return mkldnn::matmul::primitive_desc(mkldnn::matmul::desc(src, weights, dst), attr, getEngine());
 }
 
 void MKLDNNMatMulNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    auto inPrec0 = getOriginalInputPrecisionAtPort(0);
-    auto inPrec1 = getOriginalInputPrecisionAtPort(1);
-    if ((inPrec0 != Precision::U8 && inPrec0 != Precision::I8) || inPrec1 != Precision::I8) {
-        if (inPrec0 == Precision::BF16 || inPrec1 == Precision::BF16) {
-            inPrec0 = Precision::BF16;
-            inPrec1 = Precision::BF16;
-        } else {
-            inPrec0 = Precision::FP32;
-            inPrec1 = Precision::FP32;
-        }
-    }
-
-    auto inputDataType0 = MKLDNNExtensionUtils::IEPrecisionToDataType(inPrec0);
-    auto inputDataType1 = MKLDNNExtensionUtils::IEPrecisionToDataType(inPrec1);
-    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(InferenceEngine::Precision::FP32);
+    auto attr = initPrimitiveAttr();
+    auto implType = parse_impl_name(createMatMulPrimitiveDescriptor(*attr).impl_info_str());
 
     InferenceEngine::LayerConfig config;
     config.dynBatchSupport = true;
 
-    auto createDataConfig = [](const MKLDNNDims& dims, memory::data_type dataType) -> InferenceEngine::DataConfig {
+    auto createDataConfig = [](const MKLDNNDims& dims, const Precision& precision) -> InferenceEngine::DataConfig {
         InferenceEngine::DataConfig dataConfig;
         dataConfig.inPlace = -1;
         dataConfig.constant = false;
-        dataConfig.desc = MKLDNNMemoryDesc(dims, dataType, MKLDNNMemory::GetPlainFormat(dims));
+        dataConfig.desc = MKLDNNMemoryDesc(dims, MKLDNNExtensionUtils::IEPrecisionToDataType(precision), MKLDNNMemory::GetPlainFormat(dims));
         return dataConfig;
     };
 
-    config.inConfs.push_back(createDataConfig(getParentEdgeAt(0)->getDims(), inputDataType0));
-    config.inConfs.push_back(createDataConfig(getParentEdgeAt(1)->getDims(), inputDataType1));
-    config.outConfs.push_back(createDataConfig(getChildEdgeAt(0)->getDims(), outputDataType));
+    config.inConfs.push_back(createDataConfig(getParentEdgeAt(0)->getDims(), inputPrecision0));
+    config.inConfs.push_back(createDataConfig(getParentEdgeAt(1)->getDims(), inputPrecision1));
+    config.outConfs.push_back(createDataConfig(getChildEdgeAt(0)->getDims(), outputPrecision));
 
-    supportedPrimitiveDescriptors.push_back(PrimitiveDescInfo(config, impl_desc_type::gemm_any, MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims())));
+    supportedPrimitiveDescriptors.push_back(PrimitiveDescInfo(config, implType, MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims())));
 }
 
-void MKLDNNMatMulNode::initOptimalPrimitiveDescriptor() {
-    auto selected_pd = getSelectedPrimitiveDescriptor();
-    if (selected_pd == nullptr)
-        IE_THROW()  << errorPrefix << " did not set preferable primitive descriptor";
-    auto config = selected_pd->getConfig();
-    if (isInitConfig(config))
-        return;
-
-    MKLDNNNode::initOptimalPrimitiveDescriptor();
-
-    auto* selectedPD = getSelectedPrimitiveDescriptor();
-    if (!selectedPD) {
+void MKLDNNMatMulNode::createPrimitive() {
+    if (prim)
         return;
-    }
-}
 
-void MKLDNNMatMulNode::createPrimitive() {
     auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto& src0MemPtr = getParentEdgeAt(0)->getMemoryPtr();
     auto& src1MemPtr = getParentEdgeAt(1)->getMemoryPtr();
@@ -179,103 +185,105 @@ void MKLDNNMatMulNode::createPrimitive() {
         IE_THROW()  << errorPrefix << " did not allocate input memory";
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW()  << errorPrefix << " did not set preferable primitive descriptor";
-}
-
-inline void process_gemm(char transa, char transb, int M, int N, int K, float alpha, const float *A, int lda,
-                         const float *B, int ldb, float beta, float *C, int ldc) {
-    mkldnn_sgemm(transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
-}
 
-inline void process_gemm(char transa, char transb, int M, int N, int K, float alpha, const uint16_t *A, int lda,
-                         const uint16_t *B, int ldb, float beta, float *C, int ldc) {
-    dnnl_gemm_bf16bf16f32(transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
-}
+    std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
+    attr->set_scratchpad_mode(mkldnn::scratchpad_mode::user);
+    auto prim_desc = createMatMulPrimitiveDescriptor(*attr);
 
-inline void process_gemm(char transa, char transb, int M, int N, int K, float alpha, const uint8_t *A, int lda,
-                         const int8_t *B, int ldb, float beta, float *C, int ldc) {
-    const int32_t co = 0;
-    int32_t *Ci = reinterpret_cast<int32_t *>(C);
-    mkldnn_gemm_u8s8s32(transa, transb, 'F', M, N, K, alpha, A, lda, 0, B, ldb, 0, beta, Ci, ldc, &co);
-    parallel_for(M * N, [&](size_t i) {
-        C[i] = Ci[i];
-    });
-}
+    prim = MKLDNNPrimitiveCache::getInstance().getOrCreate<mkldnn::matmul>(prim_desc);
 
-inline void process_gemm(char transa, char transb, int M, int N, int K, float alpha, const int8_t *A, int lda,
-                         const int8_t *B, int ldb, float beta, float *C, int ldc) {
-    const int32_t co = 0;
-    int32_t *Ci = reinterpret_cast<int32_t *>(C);
-    mkldnn_gemm_s8s8s32(transa, transb, 'F', M, N, K, alpha, A, lda, 0, B, ldb, 0, beta, Ci, ldc, &co);
-    parallel_for(M * N, [&](size_t i) {
-        C[i] = Ci[i];
-    });
+    // the memory objects refer to the edges data with the strided descriptors of the primitive
+    primArgs = {{DNNL_ARG_SRC, mkldnn::memory(prim_desc.src_desc(), getEngine(), src0MemPtr->GetPtr())},
+                {DNNL_ARG_WEIGHTS, mkldnn::memory(prim_desc.weights_desc(), getEngine(), src1MemPtr->GetPtr())},
+                {DNNL_ARG_DST, mkldnn::memory(prim_desc.dst_desc(), getEngine(), dstMemPtr->GetPtr())}};
+    appendScratchpad(prim_desc);
 }
 
-template<typename T0, typename T1>
-void MKLDNNMatMulNode::process_data() {
-    auto inDims0 = getParentEdgeAt(0)->getDims();
-    auto inDims1 = getParentEdgeAt(1)->getDims();
-    auto outDims = getChildEdgeAt(0)->getDims();
-
-    auto& srcMemory0 = getParentEdgeAt(0)->getMemory();
-    auto& srcMemory1 = getParentEdgeAt(1)->getMemory();
-    auto& dstMemory0 = getChildEdgeAt(0)->getMemory();
-
-    const T0 *src0_ptr = reinterpret_cast<const T0*>(srcMemory0.GetPtr());
-    const T1 *src1_ptr = reinterpret_cast<const T1*>(srcMemory1.GetData());
-    float *dst_ptr = reinterpret_cast<float*>(dstMemory0.GetData());
+void MKLDNNMatMulNode::execute(mkldnn::stream strm) {
+    if (!prim)
+        IE_THROW()  << errorPrefix << " doesn't have an initialized primitive";
 
-    int MB1 = outDims.ndims() == 4 ? batchToProcess() : 1;
-    int MB2 = outDims.ndims() == 3 ? batchToProcess() : outDims.ndims() > 3 ? outDims[outDims.ndims() - 3] : 1;
-    int M = outDims[yAxis];
-    int N = outDims[xAxis];
-    int K = transposeA ? inDims0[yAxis] : inDims0[xAxis];
+    // edges data may be switched to the user blobs between inferences
+    primArgs.at(DNNL_ARG_SRC).set_data_handle(getParentEdgeAt(0)->getMemory().GetPtr());
+    primArgs.at(DNNL_ARG_WEIGHTS).set_data_handle(getParentEdgeAt(1)->getMemory().GetPtr());
+    primArgs.at(DNNL_ARG_DST).set_data_handle(getChildEdgeAt(0)->getMemory().GetPtr());
 
-    const char transa = transposeA ? 'T' : 'N';
-    const char transb = transposeB ? 'T' : 'N';
+    (*prim).execute(strm, primArgs);
+}
 
-    int lda = transposeA ? M : K;
-    int ldb = transposeB ? K : N;
-    int ldc = N;
+void MKLDNNMatMulNode::setDynamicBatchLim(int lim) {
+    // The batch of the inputs may be broadcasted, so the primitive always processes the whole batch
+    dynBatchLim = lim;
+}
 
-    beta = 0.f;
+bool MKLDNNMatMulNode::canFuse(const MKLDNNNodePtr& node) const {
+    // Depthwise and quantization post ops are applied along the axis 1 which is the output matrix column axis
+    // only for 2D output, otherwise only per-tensor parameters are supported
+    if (getChildEdgeAt(0)->getDims().ndims() != 2) {
+        if (node->getType() == FakeQuantize) {
+            auto* fakeQuantizeNode = dynamic_cast<MKLDNNFakeQuantizeNode *>(node.get());
+            if (!fakeQuantizeNode || !fakeQuantizeNode->isInputLowBroadcast() || !fakeQuantizeNode->isInputHighBroadcast() ||
+                    !fakeQuantizeNode->isOutputLowBroadcast() || !fakeQuantizeNode->isOutputHighBroadcast())
+                return false;
+        } else if (node->getType() == Eltwise && node->canBePerformedAsScaleShift(this)) {
+            if (node->getAlgorithm() == EltwisePrelu)
+                return false;
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                if (node->getParentEdgeAt(i)->getParent().get() != this && node->getParentEdgeAt(i)->getDims().size() != 1)
+                    return false;
+            }
+        }
+    }
+    return canFuseSimpleOperation(node);
+}
 
-    for (int b1 = 0; b1 < MB1; b1++) {
-        const T0 *a_ptr = src0_ptr;
-        const T1 *b_ptr = src1_ptr;
-        float *d_ptr = dst_ptr;
+void MKLDNNMatMulNode::setPostOps(mkldnn::primitive_attr &attr) {
+    mkldnn::post_ops ops;
+    const bool isInt8 = one_of(inputPrecision0, Precision::U8, Precision::I8);
+    const bool perChannel = getChildEdgeAt(0)->getDims().ndims() == 2;
+    bool withOutputScales = false;
+
+    for (auto &node : fusedWith) {
+        auto* fakeQuantizeNode = dynamic_cast<MKLDNNFakeQuantizeNode *>(node.get());
+        if (fakeQuantizeNode) {
+            fakeQuantizeNode->appendPostOps(ops);
+            continue;
+        }
 
-        for (int b2 = 0; b2 < MB2; b2++) {
-            process_gemm(transa, transb, M, N, K, alpha, a_ptr, lda, b_ptr, ldb, beta, d_ptr, ldc);
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
+        if (eltwiseNode) {
+            if (perChannel || eltwiseNode->getMKLDNNAlgorithm() != mkldnn::algorithm::undef) {
+                eltwiseNode->appendPostOps(ops);
+                continue;
+            }
 
-            a_ptr += aOffsets[0];
-            b_ptr += bOffsets[0];
-            d_ptr += M * N;
+            // per-tensor scale and shift
+            const auto& scales = eltwiseNode->getScales();
+            const auto& shifts = eltwiseNode->getShifts();
+            if (scales.empty() || shifts.empty())
+                IE_THROW() << errorPrefix << " cannot fuse " << eltwiseNode->getName() << " since its buffers are not allocated";
+            if (isInt8 && !withOutputScales && ops.len() == 0 && shifts[0] == 0.f) {
+                // dequantization scale of the int8 result
+                attr.set_output_scales(0, {scales[0]});
+                withOutputScales = true;
+            } else {
+                ops.append_eltwise(1.0f, mkldnn::algorithm::eltwise_linear, scales[0], shifts[0]);
+            }
+            continue;
         }
 
-        src0_ptr += aOffsets[1];
-        src1_ptr += bOffsets[1];
-        dst_ptr += MB2 * M * N;
+        IE_THROW() << "Fusing of " << NameFromType(node->getType()) << " operation to " << NameFromType(this->getType()) << " node is not implemented";
     }
+
+    attr.set_post_ops(ops);
 }
 
-void MKLDNNMatMulNode::execute(mkldnn::stream strm) {
-    switch (getParentEdgeAt(0)->getDesc().getPrecision()) {
-        case Precision::FP32:
-            process_data<float, float>();
-            break;
-        case Precision::BF16:
-            process_data<uint16_t, uint16_t>();
-            break;
-        case Precision::I8:
-            process_data<int8_t, int8_t>();
-            break;
-        case Precision::U8:
-            process_data<uint8_t, int8_t>();
-            break;
-        default:
-            IE_THROW()  << errorPrefix << " has incorrect precision on first input";
-    }
+std::shared_ptr<mkldnn::primitive_attr> MKLDNNMatMulNode::initPrimitiveAttr() {
+    auto attr = std::make_shared<mkldnn::primitive_attr>(mkldnn::primitive_attr());
+
+    setPostOps(*attr);
+
+    return attr;
 }
 
 bool MKLDNNMatMulNode::created() const {
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -17,33 +18,32 @@ public:
 
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
-    void initOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
+    void setDynamicBatchLim(int lim) override;
     bool created() const override;
+    bool canFuse(const MKLDNNNodePtr& node) const override;
     int getMaxBatch() override;
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
     static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+protected:
+    std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
+
 private:
-    float alpha = 1.0f;
-    float beta = 1.0f;
+    void setPostOps(mkldnn::primitive_attr &attr);
+    mkldnn::matmul::primitive_desc createMatMulPrimitiveDescriptor(const mkldnn::primitive_attr &attr) const;
+
     bool transposeA = false;
     bool transposeB = false;
 
-    int xAxis = 0;
-    int yAxis = 0;
-
-    std::vector<int> aOffsets;
-    std::vector<int> bOffsets;
-    std::vector<int> cOffsets;
-
-    template<typename T0, typename T1> void process_data();
+    InferenceEngine::Precision inputPrecision0;
+    InferenceEngine::Precision inputPrecision1;
+    InferenceEngine::Precision outputPrecision;
 
     std::string errorPrefix;
 };
 
 }  // namespace MKLDNNPlugin
-
@@ -6,6 +6,8 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "mkldnn_memory_node.hpp"
+#include "mkldnn_concat_node.h"
+#include "mkldnn_split_node.h"
 #include "common/cpu_memcpy.h"
 #include "utils/general_utils.h"
 
@@ -69,6 +71,27 @@ void MKLDNNMemoryOutputNode::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, memory::format_tag::any);
 }
 
+void MKLDNNMemoryOutputNode::createPrimitive() {
+    auto inputMemoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(inputNode);
+    if (inputMemoryNode == nullptr)
+        return;
+
+    // The producer may write the new state directly to the state buffer if nobody else uses its output
+    auto parentEdge = getParentEdgeAt(0);
+    auto parent = parentEdge->getParent();
+    if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace() ||
+            one_of(parent->getType(), Input, MemoryInput))
+        return;
+    void* defaultPtr = parentEdge->getMemory().GetData();
+    if (parentEdge->getMemory().GetPtr() != defaultPtr)
+        return;
+    for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+        if (parent->getParentEdgeAt(i)->getMemory().GetData() == defaultPtr)
+            return;
+    }
+    inputMemoryNode->setStateProducerEdge(parentEdge);
+}
+
 void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
@@ -110,24 +133,47 @@ void MKLDNNMemoryInputNode::createPrimitive() {
 
     // default memory state is zero filled
     dataStore->FillZero();
+    readBuffer = writeBuffer = dataStore->GetPtr();
+
+    // The output edges may point to the state buffer if the consumers neither modify nor share their inputs
+    bool canBeAliased = true;
+    for (size_t i = 0; canBeAliased && i < getChildEdges().size(); i++) {
+        auto& child = getChildEdgeAt(i)->getChild();
+        auto& mem = getChildEdgeAt(i)->getMemory();
+        if (mem.GetPtr() != mem.GetData() || child->getType() == Output || child->isConstant() || child->isInplace())
+            canBeAliased = false;
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (canBeAliased && concat && concat->isOptimized())
+            canBeAliased = false;
+        // Split is using different ptrs without offsets
+        if (canBeAliased && dynamic_cast<MKLDNNSplitNode *>(child.get()))
+            canBeAliased = false;
+        for (size_t j = 0; canBeAliased && j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetData() == getChildEdgeAt(i)->getMemory().GetData())
+                canBeAliased = false;
+        }
+    }
+    aliasedOutputs.clear();
+    for (size_t i = 0; canBeAliased && i < getChildEdges().size(); i++) {
+        auto edge = getChildEdgeAt(i);
+        aliasedOutputs.emplace_back(edge, edge->getMemory().GetData());
+    }
 }
 
 /**
  * Copy data from one tensor into other.
  * As is. Assume that data is dense tensor with same layout.
- * @param dst destination memory object
+ * @param dst destination buffer
  * @param src source memory object
+ * @param dstSizeInByte size of the destination buffer
  */
 inline
-static void simple_copy(MKLDNNMemory& dst, const MKLDNNMemory& src) {
-    auto srcPtr = static_cast<uint8_t*>(src.GetPtr());
-    auto dstPtr = static_cast<uint8_t*>(dst.GetPtr());
+static void simple_copy(void* dst, const MKLDNNMemory& src, size_t dstSizeInByte) {
     auto srcSizeInByte = src.GetSize();
-    auto dstSizeInByte = dst.GetSize();
 
     IE_ASSERT(srcSizeInByte == dstSizeInByte) << "Memory objects are not compatible. Has different sizes.";
 
-    cpu_memcpy(dstPtr, srcPtr, srcSizeInByte);
+    cpu_memcpy(dst, src.GetPtr(), srcSizeInByte);
 }
 
 MKLDNNMemoryInputNode::~MKLDNNMemoryInputNode() {
@@ -138,19 +184,46 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+void MKLDNNMemoryInputNode::setStateProducerEdge(const MKLDNNEdgePtr& edge) {
+    aliasedProducer = {edge, edge->getMemory().GetData()};
+}
+
+void MKLDNNMemoryInputNode::redirectEdges(void* outputPtr, void* producerPtr) {
+    for (auto& output : aliasedOutputs) {
+        if (auto edge = output.first.lock())
+            edge->getMemory().GetPrimitivePtr()->set_data_handle(outputPtr ? outputPtr : output.second);
+    }
+    if (auto edge = aliasedProducer.first.lock())
+        edge->getMemory().GetPrimitivePtr()->set_data_handle(producerPtr ? producerPtr : aliasedProducer.second);
+}
+
+void MKLDNNMemoryInputNode::bindState(void* newReadBuffer, void* newWriteBuffer) {
+    stateStored = false;
+    if (newReadBuffer == nullptr || newWriteBuffer == nullptr) {
+        // the own store is read and written by the same inference, so it cannot be shared with the edges
+        readBuffer = writeBuffer = dataStore->GetPtr();
+        redirectEdges(nullptr, nullptr);
+        return;
+    }
+    IE_ASSERT(newReadBuffer != newWriteBuffer) << "State must be read and written to different buffers.";
+    readBuffer = newReadBuffer;
+    writeBuffer = newWriteBuffer;
+    redirectEdges(readBuffer, writeBuffer);
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    // Nothing to copy if the producer has written the state to the buffer
+    if (new_state.GetPtr() != writeBuffer)
+        simple_copy(writeBuffer, new_state, dataStore->GetSize());
+    stateStored = true;
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
-    auto dst_mem = getChildEdgeAt(0)->getMemory();
-    // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(dst_mem, *dataStore);
+    auto& dst_mem = getChildEdgeAt(0)->getMemory();
+    // Nothing to copy if the consumers read the state buffer directly
+    if (dst_mem.GetPtr() == readBuffer)
+        return;
+    cpu_memcpy(dst_mem.GetPtr(), readBuffer, dataStore->GetSize());
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
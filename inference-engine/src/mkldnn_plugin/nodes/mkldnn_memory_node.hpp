@@ -11,6 +11,8 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <utility>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -62,7 +64,7 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {}
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override {
         return getType() == MemoryOutput;
@@ -96,9 +98,37 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
- private:
+
+    /**
+     * @brief Binds the buffers of the variable state to the node for the next inference. The state is read from
+     * `readBuffer` and the new state is written to `writeBuffer`, they must not overlap. If it is possible, the output
+     * edges of the node and the input edge of the paired MemoryOutput node are redirected to the buffers, so no copies
+     * are made. Null buffers bind the own store of the node which is read and written with copies.
+     */
+    void bindState(void* readBuffer, void* writeBuffer);
+    /**
+     * @brief Returns true if the new state was written to the write buffer by the last inference
+     */
+    bool isStateStored() const {
+        return stateStored;
+    }
+    /**
+     * @brief Allows to redirect the edge producing the new state to the write buffer
+     */
+    void setStateProducerEdge(const MKLDNNEdgePtr& edge);
+
+private:
+    void redirectEdges(void* outputPtr, void* producerPtr);
+
     MKLDNNMemoryPtr dataStore;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
+    void* readBuffer = nullptr;
+    void* writeBuffer = nullptr;
+    bool stateStored = false;
+    // output edges which may be redirected to the read buffer with their default data pointers
+    std::vector<std::pair<MKLDNNEdgeWeakPtr, void*>> aliasedOutputs;
+    // input edge of the paired MemoryOutput node which may be redirected to the write buffer
+    std::pair<MKLDNNEdgeWeakPtr, void*> aliasedProducer;
 };
 
 }  // namespace MKLDNNPlugin
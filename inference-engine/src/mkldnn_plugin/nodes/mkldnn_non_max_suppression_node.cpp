@@ -142,6 +142,8 @@ void MKLDNNNonMaxSuppressionNode::execute(mkldnn::stream strm) {
 
     if (max_output_boxes_per_class == 0)
         return;
+    // no more than all the boxes can be selected for the class
+    max_output_boxes_per_class = std::min(max_output_boxes_per_class, num_boxes);
 
     iou_threshold = outDims.size() > NMS_SELECTEDSCORES ? 0.0f : 1.0f;
     if (inDims.size() > NMS_IOUTHRESHOLD)
@@ -333,11 +335,53 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
     });
 }
 
+void MKLDNNNonMaxSuppressionNode::decodeBoxes(const float *boxes, const SizeVector &boxesStrides) {
+    decodedBoxes.resize(num_batches * 5 * num_boxes);
+
+    parallel_for2d(num_batches, num_boxes, [&](size_t batch_idx, size_t box_idx) {
+        const float *box = boxes + batch_idx * boxesStrides[0] + box_idx * 4;
+        float *planes = decodedBoxes.data() + batch_idx * 5 * num_boxes;
+
+        float ymin, xmin, ymax, xmax;
+        if (boxEncodingType == boxEncoding::CENTER) {
+            //  box format: x_center, y_center, width, height
+            ymin = box[1] - box[3] / 2.f;
+            xmin = box[0] - box[2] / 2.f;
+            ymax = box[1] + box[3] / 2.f;
+            xmax = box[0] + box[2] / 2.f;
+        } else {
+            //  box format: y1, x1, y2, x2
+            ymin = (std::min)(box[0], box[2]);
+            xmin = (std::min)(box[1], box[3]);
+            ymax = (std::max)(box[0], box[2]);
+            xmax = (std::max)(box[1], box[3]);
+        }
+
+        planes[box_idx] = ymin;
+        planes[num_boxes + box_idx] = xmin;
+        planes[2 * num_boxes + box_idx] = ymax;
+        planes[3 * num_boxes + box_idx] = xmax;
+        planes[4 * num_boxes + box_idx] = (ymax - ymin) * (xmax - xmin);
+    });
+}
+
 void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
                                                                 const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
-    int max_out_box = static_cast<int>(max_output_boxes_per_class);
+    // the candidate is compared with the selected boxes by blocks, the comparisons within the block are vectorized
+    // and the rest of the selected boxes is skipped as soon as the block suppresses the candidate
+    constexpr size_t iouBlockSize = 16;
+    // candidates are sorted lazily by chunks, most of them are not reached when max_output_boxes_per_class is small
+    constexpr size_t minSortChunkSize = 64;
+
+    decodeBoxes(boxes, boxesStrides);
+
     parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
-        const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+        const float *planes = decodedBoxes.data() + batch_idx * 5 * num_boxes;
+        const float *yminPtr = planes;
+        const float *xminPtr = planes + num_boxes;
+        const float *ymaxPtr = planes + 2 * num_boxes;
+        const float *xmaxPtr = planes + 3 * num_boxes;
+        const float *areaPtr = planes + 4 * num_boxes;
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
         std::vector<std::pair<float, int>> sorted_boxes;
@@ -346,29 +390,59 @@ void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const
                 sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
         }
 
-        int io_selection_size = 0;
-        if (sorted_boxes.size() > 0) {
-            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
-            int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-            filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-            io_selection_size++;
-            for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                bool box_is_selected = true;
-                for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                    float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                    if (iou >= iou_threshold) {
-                        box_is_selected = false;
-                        break;
-                    }
-                }
+        auto greater = [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+            return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+        };
+
+        // coordinates of the selected boxes, kept in planes to compare them with the candidate at once
+        std::vector<float> selected(5 * max_output_boxes_per_class);
+        float *selYmin = selected.data();
+        float *selXmin = selYmin + max_output_boxes_per_class;
+        float *selYmax = selXmin + max_output_boxes_per_class;
+        float *selXmax = selYmax + max_output_boxes_per_class;
+        float *selArea = selXmax + max_output_boxes_per_class;
+
+        size_t io_selection_size = 0;
+        size_t sorted_end = 0;
+        size_t sort_chunk_size = (std::max)(max_output_boxes_per_class, minSortChunkSize);
+        int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
+        for (size_t box_idx = 0; (box_idx < sorted_boxes.size()) && (io_selection_size < max_output_boxes_per_class); box_idx++) {
+            if (box_idx == sorted_end) {
+                sorted_end = (std::min)(sorted_boxes.size(), sorted_end + sort_chunk_size);
+                std::partial_sort(sorted_boxes.begin() + box_idx, sorted_boxes.begin() + sorted_end, sorted_boxes.end(), greater);
+                sort_chunk_size *= 2;
+            }
 
-                if (box_is_selected) {
-                    filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
-                    io_selection_size++;
+            const int candidate = sorted_boxes[box_idx].second;
+            const float ymin = yminPtr[candidate];
+            const float xmin = xminPtr[candidate];
+            const float ymax = ymaxPtr[candidate];
+            const float xmax = xmaxPtr[candidate];
+            const float area = areaPtr[candidate];
+
+            bool box_is_selected = true;
+            for (size_t start = 0; start < io_selection_size && box_is_selected; start += iouBlockSize) {
+                const size_t end = (std::min)(io_selection_size, start + iouBlockSize);
+                int suppressed = 0;
+                for (size_t idx = start; idx < end; idx++) {
+                    const float height = (std::max)((std::min)(ymax, selYmax[idx]) - (std::max)(ymin, selYmin[idx]), 0.f);
+                    const float width = (std::max)((std::min)(xmax, selXmax[idx]) - (std::max)(xmin, selXmin[idx]), 0.f);
+                    const float intersection_area = height * width;
+                    const float union_area = area + selArea[idx] - intersection_area;
+                    const float iou = (area > 0.f && selArea[idx] > 0.f) ? intersection_area / union_area : 0.f;
+                    suppressed |= static_cast<int>(iou >= iou_threshold);
                 }
+                box_is_selected = suppressed == 0;
+            }
+
+            if (box_is_selected) {
+                selYmin[io_selection_size] = ymin;
+                selXmin[io_selection_size] = xmin;
+                selYmax[io_selection_size] = ymax;
+                selXmax[io_selection_size] = xmax;
+                selArea[io_selection_size] = area;
+                filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, candidate);
+                io_selection_size++;
             }
         }
         numFiltBox[batch_idx][class_idx] = io_selection_size;
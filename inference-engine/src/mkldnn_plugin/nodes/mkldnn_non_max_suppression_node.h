@@ -50,6 +50,9 @@ public:
     void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
                              const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
 
+    // converts boxes of all batches to corner coordinates kept in planes: ymin, xmin, ymax, xmax and area
+    void decodeBoxes(const float *boxes, const SizeVector &boxesStrides);
+
 private:
     // input
     const size_t NMS_BOXES = 0;
@@ -92,6 +95,7 @@ private:
     std::string errorPrefix;
 
     std::vector<std::vector<size_t>> numFiltBox;
+    std::vector<float> decodedBoxes;
     const std::string inType = "input", outType = "output";
 
     void checkPrecision(const Precision prec, const std::vector<Precision> precList, const std::string name, const std::string type);
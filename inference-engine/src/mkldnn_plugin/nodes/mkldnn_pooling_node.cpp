@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_pooling_node.h"
+#include "mkldnn_primitive_cache.hpp"
 
 #include "mkldnn_fake_quantize_node.h"
 #include "mkldnn_conv_node.h"
@@ -158,14 +159,16 @@ void MKLDNNPoolingNode::createPrimitive() {
 
     mkldnn::primitive_attr attr;
     setPostOps(attr, true);
+    attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
 
     auto prim_desc = createPrimitiveDescriptor<pooling_forward::primitive_desc, pooling_forward::desc>(attr);
 
-    prim.reset(new pooling_forward(prim_desc));
+    prim = MKLDNNPrimitiveCache::getInstance().getOrCreate<pooling_forward>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}};
+    appendScratchpad(prim_desc);
 }
 
 bool MKLDNNPoolingNode::created() const {
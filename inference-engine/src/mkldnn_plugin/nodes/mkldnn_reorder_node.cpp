@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_reorder_node.h"
+#include "mkldnn_primitive_cache.hpp"
 #include <memory>
 #include <string>
 #include <algorithm>
@@ -116,6 +117,7 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
     dst_blocked->Create(dstDesc, dstPtr, false);
 
     mkldnn::primitive_attr attr;
+    attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
 
     if (_scales) {
         std::vector<float> scales;
@@ -133,9 +135,10 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
         attr.set_output_scales(mask, scales);
     }
 
+    reorder::primitive_desc pd;
     auto createReorder = [&]() -> bool {
         // No autoblocking. Reorder can be applied as is
-        reorder::primitive_desc pd = mkldnn::reorder::primitive_desc(src_blocked->GetPrimitive(), dst_blocked->GetPrimitive(), attr, true);
+        pd = mkldnn::reorder::primitive_desc(src_blocked->GetPrimitive(), dst_blocked->GetPrimitive(), attr, true);
 
         if (!pd)
             return false;
@@ -143,7 +146,7 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
         auto info = pd.impl_info_str();
         supportedPrimitiveDescriptors[0].setImplementationType(parse_impl_name(info));
 
-        prim.reset(new mkldnn::reorder(pd));
+        prim = MKLDNNPrimitiveCache::getInstance().getOrCreate<mkldnn::reorder>(pd);
         return true;
     };
 
@@ -178,6 +181,7 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}};
+    appendScratchpad(pd);
 }
 
 const std::vector<impl_desc_type>& MKLDNNReorderNode::getPrimitivesPriority() {
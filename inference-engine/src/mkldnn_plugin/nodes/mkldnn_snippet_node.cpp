@@ -0,0 +1,265 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <numeric>
+#include <string>
+#include <vector>
+#include <mkldnn_extension_utils.h>
+
+#include "mkldnn_snippet_node.h"
+#include "ie_parallel.hpp"
+#include "emitters/cpu_generator.hpp"
+#include "emitters/jit_snippets_emitters.hpp"
+#include <ngraph/opsets/opset1.hpp>
+
+using namespace mkldnn;
+using namespace mkldnn::impl::cpu::x64;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// inputs are broadcasted by the same rules which are used to insert explicit broadcasts into the snippet body
+bool hasNumpyBroadcast(const std::shared_ptr<ngraph::Node>& op) {
+    return (ngraph::op::supports_auto_broadcast(op) || ngraph::is_type<ngraph::opset1::SquaredDifference>(op) ||
+            ngraph::is_type<ngraph::opset1::Mod>(op)) && op->get_autob().m_type == ngraph::op::AutoBroadcastType::NUMPY;
+}
+
+bool isScalarConstant(const ngraph::Output<ngraph::Node>& output) {
+    return ngraph::is_type<ngraph::opset1::Constant>(output.get_node()) && ngraph::shape_size(output.get_shape()) == 1;
+}
+
+} // namespace
+
+bool MKLDNNSnippetNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto subgraph = std::dynamic_pointer_cast<const ngraph::snippets::op::Subgraph>(op);
+        if (!subgraph) {
+            errorMessage = "Only snippets Subgraph operation is supported";
+            return false;
+        }
+        if (!mayiuse(avx2)) {
+            errorMessage = "Snippets are supported on platforms with AVX2 or newer instruction set only";
+            return false;
+        }
+        if (op->get_input_size() + op->get_output_size() > SNIPPETS_MAX_PTRS) {
+            errorMessage = "Snippets with more than " + std::to_string(SNIPPETS_MAX_PTRS) + " inputs and outputs are not supported";
+            return false;
+        }
+        for (const auto& input : op->inputs()) {
+            if (input.get_element_type() != ngraph::element::f32 || input.get_partial_shape().is_dynamic() ||
+                input.get_shape().size() > op->get_output_shape(0).size()) {
+                errorMessage = "Only static f32 inputs broadcastable to the output are supported";
+                return false;
+            }
+        }
+        for (const auto& output : op->outputs()) {
+            if (output.get_element_type() != ngraph::element::f32 || output.get_partial_shape().is_dynamic() ||
+                output.get_shape() != op->get_output_shape(0)) {
+                errorMessage = "Only static f32 outputs of the same shape are supported";
+                return false;
+            }
+        }
+        const CPUGenerator generator(mayiuse(avx512_common) ? avx512_common : avx2);
+        for (const auto& bodyOp : subgraph->get_body()->get_ops()) {
+            if (ngraph::is_type<ngraph::opset1::Constant>(bodyOp)) {
+                // scalar constants are converted to snippets dialect during the code generation
+                if (ngraph::shape_size(bodyOp->get_shape()) != 1) {
+                    errorMessage = "Only scalar constants are supported inside a snippet";
+                    return false;
+                }
+            } else if (!generator.is_supported_op(bodyOp)) {
+                errorMessage = std::string(bodyOp->get_type_name()) + " operation is not supported inside a snippet";
+                return false;
+            }
+            if (bodyOp->get_input_size() < 2 || hasNumpyBroadcast(bodyOp))
+                continue;
+            for (const auto& input : bodyOp->input_values()) {
+                if (input.get_shape() != bodyOp->get_output_shape(0) && !isScalarConstant(input)) {
+                    errorMessage = std::string("Broadcasting of ") + bodyOp->get_type_name() + " operation inputs is not supported";
+                    return false;
+                }
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
+        MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+    errorPrefix = "Snippet node with name '" + getName() + "'";
+
+    isa = mayiuse(avx512_common) ? avx512_common : avx2;
+
+    // the body is generated for the actual shapes of this node, so the snippet is copied with own parameters
+    // to keep the original function untouched
+    const auto original = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+    ngraph::OutputVector subgraphInputs;
+    for (const auto& input : original->inputs())
+        subgraphInputs.push_back(std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_shape()));
+    snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraphInputs, ngraph::clone_function(*original->get_body()));
+    snippet->set_friendly_name(original->get_friendly_name());
+
+    snippet->set_generator(std::make_shared<CPUGenerator>(isa));
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto createDataConfig = [](const MKLDNNDims& dims) -> InferenceEngine::DataConfig {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(dims, memory::data_type::f32, MKLDNNMemory::GetPlainFormat(dims));
+        return dataConfig;
+    };
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    for (const auto& dims : inDims)
+        config.inConfs.push_back(createDataConfig(dims));
+    for (const auto& dims : outDims)
+        config.outConfs.push_back(createDataConfig(dims));
+
+    const auto implType = isa == avx512_common ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+    supportedPrimitiveDescriptors.push_back({config, implType, MKLDNNMemory::GetPlainFormat(outDims[0])});
+}
+
+void MKLDNNSnippetNode::collapseDims() {
+    auto outShape = outDims[0].ToSizeVector();
+    if (outShape.empty())
+        outShape.push_back(1);
+    const size_t rank = outShape.size();
+
+    std::vector<std::vector<size_t>> inShapes;
+    for (const auto& dims : inDims) {
+        auto shape = dims.ToSizeVector();
+        shape.insert(shape.begin(), rank - shape.size(), 1);
+        inShapes.push_back(shape);
+    }
+
+    // a dimension of an input is either equal to the output one or broadcasted, dimensions with the output size 1
+    // match both, so they can be merged with any neighbour
+    auto isBroadcasted = [](size_t inDim, size_t outDim) { return inDim != outDim; };
+
+    outputDims = {outShape.back()};
+    inputDims.assign(inShapes.size(), std::vector<size_t>{});
+    for (size_t i = 0; i < inShapes.size(); i++)
+        inputDims[i].push_back(inShapes[i].back());
+
+    for (int d = static_cast<int>(rank) - 2; d >= 0; d--) {
+        bool canMerge = true;
+        if (outShape[d] != 1 && outputDims.front() != 1) {
+            for (size_t i = 0; i < inShapes.size(); i++) {
+                if (isBroadcasted(inShapes[i][d], outShape[d]) != isBroadcasted(inputDims[i].front(), outputDims.front())) {
+                    canMerge = false;
+                    break;
+                }
+            }
+        }
+
+        if (canMerge) {
+            outputDims.front() *= outShape[d];
+            for (size_t i = 0; i < inShapes.size(); i++)
+                inputDims[i].front() *= inShapes[i][d];
+        } else {
+            outputDims.insert(outputDims.begin(), outShape[d]);
+            for (size_t i = 0; i < inShapes.size(); i++)
+                inputDims[i].insert(inputDims[i].begin(), inShapes[i][d]);
+        }
+    }
+
+    auto getStrides = [](const std::vector<size_t>& dims) {
+        std::vector<size_t> strides(dims.size(), 1);
+        for (int d = static_cast<int>(dims.size()) - 2; d >= 0; d--)
+            strides[d] = strides[d + 1] * dims[d + 1];
+        return strides;
+    };
+
+    outputStrides = getStrides(outputDims);
+    inputStrides.clear();
+    for (const auto& dims : inputDims) {
+        auto strides = getStrides(dims);
+        for (size_t d = 0; d < dims.size(); d++) {
+            if (dims[d] == 1)
+                strides[d] = 0;
+        }
+        inputStrides.push_back(strides);
+    }
+
+    outerWorkAmount = 1;
+    for (size_t d = 0; d + 1 < outputDims.size(); d++)
+        outerWorkAmount *= outputDims[d];
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+    collapseDims();
+
+    ngraph::AxisVector order(outputDims.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputShapes;
+    for (const auto& dims : inputDims)
+        inputShapes.emplace_back(ngraph::Shape(dims), order, ngraph::element::f32);
+    ngraph::snippets::op::Subgraph::BlockedShapeVector outputShapes(outDims.size(),
+        ngraph::snippets::op::Subgraph::BlockedShape{ngraph::Shape(outputDims), order, ngraph::element::f32});
+
+    try {
+        schedule = snippet->generate(outputShapes, inputShapes);
+    } catch (const ngraph::ngraph_error& ex) {
+        IE_THROW() << errorPrefix << " failed to generate code: " << ex.what();
+    }
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    const size_t numInputs = inDims.size();
+    const size_t numOutputs = outDims.size();
+
+    std::vector<const uint8_t*> srcPtrs(numInputs);
+    for (size_t i = 0; i < numInputs; i++)
+        srcPtrs[i] = reinterpret_cast<const uint8_t*>(getParentEdgeAt(i)->getMemoryPtr()->GetPtr());
+    std::vector<uint8_t*> dstPtrs(numOutputs);
+    for (size_t i = 0; i < numOutputs; i++)
+        dstPtrs[i] = reinterpret_cast<uint8_t*>(getChildEdgesAtPort(i)[0]->getMemoryPtr()->GetPtr());
+
+    const auto kernel = schedule.get_callable<void (*)(const jit_snippets_call_args*)>();
+    const size_t outerRank = outputDims.size() - 1;
+    const size_t innerWorkAmount = outputDims.back();
+
+    parallel_for(outerWorkAmount, [&](size_t iwork) {
+        jit_snippets_call_args args;
+        size_t srcOffsets[SNIPPETS_MAX_PTRS] = {};
+        size_t dstOffset = 0;
+
+        size_t rem = iwork;
+        for (int d = static_cast<int>(outerRank) - 1; d >= 0; d--) {
+            const size_t idx = rem % outputDims[d];
+            rem /= outputDims[d];
+            for (size_t i = 0; i < numInputs; i++)
+                srcOffsets[i] += idx * inputStrides[i][d];
+            dstOffset += idx * outputStrides[d];
+        }
+
+        for (size_t i = 0; i < numInputs; i++)
+            args.ptrs[i] = srcPtrs[i] + srcOffsets[i] * sizeof(float);
+        for (size_t i = 0; i < numOutputs; i++)
+            args.ptrs[numInputs + i] = dstPtrs[i] + dstOffset * sizeof(float);
+        args.work_amount = innerWorkAmount;
+
+        kernel(&args);
+    });
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNSnippetNode, Subgraph);
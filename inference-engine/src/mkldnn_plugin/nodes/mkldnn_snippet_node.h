@@ -0,0 +1,50 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <snippets/op/subgraph.hpp>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/// MKLDNNSnippetNode executes a subgraph of elementwise operations collapsed by the snippets tokenization
+/// as a single JIT compiled kernel. The kernel processes the innermost dimension, while the node iterates over
+/// the outer ones in parallel, so broadcasting by any dimension costs no additional memory pass.
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    // merges neighbouring dimensions which are broadcasted the same way for all inputs
+    void collapseDims();
+
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    ngraph::snippets::Schedule schedule;
+
+    // input and output dimensions aligned to the output rank and collapsed
+    std::vector<std::vector<size_t>> inputDims;
+    std::vector<size_t> outputDims;
+    // element strides of the outer dimensions, broadcasted dimensions have zero strides
+    std::vector<std::vector<size_t>> inputStrides;
+    std::vector<size_t> outputStrides;
+    size_t outerWorkAmount = 0;
+
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
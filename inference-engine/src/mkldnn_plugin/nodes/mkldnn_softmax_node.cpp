@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_softmax_node.h"
+#include "mkldnn_primitive_cache.hpp"
 
 #include <string>
 #include <mkldnn_types.h>
@@ -67,8 +68,10 @@ void MKLDNNSoftMaxNode::createPrimitive() {
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
 
-    auto prim_desc = softmax_forward::primitive_desc(*selected_desc_ptr, getEngine());
-    primitive_desc_iterator itpd = descs[0].createPrimitiveDescriptorIterator(getEngine());
+    mkldnn::primitive_attr attr;
+    attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
+    auto prim_desc = softmax_forward::primitive_desc(*selected_desc_ptr, attr, getEngine());
+    primitive_desc_iterator itpd = descs[0].createPrimitiveDescriptorIterator(getEngine(), attr);
 
     while (itpd) {
         impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
@@ -81,11 +84,12 @@ void MKLDNNSoftMaxNode::createPrimitive() {
             break;
     }
 
-    prim.reset(new softmax_forward(prim_desc));
+    prim = MKLDNNPrimitiveCache::getInstance().getOrCreate<softmax_forward>(prim_desc);
 
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}};
+    appendScratchpad(prim_desc);
 }
 
 bool MKLDNNSoftMaxNode::created() const {
@@ -3,6 +3,9 @@
 //
 
 #include <cmath>
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 #include <ngraph/op/topk.hpp>
 #include "ie_parallel.hpp"
@@ -135,30 +138,21 @@ void MKLDNNTopKNode::execute(mkldnn::stream strm) {
 
     SizeVector in_dims = getParentEdgeAt(TOPK_DATA)->getDims().ToSizeVector();
 
-    if (src_k == 1) {
-        if (is_last_dim) {
-            if (mode_max)
-                top1<std::greater>(src, dst_data, dst_idx, in_dims);
-            else
-                top1<std::less>(src, dst_data, dst_idx, in_dims);
-        } else {
-            if (mode_max)
-                top1_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
-            else
-                top1_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
-        }
+    if (is_last_dim) {
+        if (mode_max)
+            topk<std::greater>(src, dst_data, dst_idx, in_dims);
+        else
+            topk<std::less>(src, dst_data, dst_idx, in_dims);
+    } else if (src_k == 1) {
+        if (mode_max)
+            top1_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
+        else
+            top1_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
     } else {
-        if (is_last_dim) {
-            if (mode_max)
-                topk<std::greater>(src, dst_data, dst_idx, in_dims);
-            else
-                topk<std::less>(src, dst_data, dst_idx, in_dims);
-        } else {
-            if (mode_max)
-                topk_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
-            else
-                topk_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
-        }
+        if (mode_max)
+            topk_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
+        else
+            topk_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
     }
 }
 
@@ -215,26 +209,6 @@ void MKLDNNTopKNode::top1_axis(const float* src_data, float* dst_data, int* dst_
     });
 }
 
-template <template <typename> class Compare>
-void MKLDNNTopKNode::top1(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
-    parallel_for(before_num, [&](int i0) {
-        int index_max_val = 0;
-        int s_index = i0 * dim;
-        float max_val = src_data[s_index];
-        for (int i1 = 1; i1 < dim; i1++) {
-            s_index++;
-            if (Compare<float>()(src_data[s_index], max_val)) {
-                max_val = src_data[s_index];
-                index_max_val = i1;
-            }
-        }
-        if (dst_data)
-            dst_data[i0] = max_val;
-        if (dst_idx)
-            dst_idx[i0] = index_max_val;
-    });
-}
-
 template <class Compare1, template <typename> class Compare2>
 void MKLDNNTopKNode::topk_axis(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
     int after_num = count(in_dims, axis + 1, in_dims.size());
@@ -402,53 +376,78 @@ void MKLDNNTopKNode::topk_axis(const float* src_data, float* dst_data, int* dst_
     });
 }
 
-template <template <typename> class Compare>
-void MKLDNNTopKNode::topk(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
-    parallel_for(before_num, [&](int i0) {
-        std::vector<float> max_values(src_k + 1);
-        std::vector<int> max_indexes(src_k + 1);
-        float tmp_value;
-        int tmp_index;
-        int s_index = i0 * dim;
-
-        auto swap_func = [&](int index1, int index2) {
-            tmp_value = max_values[index1];
-            max_values[index1] = max_values[index2];
-            max_values[index2] = tmp_value;
+namespace {
 
-            tmp_index = max_indexes[index1];
-            max_indexes[index1] = max_indexes[index2];
-            max_indexes[index2] = tmp_index;
-        };
+// values are compared with the current k-th one by blocks, the comparison within the block is vectorized and
+// only the blocks containing a value which gets to the top are inserted value by value
+constexpr int topk_filter_block_size = 64;
+// the axis is split between threads only when every part is big enough to amortize the merge of the results
+constexpr int topk_min_axis_part_size = 4096;
 
-        for (int i2 = 0; i2 < src_k; i2++) {
-            max_values[i2] = src_data[s_index];
-            max_indexes[i2] = i2;
-            s_index++;
-        }
-        for (int i2 = 0; i2 < src_k - 1; i2++) {
-            for (int i3 = src_k - 1; i3 > i2; i3--) {
-                if (Compare<float>()(max_values[i3], max_values[i3 - 1])) {
-                    swap_func(i3, i3 - 1);
-                }
+/**
+ * Selects k top values of n values, the earlier value wins the tie. Indexes of the values are taken from
+ * src_indexes if it is given, otherwise they are first_index + position. The result is sorted by value,
+ * max_values and max_indexes have k + 1 elements. Returns number of the selected values: min(k, n).
+ */
+template <template <typename> class Compare>
+int select_topk(const float* src_values, const int* src_indexes, int first_index, int n, int k, float* max_values, int* max_indexes) {
+    auto swap_func = [&](int index1, int index2) {
+        std::swap(max_values[index1], max_values[index2]);
+        std::swap(max_indexes[index1], max_indexes[index2]);
+    };
+    auto src_index = [&](int i) {
+        return src_indexes ? src_indexes[i] : first_index + i;
+    };
+
+    const int count = (std::min)(k, n);
+    for (int i2 = 0; i2 < count; i2++) {
+        max_values[i2] = src_values[i2];
+        max_indexes[i2] = src_index(i2);
+    }
+    for (int i2 = 0; i2 < count - 1; i2++) {
+        for (int i3 = count - 1; i3 > i2; i3--) {
+            if (Compare<float>()(max_values[i3], max_values[i3 - 1])) {
+                swap_func(i3, i3 - 1);
             }
         }
-        for (int i2 = src_k; i2 < dim; i2++) {
-            max_values[src_k] = src_data[s_index];
-            max_indexes[src_k] = i2;
-            for (int i3 = src_k; i3 > 0; i3--) {
+    }
+    if (count < k || k == 0)
+        return count;
+
+    for (int block_start = k; block_start < n; block_start += topk_filter_block_size) {
+        const int block_end = (std::min)(n, block_start + topk_filter_block_size);
+        const float kth_value = max_values[k - 1];
+        int found = 0;
+        for (int i2 = block_start; i2 < block_end; i2++)
+            found |= static_cast<int>(Compare<float>()(src_values[i2], kth_value));
+        if (!found)
+            continue;
+
+        for (int i2 = block_start; i2 < block_end; i2++) {
+            max_values[k] = src_values[i2];
+            max_indexes[k] = src_index(i2);
+            for (int i3 = k; i3 > 0; i3--) {
                 if (Compare<float>()(max_values[i3], max_values[i3 - 1]))
                     swap_func(i3, i3 - 1);
                 else
                     break;
             }
-            s_index++;
         }
+    }
+    return count;
+}
+
+}  // namespace
+
+template <template <typename> class Compare>
+void MKLDNNTopKNode::topk(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
+    auto store_func = [&](int i0, std::vector<float>& max_values, std::vector<int>& max_indexes) {
         if (!sort_value) {
             for (int i2 = 0; i2 < src_k - 1; i2++) {
                 for (int i3 = src_k - 1; i3 > i2; i3--) {
                     if (std::greater<int>()(max_indexes[i3 - 1], max_indexes[i3])) {
-                        swap_func(i3, i3 - 1);
+                        std::swap(max_values[i3], max_values[i3 - 1]);
+                        std::swap(max_indexes[i3], max_indexes[i3 - 1]);
                     }
                 }
             }
@@ -461,6 +460,59 @@ void MKLDNNTopKNode::topk(const float* src_data, float* dst_data, int* dst_idx,
             for (int i2 = 0; i2 < src_k; i2++)
                 dst_idx[i0 * src_k + i2] = max_indexes[i2];
         }
+    };
+
+    // a few long rows (e.g. the vocabulary logits of the beams) are split by the axis to occupy all the threads
+    int axis_parts = 1;
+    const int nthr = parallel_get_max_threads();
+    if (before_num < nthr)
+        axis_parts = (std::max)(1, (std::min)(nthr / before_num, dim / (std::max)(topk_min_axis_part_size, src_k)));
+
+    if (axis_parts == 1) {
+        parallel_for(before_num, [&](int i0) {
+            std::vector<float> max_values(src_k + 1);
+            std::vector<int> max_indexes(src_k + 1);
+            select_topk<Compare>(src_data + i0 * dim, nullptr, 0, dim, src_k, max_values.data(), max_indexes.data());
+            store_func(i0, max_values, max_indexes);
+        });
+        return;
+    }
+
+    std::vector<float> part_values(before_num * axis_parts * (src_k + 1));
+    std::vector<int> part_indexes(before_num * axis_parts * (src_k + 1));
+    std::vector<int> part_counts(before_num * axis_parts);
+    parallel_for2d(before_num, axis_parts, [&](int i0, int ip) {
+        int start = 0, end = 0;
+        splitter(dim, axis_parts, ip, start, end);
+        const int offset = (i0 * axis_parts + ip) * (src_k + 1);
+        part_counts[i0 * axis_parts + ip] = select_topk<Compare>(src_data + i0 * dim + start, nullptr, start, end - start, src_k,
+                                                                 &part_values[offset], &part_indexes[offset]);
+    });
+
+    // the selected values of the parts are merged in the order of their indexes to keep the same tie breaking
+    parallel_for(before_num, [&](int i0) {
+        std::vector<std::pair<int, float>> candidates;
+        candidates.reserve(axis_parts * src_k);
+        for (int ip = 0; ip < axis_parts; ip++) {
+            const int offset = (i0 * axis_parts + ip) * (src_k + 1);
+            for (int i2 = 0; i2 < part_counts[i0 * axis_parts + ip]; i2++)
+                candidates.emplace_back(part_indexes[offset + i2], part_values[offset + i2]);
+        }
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const std::pair<int, float>& l, const std::pair<int, float>& r) { return l.first < r.first; });
+
+        std::vector<float> candidate_values(candidates.size());
+        std::vector<int> candidate_indexes(candidates.size());
+        for (size_t i2 = 0; i2 < candidates.size(); i2++) {
+            candidate_indexes[i2] = candidates[i2].first;
+            candidate_values[i2] = candidates[i2].second;
+        }
+
+        std::vector<float> max_values(src_k + 1);
+        std::vector<int> max_indexes(src_k + 1);
+        select_topk<Compare>(candidate_values.data(), candidate_indexes.data(), 0, static_cast<int>(candidates.size()), src_k,
+                             max_values.data(), max_indexes.data());
+        store_func(i0, max_values, max_indexes);
     });
 }
 
@@ -0,0 +1,104 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_memory.hpp"
+
+#include <ie_system_conf.h>
+
+#include <climits>
+#include <mutex>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+namespace {
+
+std::mutex& boundBytesMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::map<int, uint64_t>& boundBytes() {
+    static std::map<int, uint64_t> bytes;
+    return bytes;
+}
+
+bool isMultiNodeSystem() {
+    static const bool multiNode = [] {
+        const auto nodes = InferenceEngine::getAvailableNUMANodes();
+        return nodes.size() > 1 && nodes.front() >= 0;
+    }();
+    return multiNode;
+}
+
+#if defined(__linux__) && defined(SYS_mbind)
+// constants of the kernel API, numaif.h is a part of libnuma which is not a dependency of the plugin
+constexpr int mpolPreferred = 1;
+constexpr unsigned mpolMfMove = 1u << 1;
+
+bool bindPages(void* data, size_t size, int numaNodeId, size_t& boundSize) {
+    const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = (reinterpret_cast<uintptr_t>(data) + pageSize - 1) / pageSize * pageSize;
+    const auto end = (reinterpret_cast<uintptr_t>(data) + size) / pageSize * pageSize;
+    if (end <= begin)
+        return false;
+
+    constexpr size_t maskBits = sizeof(unsigned long) * CHAR_BIT;  // NOLINT
+    std::vector<unsigned long> nodeMask(numaNodeId / maskBits + 1, 0);  // NOLINT
+    nodeMask[numaNodeId / maskBits] |= 1ul << (numaNodeId % maskBits);
+
+    // preferred policy falls back to other nodes instead of failing when the node is out of memory
+    if (syscall(SYS_mbind, begin, end - begin, mpolPreferred, nodeMask.data(), nodeMask.size() * maskBits + 1,
+                mpolMfMove) != 0)
+        return false;
+    boundSize = end - begin;
+    return true;
+}
+#else
+bool bindPages(void*, size_t, int, size_t&) {
+    return false;
+}
+#endif
+
+}  // namespace
+
+NumaMemoryBinding::Ptr NumaMemoryBinding::bind(void* data, size_t size, int numaNodeId) {
+    if (data == nullptr || numaNodeId < 0 || !isMultiNodeSystem())
+        return nullptr;
+
+    size_t boundSize = 0;
+    if (!bindPages(data, size, numaNodeId, boundSize))
+        return nullptr;
+    return std::make_shared<NumaMemoryBinding>(numaNodeId, boundSize);
+}
+
+std::map<int, uint64_t> NumaMemoryBinding::getBoundBytes() {
+    std::map<int, uint64_t> bytes;
+    if (!isMultiNodeSystem())
+        return bytes;
+    for (auto numaNodeId : InferenceEngine::getAvailableNUMANodes()) {
+        if (numaNodeId >= 0)
+            bytes[numaNodeId] = 0;
+    }
+    std::lock_guard<std::mutex> lock{boundBytesMutex()};
+    for (const auto& node : boundBytes())
+        bytes[node.first] = node.second;
+    return bytes;
+}
+
+NumaMemoryBinding::NumaMemoryBinding(int numaNodeId, size_t size) : _numaNodeId(numaNodeId), _size(size) {
+    std::lock_guard<std::mutex> lock{boundBytesMutex()};
+    boundBytes()[_numaNodeId] += _size;
+}
+
+NumaMemoryBinding::~NumaMemoryBinding() {
+    std::lock_guard<std::mutex> lock{boundBytesMutex()};
+    boundBytes()[_numaNodeId] -= _size;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,50 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Binding of a memory buffer to a NUMA node. Pages of the buffer which are already touched are migrated to the node,
+ * the rest are allocated on it on the first touch, so weights and intermediate buffers of a stream stay local
+ * even if they are written by a thread running on another node.
+ *
+ * The binding is supported on Linux for systems with several NUMA nodes only. Bound bytes are accounted per node
+ * while the binding object is alive.
+ */
+class NumaMemoryBinding {
+public:
+    using Ptr = std::shared_ptr<NumaMemoryBinding>;
+
+    /**
+     * @param data buffer to bind, only pages which are fully inside the buffer are bound
+     * @param size size of the buffer in bytes
+     * @param numaNodeId id of the node as reported by InferenceEngine::getAvailableNUMANodes()
+     * @return nullptr if the buffer is not bound
+     */
+    static Ptr bind(void* data, size_t size, int numaNodeId);
+
+    /**
+     * @return number of bytes currently bound to each NUMA node
+     */
+    static std::map<int, uint64_t> getBoundBytes();
+
+    NumaMemoryBinding(int numaNodeId, size_t size);
+    ~NumaMemoryBinding();
+
+    NumaMemoryBinding(const NumaMemoryBinding&) = delete;
+    NumaMemoryBinding& operator=(const NumaMemoryBinding&) = delete;
+
+private:
+    int _numaNodeId;
+    size_t _size;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,377 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "serialize.hpp"
+
+#include <blob_factory.hpp>
+#include <ie_common.h>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph_ops/type_relaxed.hpp>
+#include <transformations/rt_info/fused_names_attribute.hpp>
+#include <transformations/rt_info/primitives_priority_attribute.hpp>
+#include <transformations/serialize.hpp>
+#include "rt_info/memory_formats_attribute.hpp"
+
+#include <array>
+#include <cstring>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+namespace {
+
+constexpr char magic[] = "MKLDNNPluginCache";
+// should be increased when the format or the set of plugin specific operations is changed
+constexpr uint32_t formatVersion = 2;
+
+// Runtime info read by the plugin which is not serialized to IR. It is kept next to IR for the operations of the
+// transformed network, so the imported network has the same exec graph and performance counters.
+constexpr char originalLayersNamesAttr[] = "originalLayersNames";
+constexpr char seqAxisAttr[] = "seqAxis";
+using FusedNamesWrapper = ngraph::VariantWrapper<ngraph::FusedNames>;
+using PrimitivesPriorityWrapper = ngraph::VariantWrapper<ngraph::PrimitivesPriority>;
+using InputMemoryFormatsWrapper = ngraph::VariantWrapper<ngraph::MLKDNNInputMemoryFormats>;
+using OutputMemoryFormatsWrapper = ngraph::VariantWrapper<ngraph::MLKDNNOutputMemoryFormats>;
+
+const std::array<const char*, 6> pluginRuntimeInfo = {{
+    originalLayersNamesAttr, seqAxisAttr, FusedNamesWrapper::type_info.name, PrimitivesPriorityWrapper::type_info.name,
+    InputMemoryFormatsWrapper::type_info.name, OutputMemoryFormatsWrapper::type_info.name}};
+
+bool hasPluginRuntimeInfo(const std::shared_ptr<const ngraph::Node>& op) {
+    const auto& rtInfo = op->get_rt_info();
+    for (const auto& name : pluginRuntimeInfo) {
+        if (rtInfo.count(name))
+            return true;
+    }
+    return false;
+}
+
+template <typename T>
+void writeValue(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T readValue(std::istream& stream) {
+    T value;
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (!stream.good())
+        IE_THROW(NetworkNotRead) << "Unexpected end of the CPU plugin model cache blob";
+    return value;
+}
+
+void writeBytes(std::ostream& stream, const void* data, size_t size) {
+    writeValue(stream, static_cast<uint64_t>(size));
+    stream.write(reinterpret_cast<const char*>(data), size);
+}
+
+void readBytes(std::istream& stream, void* data, size_t size) {
+    stream.read(reinterpret_cast<char*>(data), size);
+    if (!stream.good())
+        IE_THROW(NetworkNotRead) << "Unexpected end of the CPU plugin model cache blob";
+}
+
+void writeString(std::ostream& stream, const std::string& str) {
+    writeBytes(stream, str.data(), str.size());
+}
+
+std::string readString(std::istream& stream) {
+    std::string str(readValue<uint64_t>(stream), '\0');
+    if (!str.empty())
+        readBytes(stream, &str[0], str.size());
+    return str;
+}
+
+void writeBlob(std::ostream& stream, const Blob::Ptr& blob) {
+    const auto& desc = blob->getTensorDesc();
+    writeValue(stream, static_cast<Precision::ePrecision>(desc.getPrecision()));
+    writeValue(stream, desc.getLayout());
+    writeValue(stream, static_cast<uint64_t>(desc.getDims().size()));
+    for (auto dim : desc.getDims())
+        writeValue(stream, static_cast<uint64_t>(dim));
+    writeBytes(stream, blob->cbuffer().as<const void*>(), blob->byteSize());
+}
+
+Blob::Ptr readBlob(std::istream& stream) {
+    const auto precision = readValue<Precision::ePrecision>(stream);
+    const auto layout = readValue<Layout>(stream);
+    SizeVector dims(readValue<uint64_t>(stream));
+    for (auto& dim : dims)
+        dim = readValue<uint64_t>(stream);
+
+    auto blob = make_blob_with_precision(TensorDesc(precision, dims, layout));
+    blob->allocate();
+    if (readValue<uint64_t>(stream) != blob->byteSize())
+        IE_THROW(NetworkNotRead) << "Size of the blob in the CPU plugin model cache doesn't match its tensor descriptor";
+    readBytes(stream, blob->buffer().as<void*>(), blob->byteSize());
+    return blob;
+}
+
+void writeInputsInfo(std::ostream& stream, const InputsDataMap& inputs) {
+    writeValue(stream, static_cast<uint64_t>(inputs.size()));
+    for (const auto& input : inputs) {
+        writeString(stream, input.first);
+        writeValue(stream, static_cast<Precision::ePrecision>(input.second->getPrecision()));
+        writeValue(stream, input.second->getLayout());
+
+        const auto& preProcess = input.second->getPreProcess();
+        writeValue(stream, preProcess.getResizeAlgorithm());
+        writeValue(stream, preProcess.getColorFormat());
+        writeValue(stream, preProcess.getMeanVariant());
+        writeValue(stream, static_cast<uint64_t>(preProcess.getNumberOfChannels()));
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+            const auto& channel = preProcess[c];
+            writeValue(stream, channel->stdScale);
+            writeValue(stream, channel->meanValue);
+            writeValue(stream, channel->meanData != nullptr);
+            if (channel->meanData)
+                writeBlob(stream, channel->meanData);
+        }
+    }
+}
+
+void readInputsInfo(std::istream& stream, const InputsDataMap& inputs) {
+    const auto inputsNum = readValue<uint64_t>(stream);
+    if (inputsNum != inputs.size())
+        IE_THROW(NetworkNotRead) << "Number of inputs in the CPU plugin model cache doesn't match the network";
+    for (size_t i = 0; i < inputsNum; i++) {
+        const auto name = readString(stream);
+        auto input = inputs.find(name);
+        if (input == inputs.end())
+            IE_THROW(NetworkNotRead) << "Input " << name << " from the CPU plugin model cache isn't found in the network";
+        input->second->setPrecision(readValue<Precision::ePrecision>(stream));
+        input->second->setLayout(readValue<Layout>(stream));
+
+        auto& preProcess = input->second->getPreProcess();
+        preProcess.setResizeAlgorithm(readValue<ResizeAlgorithm>(stream));
+        preProcess.setColorFormat(readValue<ColorFormat>(stream));
+        const auto meanVariant = readValue<MeanVariant>(stream);
+        const auto channelsNum = readValue<uint64_t>(stream);
+        if (channelsNum > 0)
+            preProcess.init(channelsNum);
+        for (size_t c = 0; c < channelsNum; c++) {
+            auto& channel = preProcess[c];
+            channel->stdScale = readValue<float>(stream);
+            channel->meanValue = readValue<float>(stream);
+            if (readValue<bool>(stream))
+                channel->meanData = readBlob(stream);
+        }
+        preProcess.setVariant(meanVariant);
+    }
+}
+
+void writeOutputsInfo(std::ostream& stream, const OutputsDataMap& outputs) {
+    writeValue(stream, static_cast<uint64_t>(outputs.size()));
+    for (const auto& output : outputs) {
+        writeString(stream, output.first);
+        writeValue(stream, static_cast<Precision::ePrecision>(output.second->getPrecision()));
+        writeValue(stream, output.second->getLayout());
+    }
+}
+
+void readOutputsInfo(std::istream& stream, const OutputsDataMap& outputs) {
+    const auto outputsNum = readValue<uint64_t>(stream);
+    if (outputsNum != outputs.size())
+        IE_THROW(NetworkNotRead) << "Number of outputs in the CPU plugin model cache doesn't match the network";
+    for (size_t i = 0; i < outputsNum; i++) {
+        const auto name = readString(stream);
+        auto output = outputs.find(name);
+        if (output == outputs.end())
+            IE_THROW(NetworkNotRead) << "Output " << name << " from the CPU plugin model cache isn't found in the network";
+        output->second->setPrecision(readValue<Precision::ePrecision>(stream));
+        output->second->setLayout(readValue<Layout>(stream));
+    }
+}
+
+template <typename T>
+std::shared_ptr<T> getRuntimeInfo(const ngraph::Node::RTMap& rtInfo, const char* name) {
+    auto it = rtInfo.find(name);
+    return it == rtInfo.end() ? nullptr : std::dynamic_pointer_cast<T>(it->second);
+}
+
+void writeRuntimeInfo(std::ostream& stream, const std::shared_ptr<const ngraph::Function>& function) {
+    std::vector<std::shared_ptr<const ngraph::Node>> ops;
+    for (const auto& op : function->get_ops()) {
+        if (hasPluginRuntimeInfo(op))
+            ops.push_back(op);
+    }
+
+    writeValue(stream, static_cast<uint64_t>(ops.size()));
+    for (const auto& op : ops) {
+        const auto& rtInfo = op->get_rt_info();
+        writeString(stream, op->get_friendly_name());
+
+        const auto originalLayersNames = getRuntimeInfo<ngraph::VariantImpl<std::string>>(rtInfo, originalLayersNamesAttr);
+        writeValue(stream, originalLayersNames != nullptr);
+        if (originalLayersNames)
+            writeString(stream, originalLayersNames->get());
+
+        const auto seqAxis = getRuntimeInfo<ngraph::VariantImpl<int64_t>>(rtInfo, seqAxisAttr);
+        writeValue(stream, seqAxis != nullptr);
+        if (seqAxis)
+            writeValue(stream, seqAxis->get());
+
+        const auto fusedNames = getRuntimeInfo<FusedNamesWrapper>(rtInfo, FusedNamesWrapper::type_info.name);
+        const auto names = fusedNames ? fusedNames->get().getVectorNames() : std::vector<std::string>{};
+        writeValue(stream, static_cast<uint64_t>(names.size()));
+        for (const auto& name : names)
+            writeString(stream, name);
+
+        writeString(stream, ngraph::getPrimitivesPriority(std::const_pointer_cast<ngraph::Node>(op)));
+        writeString(stream, ngraph::getMLKDNNInputMemoryFormats(std::const_pointer_cast<ngraph::Node>(op)));
+        writeString(stream, ngraph::getMLKDNNOutputMemoryFormats(std::const_pointer_cast<ngraph::Node>(op)));
+    }
+}
+
+void readRuntimeInfo(std::istream& stream, const std::shared_ptr<ngraph::Function>& function) {
+    std::unordered_map<std::string, std::shared_ptr<ngraph::Node>> ops;
+    for (const auto& op : function->get_ops())
+        ops.emplace(op->get_friendly_name(), op);
+
+    const auto opsNum = readValue<uint64_t>(stream);
+    for (size_t i = 0; i < opsNum; i++) {
+        const auto name = readString(stream);
+        auto op = ops.find(name);
+        if (op == ops.end())
+            IE_THROW(NetworkNotRead) << "Operation " << name << " from the CPU plugin model cache isn't found in the network";
+        auto& rtInfo = op->second->get_rt_info();
+
+        if (readValue<bool>(stream))
+            rtInfo[originalLayersNamesAttr] = std::make_shared<ngraph::VariantWrapper<std::string>>(readString(stream));
+
+        if (readValue<bool>(stream))
+            rtInfo[seqAxisAttr] = std::make_shared<ngraph::VariantWrapper<int64_t>>(readValue<int64_t>(stream));
+
+        const auto fusedNamesNum = readValue<uint64_t>(stream);
+        if (fusedNamesNum > 0) {
+            ngraph::FusedNames fusedNames;
+            for (size_t n = 0; n < fusedNamesNum; n++)
+                fusedNames.fuseWith(ngraph::FusedNames(readString(stream)));
+            rtInfo[FusedNamesWrapper::type_info.name] = std::make_shared<FusedNamesWrapper>(fusedNames);
+        }
+
+        const auto primitivesPriority = readString(stream);
+        if (!primitivesPriority.empty()) {
+            rtInfo[PrimitivesPriorityWrapper::type_info.name] =
+                std::make_shared<PrimitivesPriorityWrapper>(ngraph::PrimitivesPriority(primitivesPriority));
+        }
+
+        const auto inputMemoryFormats = readString(stream);
+        if (!inputMemoryFormats.empty()) {
+            rtInfo[InputMemoryFormatsWrapper::type_info.name] =
+                std::make_shared<InputMemoryFormatsWrapper>(ngraph::MLKDNNInputMemoryFormats(inputMemoryFormats));
+        }
+
+        const auto outputMemoryFormats = readString(stream);
+        if (!outputMemoryFormats.empty()) {
+            rtInfo[OutputMemoryFormatsWrapper::type_info.name] =
+                std::make_shared<OutputMemoryFormatsWrapper>(ngraph::MLKDNNOutputMemoryFormats(outputMemoryFormats));
+        }
+    }
+}
+
+// the runtime info is matched with the operations of the network read back by the operation names
+bool hasUniqueRuntimeInfoNames(const std::shared_ptr<const ngraph::Function>& function) {
+    std::unordered_map<std::string, size_t> names;
+    for (const auto& op : function->get_ops())
+        names[op->get_friendly_name()]++;
+    for (const auto& op : function->get_ops()) {
+        if (hasPluginRuntimeInfo(op) && names[op->get_friendly_name()] > 1)
+            return false;
+    }
+    return true;
+}
+
+std::map<std::string, ngraph::OpSet> getCustomOpsets(const std::vector<IExtensionPtr>& extensions) {
+    std::map<std::string, ngraph::OpSet> customOpsets;
+    for (const auto& extension : extensions) {
+        auto opsets = extension->getOpSets();
+        customOpsets.insert(opsets.begin(), opsets.end());
+    }
+    return customOpsets;
+}
+
+bool isSerializable(const std::shared_ptr<const ngraph::Function>& function,
+                    const std::map<std::string, ngraph::OpSet>& customOpsets) {
+    static const std::array<std::reference_wrapper<const ngraph::OpSet>, 7> opsets = {{
+        ngraph::get_opset1(), ngraph::get_opset2(), ngraph::get_opset3(), ngraph::get_opset4(),
+        ngraph::get_opset5(), ngraph::get_opset6(), ngraph::get_opset7()}};
+
+    for (const auto& op : function->get_ops()) {
+        // relaxed types are not serialized, such operation is read back as the original one
+        if (std::dynamic_pointer_cast<const ngraph::op::TypeRelaxedBase>(op))
+            return false;
+
+        bool known = false;
+        for (const auto& opset : opsets)
+            known = known || opset.get().contains_op_type(op.get());
+        for (const auto& opset : customOpsets)
+            known = known || opset.second.contains_op_type(op.get());
+        if (!known)
+            return false;
+
+        if (auto subGraph = std::dynamic_pointer_cast<const ngraph::op::util::SubGraphOp>(op)) {
+            if (!isSerializable(subGraph->get_function(), customOpsets))
+                return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream& ostream, const std::vector<IExtensionPtr>& extensions)
+    : _ostream(ostream), _opsets(getCustomOpsets(extensions)) {}
+
+bool CNNNetworkSerializer::canSerialize(const std::shared_ptr<const ngraph::Function>& function,
+                                        const std::vector<IExtensionPtr>& extensions) {
+    return isSerializable(function, getCustomOpsets(extensions)) && hasUniqueRuntimeInfoNames(function);
+}
+
+void CNNNetworkSerializer::write(const CNNNetwork& network, bool transformed) {
+    std::stringstream xmlFile, binFile;
+    ngraph::pass::Serialize serializer(xmlFile, binFile, ngraph::pass::Serialize::Version::IR_V10, _opsets);
+    serializer.run_on_function(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
+
+    _ostream.write(magic, sizeof(magic));
+    writeValue(_ostream, formatVersion);
+    writeValue(_ostream, transformed);
+    writeString(_ostream, xmlFile.str());
+    writeString(_ostream, binFile.str());
+    writeInputsInfo(_ostream, network.getInputsInfo());
+    writeOutputsInfo(_ostream, network.getOutputsInfo());
+    writeRuntimeInfo(_ostream, network.getFunction());
+}
+
+CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream& istream, NetworkReader reader)
+    : _istream(istream), _reader(std::move(reader)) {}
+
+CNNNetwork CNNNetworkDeserializer::read(bool& transformed) {
+    char header[sizeof(magic)];
+    readBytes(_istream, header, sizeof(header));
+    if (std::memcmp(header, magic, sizeof(magic)) != 0 || readValue<uint32_t>(_istream) != formatVersion)
+        IE_THROW(NetworkNotRead) << "The blob is not a CPU plugin model cache or has an unsupported version";
+    transformed = readValue<bool>(_istream);
+
+    const auto model = readString(_istream);
+    Blob::Ptr weights;
+    const auto weightsSize = readValue<uint64_t>(_istream);
+    if (weightsSize > 0) {
+        weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {static_cast<size_t>(weightsSize)}, Layout::C));
+        weights->allocate();
+        readBytes(_istream, weights->buffer().as<void*>(), weightsSize);
+    }
+
+    auto network = _reader(model, weights);
+    readInputsInfo(_istream, network.getInputsInfo());
+    readOutputsInfo(_istream, network.getOutputsInfo());
+    readRuntimeInfo(_istream, network.getFunction());
+    return network;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,71 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_iextension.h>
+
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <memory>
+#include <vector>
+#include <map>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Writes a network to the CPU plugin model cache blob.
+ *
+ * The network topology and weights are stored as IR. Inputs and outputs info (precisions, layouts, preprocessing)
+ * and the runtime info used by the plugin (original and fused layer names, primitives priority, memory formats)
+ * are stored separately since they are not kept in IR. Plugin specific operations are serialized with the opsets
+ * provided by the extensions.
+ */
+class CNNNetworkSerializer {
+public:
+    CNNNetworkSerializer(std::ostream& ostream, const std::vector<InferenceEngine::IExtensionPtr>& extensions);
+
+    /**
+     * @brief Checks that the function can be read back from IR as is. Plugin transformations may produce operations
+     * with relaxed types (low precision) which are not kept in IR. The runtime info is matched by the operation
+     * names, so operations with runtime info must have unique names.
+     */
+    static bool canSerialize(const std::shared_ptr<const ngraph::Function>& function,
+                             const std::vector<InferenceEngine::IExtensionPtr>& extensions);
+
+    /**
+     * @param network the network to write
+     * @param transformed true if the network has been already transformed by the plugin
+     */
+    void write(const InferenceEngine::CNNNetwork& network, bool transformed);
+
+private:
+    std::ostream& _ostream;
+    std::map<std::string, ngraph::OpSet> _opsets;
+};
+
+/**
+ * Reads a network written by CNNNetworkSerializer
+ */
+class CNNNetworkDeserializer {
+public:
+    using NetworkReader = std::function<InferenceEngine::CNNNetwork(const std::string& model,
+                                                                    const InferenceEngine::Blob::CPtr& weights)>;
+
+    CNNNetworkDeserializer(std::istream& istream, NetworkReader reader);
+
+    /**
+     * @param transformed set to true if the network has been already transformed by the plugin
+     */
+    InferenceEngine::CNNNetwork read(bool& transformed);
+
+private:
+    std::istream& _istream;
+    NetworkReader _reader;
+};
+
+}  // namespace MKLDNNPlugin
@@ -45,6 +45,27 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(FORCE_DISABLE_CACHE);
 
+/**
+ * @brief Enables concurrent execution of independent graph nodes inside a single CPU stream (YES/NO, NO by default)
+ *        The nodes are dispatched in dependency levels (wavefronts) on the stream's threading arena
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_GRAPH_EXECUTION);
+
+/**
+ * @brief Number of input shape variants the CPU plugin keeps compiled for a single executable network (0 by default)
+ *        A non-zero value allows infer requests to accept input blobs whose dims differ from the network ones.
+ *        Each new combination of input dims is compiled once and kept in an LRU cache of the given size.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_RESHAPE_CACHE_SIZE);
+
+/**
+ * @brief Enables collapsing of elementwise subgraphs into snippets JIT compiled by the CPU plugin (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SNIPPETS);
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
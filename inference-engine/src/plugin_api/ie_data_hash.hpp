@@ -0,0 +1,33 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Fast non-cryptographic hash of memory buffers
+ * @file ie_data_hash.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief      Computes 64-bit non-cryptographic hash (XXH64 algorithm) of a memory buffer.
+ * @ingroup    ie_dev_api_memory
+ *
+ * Buffers larger than a chunk are split into fixed size chunks hashed in parallel, the result is the hash of the
+ * chunk hashes. The value depends on the data, the size and the seed only, it doesn't depend on the number of threads.
+ *
+ * @param data A pointer to the data
+ * @param size A size of the data in bytes
+ * @param seed A seed value
+ * @return     The hash value
+ */
+INFERENCE_ENGINE_API_CPP(uint64_t) computeDataHash(const void* data, size_t size, uint64_t seed = 0);
+
+}  // namespace InferenceEngine
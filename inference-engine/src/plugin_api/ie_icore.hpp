@@ -12,6 +12,7 @@
 #include <array>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <ie_parameter.hpp>
 #include <cpp/ie_cnn_network.h>
@@ -42,6 +43,16 @@ public:
      */
     virtual CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const = 0;
 
+    /**
+     * @brief Reads IR xml and bin from memory using plugin specific extensions in addition to the Core ones
+     * @param model string with IR
+     * @param weights shared pointer to constant blob with weights
+     * @param exts vector with extensions providing custom opsets used by the IR (e.g. plugin specific operations)
+     * @return CNNNetwork
+     */
+    virtual CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights,
+                                   const std::vector<IExtensionPtr>& exts) const = 0;
+
     /**
      * @brief Reads IR xml and bin files
      * @param modelPath path to IR file
@@ -640,6 +640,11 @@ template void mergeRowImpl<neon_tag, float, 4>(neon_tag, const std::array<const
 template void calcRowLinear32FC1Impl(neon_tag, float* dst[], const float* src0[], const float* src1[],
                                      const float alpha[], const int mapsx[], const float beta[],
                                      const Size& inSz, const Size& outSz, const int lpi, const int l);
+
+template void normalizeRowImpl(neon_tag, const float* in0, const float* in1, const float k0, const float k1,
+                               const float bias, float* out, const int length);
+template void normalizeRowImpl(neon_tag, const float* in0, const float* in1, const float k0, const float k1,
+                               const float bias, uint16_t* out, const int length);
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
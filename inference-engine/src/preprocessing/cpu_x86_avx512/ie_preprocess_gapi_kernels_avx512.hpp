@@ -138,6 +138,15 @@ extern template void calcRowLinear32FC1Impl(avx512_tag, float* dst[], const floa
                                             const float alpha[], const int mapsx[],
                                             const float beta[], const Size& inSz, const Size& outSz,
                                             const int lpi, const int l);
+
+template<typename isa_tag_t, typename T>
+void normalizeRowImpl(isa_tag_t, const float* in0, const float* in1, const float k0, const float k1,
+                      const float bias, T* out, const int length);
+
+extern template void normalizeRowImpl(avx512_tag, const float* in0, const float* in1, const float k0, const float k1,
+                                      const float bias, float* out, const int length);
+extern template void normalizeRowImpl(avx512_tag, const float* in0, const float* in1, const float k0, const float k1,
+                                      const float bias, uint16_t* out, const int length);
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -1291,6 +1291,11 @@ template void calcRowLinear32FC1Impl(sse42_tag, float* dst[], const float* src0[
                                      const float alpha[], const int mapsx[],
                                      const float beta[], const Size& inSz, const Size& outSz,
                                      const int lpi, const int l);
+
+template void normalizeRowImpl(sse42_tag, const float* in0, const float* in1, const float k0, const float k1,
+                               const float bias, float* out, const int length);
+template void normalizeRowImpl(sse42_tag, const float* in0, const float* in1, const float k0, const float k1,
+                               const float bias, uint16_t* out, const int length);
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
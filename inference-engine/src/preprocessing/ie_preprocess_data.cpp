@@ -3,6 +3,7 @@
 //
 
 #include "ie_preprocess_gapi.hpp"
+#include "ie_preprocess_fused.hpp"
 #include "ie_system_conf.h"
 #include "ie_preprocess_data.hpp"
 #include "ie_preprocess_itt.hpp"
@@ -29,6 +30,11 @@ class PreProcessData : public IPreProcessData {
      */
     std::shared_ptr<PreprocEngine> _preproc;
 
+    /**
+     * @brief Fused pre-processing and normalization engine, created on first use.
+     */
+    std::shared_ptr<FusedPreprocEngine> _fusedPreproc;
+
 public:
     void setRoiBlob(const Blob::Ptr &blob) override;
 
@@ -36,6 +42,8 @@ public:
 
     void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial, int batchSize = -1) override;
 
+    bool executeFused(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial, int batchSize = -1) override;
+
     void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) override;
 };
 
@@ -73,6 +81,31 @@ void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &
     _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize);
 }
 
+bool PreProcessData::executeFused(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial,
+        int batchSize) {
+    OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "FusedPreprocessing");
+
+    if (_userBlob == nullptr || preprocessedBlob == nullptr) {
+        IE_THROW() << "Input pre-processing is called with null " << (_userBlob == nullptr ? "_userBlob" : "preprocessedBlob");
+    }
+
+    if (!FusedPreprocEngine::isApplicable(_userBlob, preprocessedBlob, info)) {
+        return false;
+    }
+
+    batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _userBlob);
+    if (static_cast<size_t>(batchSize) > preprocessedBlob->getTensorDesc().getDims()[0]) {
+        return false;
+    }
+
+    if (!_fusedPreproc) {
+        _fusedPreproc.reset(new FusedPreprocEngine);
+    }
+
+    _fusedPreproc->execute(_userBlob, preprocessedBlob, info, serial, batchSize);
+    return true;
+}
+
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
     PreprocEngine::checkApplicabilityGAPI(src, dst);
 }
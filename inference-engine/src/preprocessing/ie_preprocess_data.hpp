@@ -56,6 +56,16 @@ public:
      */
     virtual void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) = 0;
 
+    /**
+     * @brief Executes input pre-processing fused with mean/scale normalization in a single pass over the ROI blob.
+     * @param preprocessedBlob floating point (FP32 or BF16) NCHW blob receiving the normalized network's input.
+     * @param info pre-processing info that specifies resize algorithm, color format and mean/scale values.
+     * @param serial disable OpenMP threading if the value set to true.
+     * @param batchSize batch size for pre-processing.
+     * @return false if fused pre-processing is not applicable, preprocessedBlob is left intact in this case.
+     */
+    virtual bool executeFused(Blob::Ptr &preprocessedBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) = 0;
+
     //FIXME: rename to verifyAplicable
     virtual void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) = 0;
 
@@ -0,0 +1,525 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_preprocess_fused.hpp"
+#include "ie_preprocess_itt.hpp"
+#include "ie_preprocess_gapi_kernels.hpp"
+#include "ie_preprocess_gapi_kernels_impl.hpp"
+
+#if CPU_SIMD
+  #include "ie_system_conf.h"
+
+#ifdef HAVE_AVX512
+  #include "cpu_x86_avx512/ie_preprocess_gapi_kernels_avx512.hpp"
+#endif
+
+#ifdef HAVE_AVX2
+  #include "cpu_x86_avx2/ie_preprocess_gapi_kernels_avx2.hpp"
+#endif
+
+#ifdef HAVE_SSE
+  #include "cpu_x86_sse42/ie_preprocess_gapi_kernels_sse42.hpp"
+#endif
+
+#endif
+
+#ifdef HAVE_NEON
+  #include "arm_neon/ie_preprocess_gapi_kernels_neon.hpp"
+#endif
+
+#include "ie_compound_blob.h"
+#include "ie_parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace InferenceEngine {
+namespace fused_preproc {
+
+using namespace gapi::kernels;
+
+constexpr int CHANNELS = 3;
+
+// scalar versions of the row kernels, used when no SIMD implementation is available
+void nv12ToRgbRowScalar(const uint8_t** y_rows, const uint8_t* uv_row, uint8_t** out_rows, const int width) {
+    for (int i = 0; i < width; i += 2) {
+        int ruv, guv, buv;
+        uvToRGBuv(uv_row[i], uv_row[i + 1], ruv, guv, buv);
+
+        for (int y = 0; y < 2; y++) {
+            for (int x = 0; x < 2; x++) {
+                uchar r, g, b;
+                yRGBuvToRGB(y_rows[y][i + x], ruv, guv, buv, r, g, b);
+
+                out_rows[y][3 * (i + x)] = r;
+                out_rows[y][3 * (i + x) + 1] = g;
+                out_rows[y][3 * (i + x) + 2] = b;
+            }
+        }
+    }
+}
+
+void i420ToRgbRowScalar(const uint8_t** y_rows, const uint8_t* u_row, const uint8_t* v_row,
+                        uint8_t** out_rows, const int width) {
+    for (int i = 0; i < width; i += 2) {
+        int ruv, guv, buv;
+        uvToRGBuv(u_row[i / 2], v_row[i / 2], ruv, guv, buv);
+
+        for (int y = 0; y < 2; y++) {
+            for (int x = 0; x < 2; x++) {
+                uchar r, g, b;
+                yRGBuvToRGB(y_rows[y][i + x], ruv, guv, buv, r, g, b);
+
+                out_rows[y][3 * (i + x)] = r;
+                out_rows[y][3 * (i + x) + 1] = g;
+                out_rows[y][3 * (i + x) + 2] = b;
+            }
+        }
+    }
+}
+
+inline void storeNormalizedScalar(float* out, const float value) {
+    *out = value;
+}
+
+inline void storeNormalizedScalar(uint16_t* out, const float value) {
+    // round to nearest even, the same way as the SIMD kernels do
+    uint32_t u;
+    std::memcpy(&u, &value, sizeof(u));
+    *out = static_cast<uint16_t>((u + 0x7FFF + ((u >> 16) & 1)) >> 16);
+}
+
+template<typename T>
+void normalizeRowScalar(const float* in0, const float* in1, const float k0, const float k1,
+                        const float bias, T* out, const int length) {
+    for (int x = 0; x < length; x++) {
+        storeNormalizedScalar(out + x, in0[x] * k0 + (in1[x] * k1 + bias));
+    }
+}
+
+struct RowKernels {
+    using nv12_f = void (*)(const uint8_t** y_rows, const uint8_t* uv_row, uint8_t** out_rows, const int width);
+    using i420_f = void (*)(const uint8_t** y_rows, const uint8_t* u_row, const uint8_t* v_row,
+                            uint8_t** out_rows, const int width);
+    template<typename T>
+    using normalize_f = void (*)(const float* in0, const float* in1, const float k0, const float k1,
+                                 const float bias, T* out, const int length);
+
+    nv12_f nv12ToRgb;
+    i420_f i420ToRgb;
+    normalize_f<float> normalizeF32;
+    normalize_f<uint16_t> normalizeBF16;
+};
+
+template<typename isa_tag_t>
+RowKernels simdRowKernels() {
+    return RowKernels{
+        [](const uint8_t** y_rows, const uint8_t* uv_row, uint8_t** out_rows, const int width) {
+            nv12ToRgbRowImpl(isa_tag_t{}, y_rows, uv_row, out_rows, width);
+        },
+        [](const uint8_t** y_rows, const uint8_t* u_row, const uint8_t* v_row, uint8_t** out_rows, const int width) {
+            i420ToRgbRowImpl(isa_tag_t{}, y_rows, u_row, v_row, out_rows, width);
+        },
+        [](const float* in0, const float* in1, const float k0, const float k1, const float bias,
+           float* out, const int length) {
+            normalizeRowImpl(isa_tag_t{}, in0, in1, k0, k1, bias, out, length);
+        },
+        [](const float* in0, const float* in1, const float k0, const float k1, const float bias,
+           uint16_t* out, const int length) {
+            normalizeRowImpl(isa_tag_t{}, in0, in1, k0, k1, bias, out, length);
+        }};
+}
+
+RowKernels selectRowKernels() {
+#if CPU_SIMD
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) return simdRowKernels<avx512_tag>();
+#endif
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) return simdRowKernels<avx2_tag>();
+#endif
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) return simdRowKernels<sse42_tag>();
+#endif
+#endif
+#ifdef HAVE_NEON
+    return simdRowKernels<neon_tag>();
+#endif
+    return RowKernels{nv12ToRgbRowScalar, i420ToRgbRowScalar, normalizeRowScalar<float>, normalizeRowScalar<uint16_t>};
+}
+
+const RowKernels& rowKernels() {
+    static const RowKernels kernels = selectRowKernels();
+    return kernels;
+}
+
+// U8 image plane with interleaved channels
+struct Plane {
+    const uint8_t* data;
+    size_t batchStride;
+    size_t rowStride;
+    int width;
+    int height;
+    int channels;
+};
+
+bool isDenseNHWC(const MemoryBlob::Ptr& blob) {
+    const auto& desc = blob->getTensorDesc();
+    if (desc.getPrecision() != Precision::U8 || desc.getLayout() != NHWC || desc.getDims().size() != 4) {
+        return false;
+    }
+    // pixels are expected to be dense, rows and images may be padded (ROI blobs)
+    const auto& strides = desc.getBlockingDesc().getStrides();
+    return strides.size() == 4 && strides[3] == 1 && strides[2] == desc.getDims()[1];
+}
+
+Plane toPlane(const Blob::Ptr& blob) {
+    auto memoryBlob = as<MemoryBlob>(blob);
+    const auto& desc = memoryBlob->getTensorDesc();
+    const auto& dims = desc.getDims();
+    const auto& blkDesc = desc.getBlockingDesc();
+
+    auto data = static_cast<const uint8_t*>(memoryBlob->buffer());
+    if (data == nullptr) {
+        IE_THROW() << "Blob buffer is nullptr";
+    }
+
+    return Plane{data + blkDesc.getOffsetPadding(), blkDesc.getStrides()[0], blkDesc.getStrides()[1],
+                 static_cast<int>(dims[3]), static_cast<int>(dims[2]), static_cast<int>(dims[1])};
+}
+
+bool isApplicableSource(const Blob::Ptr& src, ColorFormat fmt) {
+    if (auto nv12 = as<NV12Blob>(src)) {
+        if (fmt != ColorFormat::NV12) return false;
+        auto y = as<MemoryBlob>(nv12->y());
+        auto uv = as<MemoryBlob>(nv12->uv());
+        if (!y || !uv || !isDenseNHWC(y) || !isDenseNHWC(uv)) return false;
+        const auto& yDims = y->getTensorDesc().getDims();
+        return yDims[1] == 1 && yDims[2] % 2 == 0 && yDims[3] % 2 == 0;
+    }
+    if (auto i420 = as<I420Blob>(src)) {
+        if (fmt != ColorFormat::I420) return false;
+        auto y = as<MemoryBlob>(i420->y());
+        auto u = as<MemoryBlob>(i420->u());
+        auto v = as<MemoryBlob>(i420->v());
+        if (!y || !u || !v || !isDenseNHWC(y) || !isDenseNHWC(u) || !isDenseNHWC(v)) return false;
+        const auto& yDims = y->getTensorDesc().getDims();
+        return yDims[1] == 1 && yDims[2] % 2 == 0 && yDims[3] % 2 == 0;
+    }
+    auto memoryBlob = as<MemoryBlob>(src);
+    if (!memoryBlob || !isDenseNHWC(memoryBlob)) return false;
+
+    const auto channels = memoryBlob->getTensorDesc().getDims()[1];
+    switch (fmt) {
+        case ColorFormat::RAW:
+        case ColorFormat::BGR:
+        case ColorFormat::RGB:  return channels == 3;
+        case ColorFormat::BGRX:
+        case ColorFormat::RGBX: return channels == 4;
+        default:                return false;
+    }
+}
+
+SizeVector sourceDims(const Blob::Ptr& src) {
+    if (auto nv12 = as<NV12Blob>(src)) return nv12->y()->getTensorDesc().getDims();
+    if (auto i420 = as<I420Blob>(src)) return i420->y()->getTensorDesc().getDims();
+    return src->getTensorDesc().getDims();
+}
+
+// bilinear interpolation coefficients of the OpenCV INTER_LINEAR resize
+void fillLinearMap(const int inSz, const int outSz, std::vector<int>& map0, std::vector<int>& map1,
+                   std::vector<float>& alpha) {
+    map0.resize(outSz);
+    map1.resize(outSz);
+    alpha.resize(outSz);
+
+    const double scale = static_cast<double>(inSz) / outSz;
+    for (int i = 0; i < outSz; i++) {
+        const auto f = static_cast<float>((i + 0.5) * scale - 0.5);
+        int s = static_cast<int>(std::floor(f));
+        float a = f - s;
+        if (s < 0) {
+            s = 0;
+            a = 0.f;
+        }
+        if (s >= inSz - 1) {
+            s = inSz - 1;
+            a = 0.f;
+        }
+        map0[i] = s;
+        map1[i] = std::min(s + 1, inSz - 1);
+        alpha[i] = a;
+    }
+}
+
+// Interpolates one U8 row horizontally and splits it into float planes in the network's channel order
+template<int chs>
+void resizeRowHorizontal(const uint8_t* src, const int (&chanIdx)[CHANNELS], const int* map0, const int* map1,
+                         const float* alpha, float* dst, const int outW) {
+    for (int x = 0; x < outW; x++) {
+        const uint8_t* p0 = src + map0[x] * chs;
+        const uint8_t* p1 = src + map1[x] * chs;
+        const float a = alpha[x];
+        for (int c = 0; c < CHANNELS; c++) {
+            const float s0 = p0[chanIdx[c]];
+            const float s1 = p1[chanIdx[c]];
+            dst[c * outW + x] = s0 + a * (s1 - s0);
+        }
+    }
+}
+
+struct Params {
+    Plane planes[3];
+    bool yuv420;
+    bool nv12;
+    int inW, inH;
+    int outW, outH;
+    int pixelStride;
+    int chanIdx[CHANNELS];
+
+    std::vector<int> mapsx0, mapsx1, mapsy0, mapsy1;
+    std::vector<float> alpha, beta;
+
+    float k[CHANNELS];
+    float bias[CHANNELS];
+
+    uint8_t* dst;
+    bool dstBF16;
+    size_t dstBatchStride, dstChannelStride, dstRowStride;
+};
+
+// Per-thread state: source rows converted to RGB and horizontally interpolated rows kept for reuse
+class RowCache {
+    static constexpr int NONE = -1;
+
+    const Params& _p;
+    const RowKernels& _kernels;
+
+    std::vector<uint8_t> _rgb[2];
+    int _rgbKey[2] = {NONE, NONE};  // batch and source row pair which is in _rgb
+
+    std::vector<float> _rows[2];
+    int _rowKey[2][2] = {{NONE, NONE}, {NONE, NONE}};  // batch and source row of each interpolated row
+
+    const uint8_t* sourceRow(const int b, const int row) {
+        const auto& y = _p.planes[0];
+        if (!_p.yuv420) {
+            return y.data + b * y.batchStride + row * y.rowStride;
+        }
+
+        const int pair = row / 2;
+        if (_rgbKey[0] != b || _rgbKey[1] != pair) {
+            const uint8_t* yRows[2] = {y.data + b * y.batchStride + 2 * pair * y.rowStride,
+                                       y.data + b * y.batchStride + (2 * pair + 1) * y.rowStride};
+            uint8_t* outRows[2] = {_rgb[0].data(), _rgb[1].data()};
+            const auto& u = _p.planes[1];
+            if (_p.nv12) {
+                _kernels.nv12ToRgb(yRows, u.data + b * u.batchStride + pair * u.rowStride, outRows, _p.inW);
+            } else {
+                const auto& v = _p.planes[2];
+                _kernels.i420ToRgb(yRows, u.data + b * u.batchStride + pair * u.rowStride,
+                                   v.data + b * v.batchStride + pair * v.rowStride, outRows, _p.inW);
+            }
+            _rgbKey[0] = b;
+            _rgbKey[1] = pair;
+        }
+        return _rgb[row % 2].data();
+    }
+
+    void interpolate(const int b, const int row, float* dst) {
+        const uint8_t* src = sourceRow(b, row);
+        switch (_p.pixelStride) {
+            case 3: resizeRowHorizontal<3>(src, _p.chanIdx, _p.mapsx0.data(), _p.mapsx1.data(),
+                                           _p.alpha.data(), dst, _p.outW); break;
+            case 4: resizeRowHorizontal<4>(src, _p.chanIdx, _p.mapsx0.data(), _p.mapsx1.data(),
+                                           _p.alpha.data(), dst, _p.outW); break;
+            default: IE_THROW() << "Unsupported number of channels: " << _p.pixelStride;
+        }
+    }
+
+public:
+    RowCache(const Params& p, const RowKernels& kernels): _p(p), _kernels(kernels) {
+        if (p.yuv420) {
+            _rgb[0].resize(p.inW * 3);
+            _rgb[1].resize(p.inW * 3);
+        }
+        _rows[0].resize(CHANNELS * p.outW);
+        _rows[1].resize(CHANNELS * p.outW);
+    }
+
+    // returns planar float row of CHANNELS * outW elements, keeping the `keep` row in the cache
+    const float* row(const int b, const int srcRow, const float* keep) {
+        for (int i = 0; i < 2; i++) {
+            if (_rowKey[i][0] == b && _rowKey[i][1] == srcRow) {
+                return _rows[i].data();
+            }
+        }
+        const int slot = (_rows[0].data() == keep) ? 1 : 0;
+        interpolate(b, srcRow, _rows[slot].data());
+        _rowKey[slot][0] = b;
+        _rowKey[slot][1] = srcRow;
+        return _rows[slot].data();
+    }
+};
+
+Params makeParams(const Blob::Ptr& src, const Blob::Ptr& dst, const PreProcessInfo& info) {
+    Params p;
+
+    const auto fmt = info.getColorFormat();
+    p.nv12 = src->is<NV12Blob>();
+    p.yuv420 = p.nv12 || src->is<I420Blob>();
+    if (auto nv12 = as<NV12Blob>(src)) {
+        p.planes[0] = toPlane(nv12->y());
+        p.planes[1] = toPlane(nv12->uv());
+    } else if (auto i420 = as<I420Blob>(src)) {
+        p.planes[0] = toPlane(i420->y());
+        p.planes[1] = toPlane(i420->u());
+        p.planes[2] = toPlane(i420->v());
+    } else {
+        p.planes[0] = toPlane(src);
+    }
+    p.inW = p.planes[0].width;
+    p.inH = p.planes[0].height;
+    p.pixelStride = p.yuv420 ? 3 : p.planes[0].channels;
+
+    // the network expects BGR, color conversion of YUV420 images produces RGB
+    const bool rgb = p.yuv420 || fmt == ColorFormat::RGB || fmt == ColorFormat::RGBX;
+    for (int c = 0; c < CHANNELS; c++) {
+        p.chanIdx[c] = rgb ? CHANNELS - 1 - c : c;
+    }
+
+    auto dstBlob = as<MemoryBlob>(dst);
+    const auto& dstDesc = dstBlob->getTensorDesc();
+    const auto& dstDims = dstDesc.getDims();
+    const auto& dstStrides = dstDesc.getBlockingDesc().getStrides();
+    p.outW = static_cast<int>(dstDims[3]);
+    p.outH = static_cast<int>(dstDims[2]);
+    p.dstBF16 = dstDesc.getPrecision() == Precision::BF16;
+    p.dst = static_cast<uint8_t*>(dstBlob->buffer());
+    if (p.dst == nullptr) {
+        IE_THROW() << "Blob buffer is nullptr";
+    }
+    p.dst += dstBlob->element_size() * dstDesc.getBlockingDesc().getOffsetPadding();
+    p.dstBatchStride = dstStrides[0] * dstBlob->element_size();
+    p.dstChannelStride = dstStrides[1] * dstBlob->element_size();
+    p.dstRowStride = dstStrides[2] * dstBlob->element_size();
+
+    fillLinearMap(p.inW, p.outW, p.mapsx0, p.mapsx1, p.alpha);
+    fillLinearMap(p.inH, p.outH, p.mapsy0, p.mapsy1, p.beta);
+
+    for (int c = 0; c < CHANNELS; c++) {
+        float mean = 0.f;
+        float scale = 1.f;
+        if (info.getMeanVariant() == MEAN_VALUE) {
+            mean = info[c]->meanValue;
+            scale = info[c]->stdScale;
+        }
+        p.k[c] = 1.f / scale;
+        p.bias[c] = -mean / scale;
+    }
+
+    return p;
+}
+
+}  // namespace fused_preproc
+
+bool FusedPreprocEngine::isApplicable(const Blob::Ptr& src, const Blob::Ptr& dst, const PreProcessInfo& info) {
+    using namespace fused_preproc;
+
+    const auto algorithm = info.getResizeAlgorithm();
+    if (algorithm != NO_RESIZE && algorithm != RESIZE_BILINEAR) {
+        return false;
+    }
+
+    switch (info.getMeanVariant()) {
+        case NONE: break;
+        case MEAN_VALUE:
+            if (info.getNumberOfChannels() != CHANNELS) return false;
+            for (int c = 0; c < CHANNELS; c++) {
+                if (info[c]->stdScale == 0.f) return false;
+            }
+            break;
+        default: return false;
+    }
+
+    auto dstBlob = as<MemoryBlob>(dst);
+    if (!dstBlob) return false;
+    const auto& dstDesc = dstBlob->getTensorDesc();
+    const auto& dstDims = dstDesc.getDims();
+    const auto precision = dstDesc.getPrecision();
+    if ((precision != Precision::FP32 && precision != Precision::BF16) || dstDesc.getLayout() != NCHW ||
+        dstDims.size() != 4 || dstDims[1] != CHANNELS || dstDesc.getBlockingDesc().getStrides()[3] != 1) {
+        return false;
+    }
+
+    if (!src || !isApplicableSource(src, info.getColorFormat())) {
+        return false;
+    }
+
+    const auto srcDims = sourceDims(src);
+    if (std::find(srcDims.begin(), srcDims.end(), 0) != srcDims.end() ||
+        std::find(dstDims.begin(), dstDims.end(), 0) != dstDims.end()) {
+        return false;
+    }
+
+    return algorithm != NO_RESIZE || (srcDims[2] == dstDims[2] && srcDims[3] == dstDims[3]);
+}
+
+void FusedPreprocEngine::execute(const Blob::Ptr& src, const Blob::Ptr& dst, const PreProcessInfo& info,
+                                 bool omp_serial, int batch_size) {
+    using namespace fused_preproc;
+
+    if (!isApplicable(src, dst, info)) {
+        IE_THROW() << "Fused pre-processing is not applicable for the given blobs";
+    }
+
+    const auto p = makeParams(src, dst, info);
+    const auto& kernels = rowKernels();
+    const size_t totalRows = static_cast<size_t>(batch_size) * p.outH;
+
+    const int thread_num =
+#if IE_THREAD == IE_THREAD_OMP
+        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+#endif
+        0;                  // use all available threads
+
+    // to suppress unused warnings
+    (void)(omp_serial);
+
+    parallel_nt_static(thread_num, [&, this](int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(totalRows, nthr, ithr, start, end);
+        if (start >= end) return;  // no job for current thread
+
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
+
+        RowCache cache(p, kernels);
+        for (size_t i = start; i < end; i++) {
+            const int b = static_cast<int>(i / p.outH);
+            const int y = static_cast<int>(i % p.outH);
+
+            const float* row0 = cache.row(b, p.mapsy0[y], nullptr);
+            const float* row1 = cache.row(b, p.mapsy1[y], row0);
+            const float beta = p.beta[y];
+
+            uint8_t* out = p.dst + b * p.dstBatchStride + y * p.dstRowStride;
+            for (int c = 0; c < CHANNELS; c++) {
+                const float* in0 = row0 + c * p.outW;
+                const float* in1 = row1 + c * p.outW;
+                const float k0 = (1.f - beta) * p.k[c];
+                const float k1 = beta * p.k[c];
+                uint8_t* outPlane = out + c * p.dstChannelStride;
+                if (p.dstBF16) {
+                    kernels.normalizeBF16(in0, in1, k0, k1, p.bias[c], reinterpret_cast<uint16_t*>(outPlane), p.outW);
+                } else {
+                    kernels.normalizeF32(in0, in1, k0, k1, p.bias[c], reinterpret_cast<float*>(outPlane), p.outW);
+                }
+            }
+        }
+    });
+}
+
+}  // namespace InferenceEngine
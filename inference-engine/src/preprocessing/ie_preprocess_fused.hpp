@@ -0,0 +1,38 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_blob.h"
+#include "ie_preprocess.hpp"
+
+#include <openvino/itt.hpp>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Single pass pre-processing of U8 images into the normalized floating point network input.
+ *
+ * Every output row is produced from the source rows it depends on: color conversion of NV12/I420 rows,
+ * bilinear interpolation, mean/scale normalization and conversion to FP32 or BF16 are done on a few rows
+ * kept in cache, so the input image is read once and the output blob is written once. The work is split
+ * between threads by output rows.
+ */
+class FusedPreprocEngine {
+    openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Fused Preproc Calc Tile");
+
+public:
+    /**
+     * @brief Checks whether the fused pre-processing supports given blobs and pre-processing info:
+     *        - source is NV12Blob, I420Blob or U8 NHWC blob of 3 (BGR, RGB) or 4 (BGRX, RGBX) channels
+     *        - destination is FP32 or BF16 NCHW blob of 3 channels in BGR order
+     *        - resize algorithm is NO_RESIZE or RESIZE_BILINEAR, mean variant is NONE or MEAN_VALUE
+     */
+    static bool isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst, const PreProcessInfo &info);
+
+    void execute(const Blob::Ptr &src, const Blob::Ptr &dst, const PreProcessInfo &info, bool omp_serial,
+                 int batch_size);
+};
+
+}  // namespace InferenceEngine
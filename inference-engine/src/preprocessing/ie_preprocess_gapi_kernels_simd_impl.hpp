@@ -6,6 +6,7 @@
 #define IE_PREPROCESS_GAPI_KERNELS_SIMD_IMPL_H
 
 #include <algorithm>
+#include <cstring>
 #include <utility>
 
 #include "ie_preprocess_gapi_kernels_impl.hpp"
@@ -707,6 +708,66 @@ CV_ALWAYS_INLINE void calcRowLinear32FC1Impl(isa_tag_t,
     }
 }
 
+//------------------------------------------------------------------------------
+// Fused pre-processing: vertical interpolation of two horizontally resized rows and
+// mean/scale normalization, coefficients are premultiplied by the scale:
+// out[x] = in0[x] * k0 + in1[x] * k1 + bias
+
+CV_ALWAYS_INLINE void storeNormalized(float* out, const float v) {
+    *out = v;
+}
+
+// BF16 is the upper half of FP32 rounded to nearest even
+CV_ALWAYS_INLINE void storeNormalized(uint16_t* out, const float v) {
+    uint32_t u;
+    std::memcpy(&u, &v, sizeof(u));
+    *out = static_cast<uint16_t>((u + 0x7FFF + ((u >> 16) & 1)) >> 16);
+}
+
+#if MANUAL_SIMD
+CV_ALWAYS_INLINE void storeNormalized(float* out, const v_float32& v0, const v_float32& v1) {
+    v_store(out, v0);
+    v_store(out + v_float32::nlanes, v1);
+}
+
+CV_ALWAYS_INLINE void storeNormalized(uint16_t* out, const v_float32& v0, const v_float32& v1) {
+    const v_uint32 round = vx_setall_u32(0x7FFF);
+    const v_uint32 one = vx_setall_u32(1);
+
+    v_uint32 u0 = v_reinterpret_as_u32(v0);
+    v_uint32 u1 = v_reinterpret_as_u32(v1);
+    u0 = (u0 + round + ((u0 >> 16) & one)) >> 16;
+    u1 = (u1 + round + ((u1 >> 16) & one)) >> 16;
+
+    v_store(out, v_pack(u0, u1));
+}
+#endif
+
+template<typename isa_tag_t, typename T>
+CV_ALWAYS_INLINE void normalizeRowImpl(isa_tag_t, const float* in0, const float* in1,
+                                       const float k0, const float k1, const float bias,
+                                       T* out, const int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    constexpr int nlanes = v_float32::nlanes;
+
+    const v_float32 vk0 = vx_setall_f32(k0);
+    const v_float32 vk1 = vx_setall_f32(k1);
+    const v_float32 vbias = vx_setall_f32(bias);
+
+    for (; x <= length - 2 * nlanes; x += 2 * nlanes) {
+        v_float32 r0 = v_fma(vx_load(&in0[x]), vk0, v_fma(vx_load(&in1[x]), vk1, vbias));
+        v_float32 r1 = v_fma(vx_load(&in0[x + nlanes]), vk0, v_fma(vx_load(&in1[x + nlanes]), vk1, vbias));
+        storeNormalized(&out[x], r0, r1);
+    }
+#endif
+
+    for (; x < length; ++x) {
+        storeNormalized(&out[x], in0[x] * k0 + (in1[x] * k1 + bias));
+    }
+}
+
 template<typename isa_tag_t, typename scalar_t>
 struct vector_type_of;
 
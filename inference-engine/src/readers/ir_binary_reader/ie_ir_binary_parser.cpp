@@ -0,0 +1,528 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_ir_binary_parser.hpp"
+#include "ie_ir_binary_itt.hpp"
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <ngraph/ngraph.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <ngraph/op/util/variable.hpp>
+#include <ngraph/ops.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/opsets/opset7.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
+#include <ngraph/variant.hpp>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <transformations/ir_binary_format.hpp>
+
+namespace ir_binary = ngraph::pass::ir_binary;
+
+namespace InferenceEngine {
+
+namespace {
+
+/// \brief Bounds checked cursor over a section of the binary IR container
+class BinaryReader {
+public:
+    BinaryReader(const uint8_t* data, size_t size) : m_ptr(data), m_end(data + size) {}
+
+    template <class T>
+    T read() {
+        T value;
+        std::memcpy(&value, skip(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    template <class T>
+    std::vector<T> read_vector() {
+        const auto count = read_count<uint64_t>(sizeof(T));
+        std::vector<T> values(count);
+        std::memcpy(values.data(), skip(count * sizeof(T)), count * sizeof(T));
+        return values;
+    }
+
+    /// \brief Reads the number of the following records and checks that the remaining data can hold them
+    /// \param record_size the minimal size of one record in bytes
+    template <class T>
+    size_t read_count(size_t record_size) {
+        const auto count = read<T>();
+        if (count > remaining() / record_size)
+            IE_THROW() << "Incorrect binary IR: " << count << " records are out of bounds";
+        return static_cast<size_t>(count);
+    }
+
+    const uint8_t* skip(size_t size) {
+        if (size > remaining())
+            IE_THROW() << "Incorrect binary IR: unexpected end of data";
+        const auto ptr = m_ptr;
+        m_ptr += size;
+        return ptr;
+    }
+
+    size_t remaining() const {
+        return static_cast<size_t>(m_end - m_ptr);
+    }
+
+private:
+    const uint8_t* m_ptr;
+    const uint8_t* m_end;
+};
+
+struct BinaryAttribute {
+    ir_binary::AttributeKind kind;
+    const uint8_t* data;
+    size_t size;
+};
+
+using BinaryAttributes = std::unordered_map<std::string, BinaryAttribute>;
+
+class FunctionBuilder {
+public:
+    FunctionBuilder(const Blob::CPtr& container,
+                    std::vector<std::string> strings,
+                    const std::unordered_map<std::string, ngraph::OpSet>& opsets)
+        : container(container), strings(std::move(strings)), opsets(opsets) {}
+
+    std::shared_ptr<ngraph::Function> parseFunction(BinaryReader& reader);
+
+    const std::string& getString(uint32_t index) const {
+        if (index >= strings.size())
+            IE_THROW() << "Incorrect binary IR: string index " << index << " is out of bounds";
+        return strings[index];
+    }
+
+    std::shared_ptr<ngraph::Variable> getVariable(const std::string& variable_id) {
+        auto& variable = variables[variable_id];
+        if (!variable) {
+            variable = std::make_shared<ngraph::Variable>(ngraph::VariableInfo{
+                ngraph::PartialShape::dynamic(), ngraph::element::dynamic, variable_id});
+        }
+        return variable;
+    }
+
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> getData(uint64_t offset, uint64_t size) const {
+        const auto byteSize = static_cast<uint64_t>(container->byteSize());
+        if (offset > byteSize || size > byteSize - offset)
+            IE_THROW() << "Incorrect binary IR: weights are out of bounds of the file";
+
+        char* data = container->cbuffer().as<char*>() + offset;
+        using SharedBuffer = ngraph::runtime::SharedBuffer<const Blob::CPtr>;
+        return std::make_shared<SharedBuffer>(data, size, container);
+    }
+
+private:
+    std::shared_ptr<ngraph::Node> createNode(const std::string& type,
+                                             const std::string& version,
+                                             const std::string& name,
+                                             const ngraph::OutputVector& inputs,
+                                             const BinaryAttributes& attributes);
+
+    const Blob::CPtr& container;
+    const std::vector<std::string> strings;
+    const std::unordered_map<std::string, ngraph::OpSet>& opsets;
+    std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>> variables;
+};
+
+class BinaryDeserializer : public ngraph::AttributeVisitor {
+public:
+    BinaryDeserializer(FunctionBuilder& builder, const BinaryAttributes& attributes)
+        : builder(builder), attributes(attributes) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        const auto attribute = find(name);
+        if (!attribute) return;
+        BinaryReader reader(attribute->data, attribute->size);
+
+        if (auto a = ngraph::as_type<ngraph::AttributeAdapter<
+                std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::InputDescription>>>>(&adapter)) {
+            check(name, *attribute, ir_binary::AttributeKind::InputDescriptions);
+            a->set(parseInputDescriptions(reader));
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<
+                       std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::OutputDescription>>>>(&adapter)) {
+            check(name, *attribute, ir_binary::AttributeKind::OutputDescriptions);
+            a->set(parseOutputDescriptions(reader));
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            check(name, *attribute, ir_binary::AttributeKind::SpecialBodyPorts);
+            ngraph::op::v5::Loop::SpecialBodyPorts ports;
+            ports.current_iteration_input_idx = reader.read<int64_t>();
+            ports.body_condition_output_idx = reader.read<int64_t>();
+            a->set(ports);
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            check(name, *attribute, ir_binary::AttributeKind::Variable);
+            a->set(builder.getVariable(builder.getString(reader.read<uint32_t>())));
+        } else if (auto a = ngraph::as_type<
+                       ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            check(name, *attribute, ir_binary::AttributeKind::Data);
+            const auto offset = reader.read<uint64_t>();
+            const auto size = reader.read<uint64_t>();
+            a->set(builder.getData(offset, size));
+        } else {
+            IE_THROW() << "Error binary IR reading. Attribute adapter can not be found for " << name
+                       << " parameter";
+        }
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        const auto attribute = find(name);
+        if (!attribute) return;
+        BinaryReader reader(attribute->data, attribute->size);
+
+        if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::element::Type>>(&adapter)) {
+            check(name, *attribute, ir_binary::AttributeKind::ElementType);
+            const auto type = reader.read<uint32_t>();
+            if (type > static_cast<uint32_t>(ngraph::element::Type_t::u64))
+                IE_THROW() << "Incorrect binary IR: attribute " << name << " has unknown element type " << type;
+            static_cast<ngraph::element::Type&>(*a) = ngraph::element::Type(static_cast<ngraph::element::Type_t>(type));
+            return;
+        }
+        check(name, *attribute, ir_binary::AttributeKind::String);
+        adapter.set(builder.getString(reader.read<uint32_t>()));
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        if (const auto attribute = find(name, ir_binary::AttributeKind::Bool))
+            adapter.set(BinaryReader(attribute->data, attribute->size).read<uint8_t>() != 0);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        if (const auto attribute = find(name, ir_binary::AttributeKind::Int64))
+            adapter.set(BinaryReader(attribute->data, attribute->size).read<int64_t>());
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        if (const auto attribute = find(name, ir_binary::AttributeKind::Double))
+            adapter.set(BinaryReader(attribute->data, attribute->size).read<double>());
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        if (const auto attribute = find(name, ir_binary::AttributeKind::I32Vector))
+            adapter.set(BinaryReader(attribute->data, attribute->size).read_vector<int32_t>());
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        if (const auto attribute = find(name, ir_binary::AttributeKind::I64Vector))
+            adapter.set(BinaryReader(attribute->data, attribute->size).read_vector<int64_t>());
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        if (const auto attribute = find(name, ir_binary::AttributeKind::U64Vector))
+            adapter.set(BinaryReader(attribute->data, attribute->size).read_vector<uint64_t>());
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        if (const auto attribute = find(name, ir_binary::AttributeKind::FloatVector))
+            adapter.set(BinaryReader(attribute->data, attribute->size).read_vector<float>());
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        const auto attribute = find(name, ir_binary::AttributeKind::StringVector);
+        if (!attribute) return;
+        BinaryReader reader(attribute->data, attribute->size);
+        std::vector<std::string> value(reader.read_count<uint64_t>(sizeof(uint32_t)));
+        for (auto& str : value)
+            str = builder.getString(reader.read<uint32_t>());
+        adapter.set(value);
+    }
+
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        const auto attribute = find(name, ir_binary::AttributeKind::Function);
+        if (!attribute) return;
+        BinaryReader reader(attribute->data, attribute->size);
+        adapter.set(builder.parseFunction(reader));
+    }
+
+private:
+    const BinaryAttribute* find(const std::string& name) const {
+        const auto found = attributes.find(name);
+        return found == attributes.end() ? nullptr : &found->second;
+    }
+
+    const BinaryAttribute* find(const std::string& name, ir_binary::AttributeKind kind) const {
+        const auto attribute = find(name);
+        if (attribute)
+            check(name, *attribute, kind);
+        return attribute;
+    }
+
+    static void check(const std::string& name, const BinaryAttribute& attribute, ir_binary::AttributeKind kind) {
+        if (attribute.kind != kind)
+            IE_THROW() << "Incorrect binary IR: attribute " << name << " has unexpected type "
+                       << static_cast<int>(attribute.kind);
+    }
+
+    std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::InputDescription>>
+    parseInputDescriptions(BinaryReader& reader) {
+        using SubGraphOp = ngraph::op::util::SubGraphOp;
+        std::vector<std::shared_ptr<SubGraphOp::InputDescription>> inputs(
+            reader.read_count<uint64_t>(sizeof(ir_binary::InputDescriptionKind) + 2 * sizeof(uint64_t)));
+        for (auto& input : inputs) {
+            const auto kind = reader.read<ir_binary::InputDescriptionKind>();
+            const auto input_index = reader.read<uint64_t>();
+            const auto body_parameter_index = reader.read<uint64_t>();
+            switch (kind) {
+            case ir_binary::InputDescriptionKind::Slice: {
+                const auto start = reader.read<int64_t>();
+                const auto stride = reader.read<int64_t>();
+                const auto part_size = reader.read<int64_t>();
+                const auto end = reader.read<int64_t>();
+                const auto axis = reader.read<int64_t>();
+                input = std::make_shared<SubGraphOp::SliceInputDescription>(
+                    input_index, body_parameter_index, start, stride, part_size, end, axis);
+                break;
+            }
+            case ir_binary::InputDescriptionKind::Merged:
+                input = std::make_shared<SubGraphOp::MergedInputDescription>(
+                    input_index, body_parameter_index, reader.read<uint64_t>());
+                break;
+            case ir_binary::InputDescriptionKind::Invariant:
+                input = std::make_shared<SubGraphOp::InvariantInputDescription>(input_index, body_parameter_index);
+                break;
+            default:
+                IE_THROW() << "Incorrect binary IR: unknown input description type " << static_cast<int>(kind);
+            }
+        }
+        return inputs;
+    }
+
+    std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::OutputDescription>>
+    parseOutputDescriptions(BinaryReader& reader) {
+        using SubGraphOp = ngraph::op::util::SubGraphOp;
+        std::vector<std::shared_ptr<SubGraphOp::OutputDescription>> outputs(
+            reader.read_count<uint64_t>(sizeof(ir_binary::OutputDescriptionKind) + 2 * sizeof(uint64_t)));
+        for (auto& output : outputs) {
+            const auto kind = reader.read<ir_binary::OutputDescriptionKind>();
+            const auto body_value_index = reader.read<uint64_t>();
+            const auto output_index = reader.read<uint64_t>();
+            switch (kind) {
+            case ir_binary::OutputDescriptionKind::Concat: {
+                const auto start = reader.read<int64_t>();
+                const auto stride = reader.read<int64_t>();
+                const auto part_size = reader.read<int64_t>();
+                const auto end = reader.read<int64_t>();
+                const auto axis = reader.read<int64_t>();
+                output = std::make_shared<SubGraphOp::ConcatOutputDescription>(
+                    body_value_index, output_index, start, stride, part_size, end, axis);
+                break;
+            }
+            case ir_binary::OutputDescriptionKind::Body:
+                output = std::make_shared<SubGraphOp::BodyOutputDescription>(
+                    body_value_index, output_index, reader.read<int64_t>());
+                break;
+            default:
+                IE_THROW() << "Incorrect binary IR: unknown output description type " << static_cast<int>(kind);
+            }
+        }
+        return outputs;
+    }
+
+    FunctionBuilder& builder;
+    const BinaryAttributes& attributes;
+};
+
+std::shared_ptr<ngraph::Function> FunctionBuilder::parseFunction(BinaryReader& reader) {
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::IRBinaryReader_RT, "IRBinaryParser", "Parse");
+
+    const auto& functionName = getString(reader.read<uint32_t>());
+    // type, opset, name and counts of inputs, outputs, attributes and runtime info
+    const auto layersCount = reader.read_count<uint32_t>(7 * sizeof(uint32_t));
+
+    std::vector<std::shared_ptr<ngraph::Node>> layers;
+    layers.reserve(layersCount);
+    auto getLayer = [&layers](uint32_t id) -> const std::shared_ptr<ngraph::Node>& {
+        if (id >= layers.size())
+            IE_THROW() << "Incorrect binary IR: attempt to access layer " << id << " which is not created yet";
+        return layers[id];
+    };
+
+    std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
+
+    // Layers are stored in topological order, so every input refers to an already created layer
+    for (size_t layerId = 0; layerId < layersCount; ++layerId) {
+        const auto& type = getString(reader.read<uint32_t>());
+        const auto& version = getString(reader.read<uint32_t>());
+        const auto& name = getString(reader.read<uint32_t>());
+
+        ngraph::OutputVector inputs(reader.read_count<uint32_t>(2 * sizeof(uint32_t)));
+        for (auto& input : inputs) {
+            const auto& source = getLayer(reader.read<uint32_t>());
+            const auto port = reader.read<uint32_t>();
+            if (port >= source->get_output_size())
+                IE_THROW() << type << " layer " << name << " with id: " << layerId
+                           << " refers to the absent output " << port << " of " << source->get_friendly_name();
+            input = source->output(port);
+        }
+
+        std::vector<std::unordered_set<std::string>> outputNames(reader.read_count<uint32_t>(sizeof(uint32_t)));
+        for (auto& names : outputNames) {
+            const auto namesCount = reader.read_count<uint32_t>(sizeof(uint32_t));
+            for (size_t i = 0; i < namesCount; ++i)
+                names.insert(getString(reader.read<uint32_t>()));
+        }
+
+        BinaryAttributes attributes;
+        const auto attributesCount =
+            reader.read_count<uint32_t>(sizeof(uint32_t) + sizeof(ir_binary::AttributeKind) + sizeof(uint64_t));
+        for (size_t i = 0; i < attributesCount; ++i) {
+            const auto& attributeName = getString(reader.read<uint32_t>());
+            const auto kind = reader.read<ir_binary::AttributeKind>();
+            const auto size = reader.read<uint64_t>();
+            attributes[attributeName] = {kind, reader.skip(size), size};
+        }
+
+        auto node = createNode(type, version, name, inputs, attributes);
+
+        auto& rtInfo = node->get_rt_info();
+        const auto rtInfoCount = reader.read_count<uint32_t>(2 * sizeof(uint32_t));
+        for (size_t i = 0; i < rtInfoCount; ++i) {
+            const auto& key = getString(reader.read<uint32_t>());
+            const auto& value = getString(reader.read<uint32_t>());
+            rtInfo[key] = std::make_shared<::ngraph::VariantWrapper<std::string>>(value);
+        }
+
+        node->set_friendly_name(name);
+        for (size_t i = 0; i < outputNames.size() && i < node->get_output_size(); ++i) {
+            if (!outputNames[i].empty())
+                node->get_output_tensor(i).set_names(outputNames[i]);
+        }
+
+        if (const auto& read_value = std::dynamic_pointer_cast<ngraph::op::ReadValueBase>(node)) {
+            variable_id_to_read_value[read_value->get_variable_id()] = read_value;
+        }
+
+        layers.emplace_back(node);
+    }
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphFunction");
+
+    ngraph::ParameterVector parameters(reader.read_count<uint32_t>(sizeof(uint32_t)));
+    for (auto& parameter : parameters) {
+        parameter = ngraph::as_type_ptr<ngraph::op::Parameter>(getLayer(reader.read<uint32_t>()));
+        if (!parameter)
+            IE_THROW() << "Incorrect binary IR: function " << functionName << " parameter is not a Parameter layer";
+    }
+    ngraph::ResultVector results(reader.read_count<uint32_t>(sizeof(uint32_t)));
+    for (auto& result : results) {
+        result = ngraph::as_type_ptr<ngraph::op::Result>(getLayer(reader.read<uint32_t>()));
+        if (!result)
+            IE_THROW() << "Incorrect binary IR: function " << functionName << " result is not a Result layer";
+    }
+    ngraph::SinkVector sinks(reader.read_count<uint32_t>(sizeof(uint32_t)));
+    for (auto& sink : sinks) {
+        sink = std::dynamic_pointer_cast<ngraph::op::Sink>(getLayer(reader.read<uint32_t>()));
+        if (!sink)
+            IE_THROW() << "Incorrect binary IR: function " << functionName << " sink is not a Sink layer";
+    }
+
+    auto function = std::make_shared<ngraph::Function>(results, sinks, parameters, functionName);
+    for (const auto& sink : sinks) {
+        if (const auto& assign = std::dynamic_pointer_cast<ngraph::op::AssignBase>(sink)) {
+            assign->add_control_dependency(variable_id_to_read_value.at(assign->get_variable_id()));
+        }
+    }
+
+    return function;
+}
+
+std::shared_ptr<ngraph::Node> FunctionBuilder::createNode(const std::string& type,
+                                                          const std::string& version,
+                                                          const std::string& name,
+                                                          const ngraph::OutputVector& inputs,
+                                                          const BinaryAttributes& attributes) {
+    auto opsetIt = opsets.find(version);
+    if (opsetIt == opsets.end())
+        IE_THROW() << "Cannot create " << type << " layer " << name << " from unsupported opset: " << version;
+
+    auto ngraphNode = std::shared_ptr<ngraph::Node>(opsetIt->second.create_insensitive(type));
+    if (!ngraphNode)
+        IE_THROW() << "Opset " << version << " doesn't contain the operation with type: " << type;
+
+    // Share weights from the container blob
+    if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(ngraphNode)) {
+        constant->alloc_buffer_on_visit_attributes(false);
+    }
+    ngraphNode->set_arguments(inputs);
+    BinaryDeserializer visitor(*this, attributes);
+    if (ngraphNode->visit_attributes(visitor)) {
+        ngraphNode->constructor_validate_and_infer_types();
+    }
+
+    // To be sure that all default values will be initialized:
+    return ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
+}
+
+}  // namespace
+
+IRBinaryParser::IRBinaryParser(const std::vector<IExtensionPtr>& exts) : _exts(exts) {
+    // Load default opsets
+    opsets["opset1"] = ngraph::get_opset1();
+    opsets["opset2"] = ngraph::get_opset2();
+    opsets["opset3"] = ngraph::get_opset3();
+    opsets["opset4"] = ngraph::get_opset4();
+    opsets["opset5"] = ngraph::get_opset5();
+    opsets["opset6"] = ngraph::get_opset6();
+    opsets["opset7"] = ngraph::get_opset7();
+
+    // Load custom opsets
+    for (const auto& ext : exts) {
+        for (const auto& it : ext->getOpSets()) {
+            if (opsets.find(it.first) != opsets.end())
+                IE_THROW() << "Cannot add opset with name: " << it.first
+                           << ". Opset with the same name already exists.";
+            opsets[it.first] = it.second;
+        }
+    }
+}
+
+CNNNetwork IRBinaryParser::parse(const Blob::CPtr& container) {
+    const auto data = container->cbuffer().as<const uint8_t*>();
+    const auto size = static_cast<uint64_t>(container->byteSize());
+
+    ir_binary::Header header;
+    if (size < sizeof(header))
+        IE_THROW() << "Incorrect binary IR: file is too small";
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, ir_binary::magic, sizeof(header.magic)) != 0)
+        IE_THROW() << "Incorrect binary IR: wrong file signature";
+    if (header.version != ir_binary::format_version)
+        IE_THROW() << "Unsupported binary IR version: " << header.version;
+
+    auto getSection = [&](uint64_t offset, uint64_t sectionSize) {
+        if (offset > size || sectionSize > size - offset)
+            IE_THROW() << "Incorrect binary IR: section is out of bounds of the file";
+        return BinaryReader(data + offset, sectionSize);
+    };
+    getSection(header.weights_offset, header.weights_size);
+
+    std::vector<std::string> strings;
+    {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IRBinaryReader_RT, "ReadStringTable");
+        auto reader = getSection(header.strings_offset, header.strings_size);
+        const auto count = reader.read_count<uint32_t>(sizeof(uint32_t));
+        strings.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            const auto length = reader.read<uint32_t>();
+            strings.emplace_back(reinterpret_cast<const char*>(reader.skip(length)), length);
+        }
+    }
+
+    FunctionBuilder builder(container, std::move(strings), opsets);
+    auto reader = getSection(header.topology_offset, header.topology_size);
+    auto function = builder.parseFunction(reader);
+
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IRBinaryReader_RT, "ConstructCNNNetwork");
+
+    return CNNNetwork(function, _exts);
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,36 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/opsets/opset.hpp>
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_blob.h>
+#include <ie_iextension.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Builds nGraph function from the binary IR container
+ *
+ * Operations are created from the registered opsets and their attributes are assigned from
+ * typed binary records, constants share memory of the container blob.
+ */
+class IRBinaryParser {
+public:
+    explicit IRBinaryParser(const std::vector<IExtensionPtr>& exts);
+
+    CNNNetwork parse(const Blob::CPtr& container);
+
+private:
+    std::unordered_map<std::string, ngraph::OpSet> opsets;
+    const std::vector<IExtensionPtr> _exts;
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,74 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_ir_binary_reader.hpp>
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <transformations/ir_binary_format.hpp>
+
+#include "ie_ir_binary_parser.hpp"
+#include "ie_ir_binary_itt.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+bool hasBinaryIRMagic(const void* data, size_t size) {
+    const auto& magic = ngraph::pass::ir_binary::magic;
+    return size >= sizeof(magic) && std::memcmp(data, magic, sizeof(magic)) == 0;
+}
+
+}  // namespace
+
+bool IRBinaryReader::supportModel(std::istream& model) const {
+    OV_ITT_SCOPED_TASK(itt::domains::IRBinaryReader, "IRBinaryReader::supportModel");
+
+    std::array<char, sizeof(ngraph::pass::ir_binary::magic)> header = {};
+
+    model.seekg(0, model.beg);
+    model.read(header.data(), header.size());
+    const auto readSize = static_cast<size_t>(model.gcount());
+    model.clear();
+    model.seekg(0, model.beg);
+
+    return hasBinaryIRMagic(header.data(), readSize);
+}
+
+CNNNetwork IRBinaryReader::read(std::istream& model, const std::vector<IExtensionPtr>& exts) const {
+    OV_ITT_SCOPED_TASK(itt::domains::IRBinaryReader, "IRBinaryReader::read");
+
+    model.seekg(0, model.end);
+    const auto size = static_cast<size_t>(model.tellg());
+    model.seekg(0, model.beg);
+
+    Blob::Ptr container = make_shared_blob<uint8_t>({Precision::U8, { size }, C });
+    container->allocate();
+    model.read(container->buffer(), size);
+    if (static_cast<size_t>(model.gcount()) != size)
+        IE_THROW() << "Failed to read binary IR model";
+
+    IRBinaryParser parser(exts);
+    return parser.parse(container);
+}
+
+CNNNetwork IRBinaryReader::read(std::istream& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts) const {
+    // The whole container is passed as weights when the model is read from file,
+    // otherwise the weights blob was given explicitly and the model stream contains the container
+    if (!weights || !hasBinaryIRMagic(weights->cbuffer().as<const uint8_t*>(), weights->byteSize()))
+        return read(model, exts);
+
+    OV_ITT_SCOPED_TASK(itt::domains::IRBinaryReader, "IRBinaryReader::read");
+
+    IRBinaryParser parser(exts);
+    return parser.parse(weights);
+}
+
+INFERENCE_PLUGIN_API(void) InferenceEngine::CreateReader(std::shared_ptr<IReader>& reader) {
+    reader = std::make_shared<IRBinaryReader>();
+}
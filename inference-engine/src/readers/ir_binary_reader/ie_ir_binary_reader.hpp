@@ -0,0 +1,57 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_api.h>
+#include <ie_blob.h>
+#include <ie_common.h>
+#include <ie_iextension.h>
+
+#include <ie_reader.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief This class reads a network from the binary IR container produced by
+ * ngraph::pass::Serialize with Version::IR_BINARY
+ *
+ * Topology and weights are stored in the same file, so the file itself is reported as the data file:
+ * it is loaded (or memory mapped) by the Core and passed as the weights blob which is parsed in place.
+ */
+class IRBinaryReader: public IReader {
+public:
+    /**
+     * @brief Checks that reader supports format of the model
+     * @param model stream with model
+     * @return true if format is supported
+     */
+    bool supportModel(std::istream& model) const override;
+    /**
+     * @brief Reads the model to CNNNetwork
+     * @param model stream with model
+     * @param exts vector with extensions
+     *
+     * @return CNNNetwork
+     */
+    CNNNetwork read(std::istream& model, const std::vector<IExtensionPtr>& exts) const override;
+    /**
+     * @brief Reads the model to CNNNetwork
+     * @param model stream with model
+     * @param weights blob with the whole binary IR container, the model stream is used if it is empty
+     * @param exts vector with extensions
+     *
+     * @return CNNNetwork
+     */
+    CNNNetwork read(std::istream& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts) const override;
+
+    std::vector<std::string> getDataFileExtensions() const override {
+        return {"irb"};
+    }
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,83 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Layout of the binary IR container written by ngraph::pass::Serialize with
+ * Version::IR_BINARY and loaded by the binary IR reader.
+ *
+ * The container is a single file which can be memory mapped as a whole:
+ *
+ *   Header | weights (each blob aligned to weights_alignment) | topology | string table
+ *
+ * All values are stored in the native (little-endian) byte order without any padding:
+ * - string table: uint32 count, then count records of uint32 length followed by the characters;
+ *   strings are referenced from the topology by their uint32 index in the table;
+ * - function: uint32 name, uint32 layers count, layers in topological order, then uint32 count
+ *   followed by uint32 layer indices for parameters, results and sinks;
+ * - layer: uint32 type, uint32 opset, uint32 name, uint32 inputs count followed by
+ *   (uint32 source layer, uint32 source output) pairs, uint32 outputs count followed by the
+ *   tensor names of each output (uint32 count, uint32 names), uint32 attributes count followed by
+ *   attributes, uint32 runtime info count followed by (uint32 key, uint32 value) pairs;
+ * - attribute: uint32 name, uint8 AttributeKind, uint64 payload size, payload.
+ */
+
+namespace ngraph {
+namespace pass {
+namespace ir_binary {
+
+constexpr char magic[8] = {'I', 'E', 'I', 'R', 'B', 'I', 'N', '\0'};
+constexpr uint32_t format_version = 1;
+constexpr uint64_t weights_alignment = 64;
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t weights_offset;
+    uint64_t weights_size;
+    uint64_t topology_offset;
+    uint64_t topology_size;
+    uint64_t strings_offset;
+    uint64_t strings_size;
+};
+
+static_assert(sizeof(Header) == 64, "Unexpected size of binary IR header");
+
+enum class AttributeKind : uint8_t {
+    Bool,               // uint8
+    String,             // uint32 string index
+    Int64,              // int64
+    Double,             // double
+    I32Vector,          // uint64 count, int32 values
+    I64Vector,          // uint64 count, int64 values
+    U64Vector,          // uint64 count, uint64 values
+    FloatVector,        // uint64 count, float values
+    StringVector,       // uint64 count, uint32 string indices
+    ElementType,        // uint32 element::Type_t
+    Variable,           // uint32 string index of variable id
+    Data,               // uint64 file offset, uint64 size of the blob in the weights section
+    Function,           // nested function
+    InputDescriptions,  // uint64 count, InputDescriptionKind + fields for each description
+    OutputDescriptions, // uint64 count, OutputDescriptionKind + fields for each description
+    SpecialBodyPorts,   // int64 current iteration input, int64 body condition output
+};
+
+enum class InputDescriptionKind : uint8_t {
+    Slice,      // uint64 input, uint64 parameter, int64 start, stride, part_size, end, axis
+    Merged,     // uint64 input, uint64 parameter, uint64 body value
+    Invariant,  // uint64 input, uint64 parameter
+};
+
+enum class OutputDescriptionKind : uint8_t {
+    Concat,     // uint64 body value, uint64 output, int64 start, stride, part_size, end, axis
+    Body,       // uint64 body value, uint64 output, int64 iteration
+};
+
+}  // namespace ir_binary
+}  // namespace pass
+}  // namespace ngraph
@@ -26,10 +26,14 @@ class TRANSFORMATIONS_API Serialize;
  * - order of generated layers in xml file is ngraph specific (given by
  * get_ordered_ops()); MO generates file with different order, but they are
  * logically equivalent
+ *
+ * Version::IR_BINARY writes topology and weights into a single binary container
+ * (see ir_binary_format.hpp) which is read without any XML or string parsing.
+ * It is produced by constructors accepting one output file only.
  */
 class ngraph::pass::Serialize : public ngraph::pass::FunctionPass {
 public:
-    enum class Version { IR_V10 };
+    enum class Version { IR_V10, IR_BINARY };
     NGRAPH_RTTI_DECLARATION;
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
@@ -41,11 +45,19 @@ public:
               Version version = Version::IR_V10,
               std::map<std::string, ngraph::OpSet> custom_opsets = {});
 
+    Serialize(std::ostream & modelFile, Version version,
+              std::map<std::string, ngraph::OpSet> custom_opsets = {});
+
+    Serialize(const std::string& modelPath, Version version,
+              std::map<std::string, ngraph::OpSet> custom_opsets = {});
+
 private:
     std::ostream * m_xmlFile;
     std::ostream * m_binFile;
+    std::ostream * m_modelFile;
     const std::string m_xmlPath;
     const std::string m_binPath;
+    const std::string m_modelPath;
     const Version m_version;
     const std::map<std::string, ngraph::OpSet> m_custom_opsets;
 };
@@ -7,6 +7,7 @@
 #include <cassert>
 #include <cstdint>
 #include <fstream>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -16,6 +17,7 @@
 #include "ngraph/opsets/opset1.hpp"
 #include "ngraph_ops/framework_node.hpp"
 #include "pugixml.hpp"
+#include "transformations/ir_binary_format.hpp"
 #include "transformations/serialize.hpp"
 
 using namespace ngraph;
@@ -82,14 +84,18 @@ public:
     using HashValue = size_t;
     using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const *>>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
+    // alignment is counted from the stream position at the moment of the writer creation
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, size_t alignment = 1)
         : m_binary_output(bin_data)
-        , m_enable_compression(enable_compression) {
+        , m_enable_compression(enable_compression)
+        , m_alignment(alignment)
+        , m_origin(alignment > 1 ? static_cast<FilePosition>(bin_data.tellp()) : 0) {
     }
 
     FilePosition write(const char* ptr, size_t size) {
-        const auto offset = m_binary_output.tellp();
         if (!m_enable_compression) {
+            align();
+            const auto offset = m_binary_output.tellp();
             m_binary_output.write(ptr, size);
             return offset;
         }
@@ -104,6 +110,8 @@ public:
             return found->second.first;
         }
 
+        align();
+        const auto offset = m_binary_output.tellp();
         m_binary_output.write(ptr, size);
         m_hash_to_file_positions.insert({hash, {offset, static_cast<void const *>(ptr)}});
 
@@ -111,9 +119,22 @@ public:
     }
 
 private:
+    void align() {
+        if (m_alignment <= 1) {
+            return;
+        }
+        const auto position = static_cast<FilePosition>(m_binary_output.tellp()) - m_origin;
+        const auto padding = (m_alignment - position % m_alignment) % m_alignment;
+        for (FilePosition i = 0; i < padding; i++) {
+            m_binary_output.put('\0');
+        }
+    }
+
     ConstWritePositions m_hash_to_file_positions;
     std::ostream& m_binary_output;
     bool m_enable_compression;
+    FilePosition m_alignment;
+    FilePosition m_origin;
 };
 
 void ngfunction_2_irv10(pugi::xml_node& node,
@@ -809,6 +830,399 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
         f.validate_nodes_and_infer_types();
     }
 }
+
+namespace ir_binary = ngraph::pass::ir_binary;
+
+class BinaryStringTable {
+public:
+    uint32_t get_index(const std::string& str) {
+        const auto found = m_indices.find(str);
+        if (found != m_indices.end()) {
+            return found->second;
+        }
+        const auto index = static_cast<uint32_t>(m_strings.size());
+        m_strings.push_back(str);
+        m_indices.emplace(str, index);
+        return index;
+    }
+
+    void save(std::ostream& out) const {
+        const auto count = static_cast<uint32_t>(m_strings.size());
+        out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        for (const auto& str : m_strings) {
+            const auto length = static_cast<uint32_t>(str.size());
+            out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+            out.write(str.data(), str.size());
+        }
+    }
+
+private:
+    std::unordered_map<std::string, uint32_t> m_indices;
+    std::vector<std::string> m_strings;
+};
+
+// Topology is collected in memory while weights are streamed directly to the output file,
+// so it is written after the weights section once all constants are visited.
+class BinaryTopologyWriter {
+public:
+    BinaryTopologyWriter(BinaryStringTable& strings, int64_t weights_origin)
+        : m_strings(strings)
+        , m_weights_origin(weights_origin) {
+    }
+
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written");
+        const auto ptr = reinterpret_cast<const char*>(&value);
+        m_data.insert(m_data.end(), ptr, ptr + sizeof(T));
+    }
+
+    template <typename T>
+    void write_vector(const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written");
+        write<uint64_t>(values.size());
+        const auto ptr = reinterpret_cast<const char*>(values.data());
+        m_data.insert(m_data.end(), ptr, ptr + values.size() * sizeof(T));
+    }
+
+    void write_string(const std::string& str) {
+        write<uint32_t>(m_strings.get_index(str));
+    }
+
+    // returns the position of a value which is known only after the following data is written
+    template <typename T>
+    size_t reserve() {
+        const auto position = m_data.size();
+        m_data.resize(position + sizeof(T));
+        return position;
+    }
+
+    template <typename T>
+    void patch(size_t position, const T& value) {
+        std::memcpy(m_data.data() + position, &value, sizeof(T));
+    }
+
+    size_t size() const { return m_data.size(); }
+    const std::vector<char>& data() const { return m_data; }
+    int64_t weights_origin() const { return m_weights_origin; }
+
+private:
+    BinaryStringTable& m_strings;
+    std::vector<char> m_data;
+    int64_t m_weights_origin;
+};
+
+void ngfunction_2_binary(BinaryTopologyWriter& writer,
+                         const ngraph::Function& f,
+                         const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                         ConstantWriter& constant_write_handler);
+
+class BinarySerializer : public ngraph::AttributeVisitor {
+    BinaryTopologyWriter& m_writer;
+    const std::map<std::string, ngraph::OpSet>& m_custom_opsets;
+    ConstantWriter& m_constant_write_handler;
+    uint32_t m_attributes_count = 0;
+
+    template <typename WritePayload>
+    void write_attribute(const std::string& name, ir_binary::AttributeKind kind, WritePayload&& write_payload) {
+        m_writer.write_string(name);
+        m_writer.write(kind);
+        const auto size_position = m_writer.reserve<uint64_t>();
+        write_payload();
+        m_writer.patch<uint64_t>(size_position, m_writer.size() - size_position - sizeof(uint64_t));
+        m_attributes_count++;
+    }
+
+    void input_descriptions_on_adapter(const std::vector<std::shared_ptr<
+                                        ngraph::op::util::SubGraphOp::InputDescription>>& input_descriptions) {
+        m_writer.write<uint64_t>(input_descriptions.size());
+        for (const auto& input_description : input_descriptions) {
+            if (auto slice_input = as_type_ptr<ngraph::op::util::SubGraphOp::SliceInputDescription>(input_description)) {
+                m_writer.write(ir_binary::InputDescriptionKind::Slice);
+                m_writer.write(slice_input->m_input_index);
+                m_writer.write(slice_input->m_body_parameter_index);
+                m_writer.write(slice_input->m_start);
+                m_writer.write(slice_input->m_stride);
+                m_writer.write(slice_input->m_part_size);
+                m_writer.write(slice_input->m_end);
+                m_writer.write(slice_input->m_axis);
+            } else if (auto merged_input = as_type_ptr<ngraph::op::util::SubGraphOp::MergedInputDescription>(input_description)) {
+                m_writer.write(ir_binary::InputDescriptionKind::Merged);
+                m_writer.write(merged_input->m_input_index);
+                m_writer.write(merged_input->m_body_parameter_index);
+                m_writer.write(merged_input->m_body_value_index);
+            } else if (as_type_ptr<ngraph::op::util::SubGraphOp::InvariantInputDescription>(input_description)) {
+                m_writer.write(ir_binary::InputDescriptionKind::Invariant);
+                m_writer.write(input_description->m_input_index);
+                m_writer.write(input_description->m_body_parameter_index);
+            } else {
+                throw ngraph_error("Unsupported input description type for serialization");
+            }
+        }
+    }
+
+    void output_descriptions_on_adapter(const std::vector<std::shared_ptr<
+                                        ngraph::op::util::SubGraphOp::OutputDescription>>& output_descriptions) {
+        m_writer.write<uint64_t>(output_descriptions.size());
+        for (const auto& output_description : output_descriptions) {
+            if (auto concat_output = as_type_ptr<ngraph::op::util::SubGraphOp::ConcatOutputDescription>(output_description)) {
+                m_writer.write(ir_binary::OutputDescriptionKind::Concat);
+                m_writer.write(concat_output->m_body_value_index);
+                m_writer.write(concat_output->m_output_index);
+                m_writer.write(concat_output->m_start);
+                m_writer.write(concat_output->m_stride);
+                m_writer.write(concat_output->m_part_size);
+                m_writer.write(concat_output->m_end);
+                m_writer.write(concat_output->m_axis);
+            } else if (auto body_output = as_type_ptr<ngraph::op::util::SubGraphOp::BodyOutputDescription>(output_description)) {
+                m_writer.write(ir_binary::OutputDescriptionKind::Body);
+                m_writer.write(body_output->m_body_value_index);
+                m_writer.write(body_output->m_output_index);
+                m_writer.write(body_output->m_iteration);
+            } else {
+                throw ngraph_error("Unsupported output description type for serialization");
+            }
+        }
+    }
+
+public:
+    BinarySerializer(BinaryTopologyWriter& writer,
+                     const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                     ConstantWriter& constant_write_handler)
+        : m_writer(writer)
+        , m_custom_opsets(custom_opsets)
+        , m_constant_write_handler(constant_write_handler) {
+    }
+
+    uint32_t get_attributes_count() const { return m_attributes_count; }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::vector<std::shared_ptr
+                            <ngraph::op::util::SubGraphOp::InputDescription>>>>(&adapter)) {
+            write_attribute(name, ir_binary::AttributeKind::InputDescriptions, [&] {
+                input_descriptions_on_adapter(a->get());
+            });
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::vector<std::shared_ptr
+                            <ngraph::op::util::SubGraphOp::OutputDescription>>>>(&adapter)) {
+            write_attribute(name, ir_binary::AttributeKind::OutputDescriptions, [&] {
+                output_descriptions_on_adapter(a->get());
+            });
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            write_attribute(name, ir_binary::AttributeKind::SpecialBodyPorts, [&] {
+                m_writer.write(a->get().current_iteration_input_idx);
+                m_writer.write(a->get().body_condition_output_idx);
+            });
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            write_attribute(name, ir_binary::AttributeKind::Variable, [&] {
+                m_writer.write_string(a->get()->get_info().variable_id);
+            });
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            write_attribute(name, ir_binary::AttributeKind::Data, [&] {
+                const uint64_t size = a->get()->size();
+                const auto offset = m_constant_write_handler.write(
+                    static_cast<const char *>(a->get()->get_ptr()), size);
+                m_writer.write<uint64_t>(offset - m_writer.weights_origin());
+                m_writer.write(size);
+            });
+        } else {
+            throw ngraph_error("Unsupported attribute type for serialization: " + name);
+        }
+    }
+
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<bool>& adapter) override {
+        write_attribute(name, ir_binary::AttributeKind::Bool, [&] {
+            m_writer.write<uint8_t>(adapter.get());
+        });
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<std::string>& adapter) override {
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::element::Type>>(&adapter)) {
+            write_attribute(name, ir_binary::AttributeKind::ElementType, [&] {
+                const ngraph::element::Type& type = *a;
+                m_writer.write<uint32_t>(static_cast<uint32_t>(ngraph::element::Type_t(type)));
+            });
+            return;
+        }
+        write_attribute(name, ir_binary::AttributeKind::String, [&] {
+            m_writer.write_string(adapter.get());
+        });
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<int64_t>& adapter) override {
+        write_attribute(name, ir_binary::AttributeKind::Int64, [&] {
+            m_writer.write(adapter.get());
+        });
+    }
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<double>& adapter) override {
+        write_attribute(name, ir_binary::AttributeKind::Double, [&] {
+            m_writer.write(adapter.get());
+        });
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<int>>& adapter) override {
+        write_attribute(name, ir_binary::AttributeKind::I32Vector, [&] {
+            m_writer.write_vector(adapter.get());
+        });
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        write_attribute(name, ir_binary::AttributeKind::I64Vector, [&] {
+            m_writer.write_vector(adapter.get());
+        });
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        write_attribute(name, ir_binary::AttributeKind::U64Vector, [&] {
+            m_writer.write_vector(adapter.get());
+        });
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        write_attribute(name, ir_binary::AttributeKind::FloatVector, [&] {
+            m_writer.write_vector(adapter.get());
+        });
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        write_attribute(name, ir_binary::AttributeKind::StringVector, [&] {
+            const auto& strings = adapter.get();
+            m_writer.write<uint64_t>(strings.size());
+            for (const auto& str : strings) {
+                m_writer.write_string(str);
+            }
+        });
+    }
+    void on_adapter(
+        const std::string& name,
+        ngraph::ValueAccessor<std::shared_ptr<Function>>& adapter) override {
+        NGRAPH_CHECK(name == "body", "Unsupported Function name.");
+        write_attribute(name, ir_binary::AttributeKind::Function, [&] {
+            ngfunction_2_binary(m_writer, *adapter.get(), m_custom_opsets, m_constant_write_handler);
+        });
+    }
+};
+
+void ngfunction_2_binary(BinaryTopologyWriter& writer,
+                         const ngraph::Function& f,
+                         const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                         ConstantWriter& constant_write_handler) {
+    NGRAPH_CHECK(!is_exec_graph(f), "Execution graph can't be serialized into binary IR");
+
+    const std::unordered_map<ngraph::Node*, int> layer_ids =
+        create_layer_ids(f);
+    std::unordered_set<std::string> unique_names;
+
+    auto write_layer_id = [&](ngraph::Node* node) {
+        const auto found = layer_ids.find(node);
+        NGRAPH_CHECK(found != layer_ids.end(), "Internal error");
+        writer.write<uint32_t>(found->second);
+    };
+
+    const auto& ordered_ops = f.get_ordered_ops();
+    writer.write_string(f.get_friendly_name());
+    writer.write<uint32_t>(ordered_ops.size());
+    for (const auto& n : ordered_ops) {
+        ngraph::Node* node = n.get();
+        writer.write_string(node->get_type_name());
+        writer.write_string(get_opset_name(node, custom_opsets));
+        writer.write_string(get_node_unique_name(unique_names, node));
+
+        // inputs refer to outputs of already written layers, so edges need no separate section
+        writer.write<uint32_t>(node->get_input_size());
+        for (const auto& i : node->inputs()) {
+            const auto source_output = i.get_source_output();
+            write_layer_id(source_output.get_node());
+            writer.write<uint32_t>(source_output.get_index());
+        }
+
+        writer.write<uint32_t>(node->get_output_size());
+        for (const auto& o : node->outputs()) {
+            const auto& tensor_names = o.get_tensor().get_names();
+            std::vector<std::string> vector_names(tensor_names.begin(), tensor_names.end());
+            sort(vector_names.begin(), vector_names.end());
+            writer.write<uint32_t>(vector_names.size());
+            for (const auto& name : vector_names) {
+                writer.write_string(name);
+            }
+        }
+
+        const auto attributes_count_position = writer.reserve<uint32_t>();
+        BinarySerializer visitor(writer, custom_opsets, constant_write_handler);
+        NGRAPH_CHECK(node->visit_attributes(visitor), "Visitor API is not supported in ", node);
+        writer.patch(attributes_count_position, visitor.get_attributes_count());
+
+        std::vector<std::pair<std::string, std::string>> rt_values;
+        for (const auto& rt_info_name : rt_info::list_of_names) {
+            const auto found = node->get_rt_info().find(rt_info_name);
+            if (found == node->get_rt_info().end()) {
+                continue;
+            }
+            if (auto v = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(found->second)) {
+                rt_values.emplace_back(rt_info_name, v->get());
+            }
+        }
+        writer.write<uint32_t>(rt_values.size());
+        for (const auto& rt_value : rt_values) {
+            writer.write_string(rt_value.first);
+            writer.write_string(rt_value.second);
+        }
+    }
+
+    writer.write<uint32_t>(f.get_parameters().size());
+    for (const auto& parameter : f.get_parameters()) {
+        write_layer_id(parameter.get());
+    }
+    writer.write<uint32_t>(f.get_results().size());
+    for (const auto& result : f.get_results()) {
+        write_layer_id(result.get());
+    }
+    writer.write<uint32_t>(f.get_sinks().size());
+    for (const auto& sink : f.get_sinks()) {
+        write_layer_id(sink.get());
+    }
+}
+
+void serialize_binary(std::ostream& model_file,
+                      const ngraph::Function& f,
+                      const std::map<std::string, ngraph::OpSet>& custom_opsets) {
+    const int64_t origin = model_file.tellp();
+    NGRAPH_CHECK(origin >= 0, "Binary IR can be serialized into a seekable stream only");
+
+    ir_binary::Header header{};
+    std::copy(std::begin(ir_binary::magic), std::end(ir_binary::magic), header.magic);
+    header.version = ir_binary::format_version;
+    model_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    BinaryStringTable strings;
+    BinaryTopologyWriter topology(strings, origin);
+    ConstantWriter constant_write_handler(model_file, true, ir_binary::weights_alignment);
+    ngfunction_2_binary(topology, f, custom_opsets, constant_write_handler);
+
+    header.weights_offset = sizeof(header);
+    header.weights_size = static_cast<int64_t>(model_file.tellp()) - origin - header.weights_offset;
+
+    header.topology_offset = header.weights_offset + header.weights_size;
+    header.topology_size = topology.size();
+    model_file.write(topology.data().data(), topology.size());
+
+    header.strings_offset = header.topology_offset + header.topology_size;
+    strings.save(model_file);
+    const int64_t end = model_file.tellp();
+    header.strings_size = end - origin - header.strings_offset;
+
+    model_file.seekp(origin);
+    model_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    model_file.seekp(end);
+    model_file.flush();
+    NGRAPH_CHECK(model_file.good(), "Failed to write binary IR");
+}
 }  // namespace
 
 // ! [function_pass:serialize_cpp]
@@ -816,6 +1230,25 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
 bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
     RUN_ON_FUNCTION_SCOPE(Serialize);
 
+    if (m_version == Version::IR_BINARY) {
+        NGRAPH_CHECK(m_modelFile || !m_modelPath.empty(),
+                     "Binary IR is serialized into a single model file");
+        if (m_modelFile) {
+            serialize_binary(*m_modelFile, *f, m_custom_opsets);
+        } else {
+            std::ofstream model_file(m_modelPath, std::ios::out | std::ios::binary);
+            NGRAPH_CHECK(model_file, "Can't open model file: \"" + m_modelPath + "\"");
+            try {
+                serialize_binary(model_file, *f, m_custom_opsets);
+            } catch (const ngraph::CheckFailure& e) {
+                model_file.close();
+                std::remove(m_modelPath.c_str());
+                throw;
+            }
+        }
+        return false;
+    }
+
     auto serializeFunc = [&] (std::ostream & xml_file, std::ostream & bin_file) {
         switch (m_version) {
         case Version::IR_V10:
@@ -899,8 +1332,10 @@ pass::Serialize::Serialize(std::ostream& xmlFile,
                            std::map<std::string, OpSet> custom_opsets)
     : m_xmlFile{&xmlFile}
     , m_binFile{&binFile}
+    , m_modelFile{nullptr}
     , m_xmlPath{}
     , m_binPath{}
+    , m_modelPath{}
     , m_version{version}
     , m_custom_opsets{custom_opsets}
 {
@@ -912,10 +1347,43 @@ pass::Serialize::Serialize(const std::string& xmlPath,
                            std::map<std::string, OpSet> custom_opsets)
     : m_xmlFile{nullptr}
     , m_binFile{nullptr}
+    , m_modelFile{nullptr}
     , m_xmlPath{valid_xml_path(xmlPath)}
     , m_binPath{provide_bin_path(xmlPath, binPath)}
+    , m_modelPath{}
+    , m_version{version}
+    , m_custom_opsets{custom_opsets}
+{
+}
+
+pass::Serialize::Serialize(std::ostream& modelFile,
+                           pass::Serialize::Version version,
+                           std::map<std::string, OpSet> custom_opsets)
+    : m_xmlFile{nullptr}
+    , m_binFile{nullptr}
+    , m_modelFile{&modelFile}
+    , m_xmlPath{}
+    , m_binPath{}
+    , m_modelPath{}
+    , m_version{version}
+    , m_custom_opsets{custom_opsets}
+{
+    NGRAPH_CHECK(version == Version::IR_BINARY, "Only binary IR can be serialized into a single file");
+}
+
+pass::Serialize::Serialize(const std::string& modelPath,
+                           pass::Serialize::Version version,
+                           std::map<std::string, OpSet> custom_opsets)
+    : m_xmlFile{nullptr}
+    , m_binFile{nullptr}
+    , m_modelFile{nullptr}
+    , m_xmlPath{}
+    , m_binPath{}
+    , m_modelPath{modelPath}
     , m_version{version}
     , m_custom_opsets{custom_opsets}
 {
+    NGRAPH_CHECK(version == Version::IR_BINARY, "Only binary IR can be serialized into a single file");
+    NGRAPH_CHECK(!modelPath.empty(), "Path for binary IR file is empty");
 }
 // ! [function_pass:serialize_cpp]
@@ -0,0 +1,124 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "gtest/gtest.h"
+#include "ie_core.hpp"
+#include "transformations/ir_binary_format.hpp"
+#include "transformations/serialize.hpp"
+
+#ifndef IR_SERIALIZATION_MODELS_PATH  // should be already defined by cmake
+#define IR_SERIALIZATION_MODELS_PATH ""
+#endif
+
+typedef std::tuple<std::string, std::string> BinaryIRSerializationParams;
+
+class BinaryIRSerializationTest: public CommonTestUtils::TestsCommon,
+                                 public testing::WithParamInterface<BinaryIRSerializationParams> {
+public:
+    std::string m_model_path;
+    std::string m_binary_path;
+    std::string m_out_irb_path;
+
+    void SetUp() override {
+        m_model_path = IR_SERIALIZATION_MODELS_PATH + std::get<0>(GetParam());
+        if (!std::get<1>(GetParam()).empty()) {
+            m_binary_path = IR_SERIALIZATION_MODELS_PATH + std::get<1>(GetParam());
+        }
+
+        const std::string test_name =  GetTestName() + "_" + GetTimestamp();
+        m_out_irb_path = test_name + ".irb";
+    }
+
+    void TearDown() override {
+        std::remove(m_out_irb_path.c_str());
+    }
+
+    void serialize_and_compare(InferenceEngine::Core& ie) {
+        auto expected = ie.ReadNetwork(m_model_path, m_binary_path);
+
+        ngraph::pass::Serialize(m_out_irb_path, ngraph::pass::Serialize::Version::IR_BINARY)
+            .run_on_function(expected.getFunction());
+        auto result = ie.ReadNetwork(m_out_irb_path);
+
+        bool success;
+        std::string message;
+        std::tie(success, message) = compare_functions(result.getFunction(), expected.getFunction(), true, false, true, true, true);
+        ASSERT_TRUE(success) << message;
+    }
+};
+
+TEST_P(BinaryIRSerializationTest, CompareFunctions) {
+    InferenceEngine::Core ie;
+    serialize_and_compare(ie);
+}
+
+TEST_P(BinaryIRSerializationTest, CompareFunctionsMmapWeights) {
+    InferenceEngine::Core ie;
+    ie.SetConfig({{CONFIG_KEY(MMAP_WEIGHTS), CONFIG_VALUE(YES)}});
+    serialize_and_compare(ie);
+}
+
+INSTANTIATE_TEST_SUITE_P(BinaryIRSerialization, BinaryIRSerializationTest,
+        testing::Values(std::make_tuple("add_abc.xml", "add_abc.bin"),
+                        std::make_tuple("add_abc_f64.xml", ""),
+                        std::make_tuple("split_equal_parts_2d.xml", "split_equal_parts_2d.bin"),
+                        std::make_tuple("addmul_abc.xml", "addmul_abc.bin"),
+                        std::make_tuple("add_abc_initializers_u1_const.xml", "add_abc_initializers_u1_const.bin"),
+                        std::make_tuple("experimental_detectron_detection_output_opset6.xml", ""),
+                        std::make_tuple("nms5.xml", "nms5.bin"),
+                        std::make_tuple("pad_with_shape_of.xml", ""),
+                        std::make_tuple("conv_with_rt_info.xml", ""),
+                        std::make_tuple("loop_2d_add.xml", "loop_2d_add.bin"),
+                        std::make_tuple("nms5_dynamism.xml", "nms5_dynamism.bin")));
+
+class BinaryIRCorruptedCountTest : public CommonTestUtils::TestsCommon,
+                                   public testing::WithParamInterface<size_t> {
+public:
+    std::string m_out_irb_path;
+
+    void SetUp() override {
+        m_out_irb_path = GetTestName() + "_" + GetTimestamp() + ".irb";
+    }
+
+    void TearDown() override {
+        std::remove(m_out_irb_path.c_str());
+    }
+};
+
+// Parameter is the offset of the patched count from the beginning of the topology section
+TEST_P(BinaryIRCorruptedCountTest, ReadNetworkThrows) {
+    InferenceEngine::Core ie;
+    auto network = ie.ReadNetwork(IR_SERIALIZATION_MODELS_PATH "add_abc.xml", IR_SERIALIZATION_MODELS_PATH "add_abc.bin");
+    ngraph::pass::Serialize(m_out_irb_path, ngraph::pass::Serialize::Version::IR_BINARY)
+        .run_on_function(network.getFunction());
+
+    std::vector<char> content;
+    {
+        std::ifstream file(m_out_irb_path, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    ngraph::pass::ir_binary::Header header;
+    ASSERT_GE(content.size(), sizeof(header));
+    std::memcpy(&header, content.data(), sizeof(header));
+    const auto offset = header.topology_offset + GetParam();
+    ASSERT_LE(offset + sizeof(uint32_t), content.size());
+    const uint32_t count = 0x7FFFFFFF;
+    std::memcpy(content.data() + offset, &count, sizeof(count));
+    {
+        std::ofstream file(m_out_irb_path, std::ios::binary | std::ios::trunc);
+        file.write(content.data(), content.size());
+    }
+
+    EXPECT_THROW(ie.ReadNetwork(m_out_irb_path), InferenceEngine::Exception);
+}
+
+INSTANTIATE_TEST_SUITE_P(BinaryIRSerialization, BinaryIRCorruptedCountTest,
+        testing::Values(4,     // layers count of the function
+                        20));  // inputs count of the first layer
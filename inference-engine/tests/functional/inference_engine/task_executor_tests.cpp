@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
 #include <future>
+#include <iostream>
 
 #include <gtest/gtest.h>
 
@@ -211,3 +213,42 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+
+class CPUStreamsExecutorThroughputTests : public ::testing::TestWithParam<int> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<int>& obj) {
+        return "streams=" + std::to_string(obj.param);
+    }
+};
+
+// Microbenchmark: throughput of empty tasks depending on the number of streams,
+// run with --gtest_also_run_disabled_tests
+TEST_P(CPUStreamsExecutorThroughputTests, DISABLED_canRunManyEmptyTasks) {
+    const int streams = GetParam();
+    const int NUMBER_OF_TASKS = 100000;
+    std::atomic_int executed = {0};
+    std::promise<void> allExecuted;
+    std::chrono::duration<double> duration;
+    {
+        auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                                                 streams, 1, IStreamsExecutor::ThreadBindingType::NONE});
+        // the executor creation and destruction are not measured
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < NUMBER_OF_TASKS; i++) {
+            taskExecutor->run([&] {
+                if (++executed == NUMBER_OF_TASKS) {
+                    allExecuted.set_value();
+                }
+            });
+        }
+        allExecuted.get_future().wait();
+        duration = std::chrono::steady_clock::now() - start;
+    }
+    ASSERT_EQ(NUMBER_OF_TASKS, executed);
+    std::cout << "streams " << streams << ": " << static_cast<int64_t>(NUMBER_OF_TASKS / duration.count())
+              << " empty tasks/sec" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(CPUStreamsExecutorThroughputTests, CPUStreamsExecutorThroughputTests,
+                         ::testing::Values(1, 2, 4, 8, 16, 32, 64),
+                         CPUStreamsExecutorThroughputTests::getTestCaseName);
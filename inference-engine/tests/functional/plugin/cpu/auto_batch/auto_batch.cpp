@@ -0,0 +1,337 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <functional_test_utils/blob_utils.hpp>
+#include <functional_test_utils/plugin_cache.hpp>
+#include <functional_test_utils/skip_tests_config.hpp>
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace {
+
+/**
+ * @brief Passes the input through, the execution fails if any of the values is negative.
+ * It lets a single request of the batch fail the whole batched inference.
+ */
+class FailOnNegative : public op::Op {
+public:
+    static constexpr NodeTypeInfo type_info{"FailOnNegative", 0};
+    const NodeTypeInfo& get_type_info() const override { return type_info; }
+    FailOnNegative() = default;
+    explicit FailOnNegative(const Output<Node>& arg) : op::Op({arg}) {
+        constructor_validate_and_infer_types();
+    }
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        return std::make_shared<FailOnNegative>(new_args.at(0));
+    }
+    bool visit_attributes(AttributeVisitor& visitor) override {
+        return true;
+    }
+};
+
+constexpr NodeTypeInfo FailOnNegative::type_info;
+
+class FailOnNegativeKernel : public ILayerExecImpl {
+public:
+    explicit FailOnNegativeKernel(const std::shared_ptr<Node>& node) : shape(node->get_output_shape(0)) {}
+
+    StatusCode init(LayerConfig& /*config*/, ResponseDesc* /*resp*/) noexcept override {
+        return StatusCode::OK;
+    }
+
+    StatusCode getSupportedConfigurations(std::vector<LayerConfig>& conf, ResponseDesc* /*resp*/) noexcept override {
+        SizeVector order(shape.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            order[i] = i;
+        }
+        DataConfig cfg;
+        cfg.constant = false;
+        cfg.inPlace = -1;
+        cfg.desc = TensorDesc(Precision::FP32, shape, {shape, order});
+        LayerConfig layerConfig;
+        layerConfig.inConfs.push_back(cfg);
+        layerConfig.outConfs.push_back(cfg);
+        conf.push_back(layerConfig);
+        return StatusCode::OK;
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
+                       ResponseDesc* /*resp*/) noexcept override {
+        auto input = as<MemoryBlob>(inputs[0]);
+        auto output = as<MemoryBlob>(outputs[0]);
+        if (!input || !output) {
+            return StatusCode::PARAMETER_MISMATCH;
+        }
+        auto inputHolder = input->rmap();
+        auto outputHolder = output->wmap();
+        auto inputData = inputHolder.as<const float*>();
+        auto outputData = outputHolder.as<float*>();
+        for (size_t i = 0; i < input->size(); i++) {
+            if (inputData[i] < 0) {
+                return StatusCode::GENERAL_ERROR;
+            }
+            outputData[i] = inputData[i];
+        }
+        return StatusCode::OK;
+    }
+
+private:
+    const Shape shape;
+};
+
+class FailOnNegativeExtension : public IExtension {
+public:
+    void GetVersion(const Version*& versionInfo) const noexcept override {}
+
+    void Unload() noexcept override {}
+
+    std::map<std::string, OpSet> getOpSets() override {
+        OpSet opset;
+        opset.insert<FailOnNegative>();
+        return {{"auto_batch_test_opset", opset}};
+    }
+
+    std::vector<std::string> getImplTypes(const std::shared_ptr<Node>& node) override {
+        if (node->get_type_info() != FailOnNegative::type_info)
+            return {};
+        return {"CPU"};
+    }
+
+    ILayerImpl::Ptr getImplementation(const std::shared_ptr<Node>& node, const std::string& implType) override {
+        return std::make_shared<FailOnNegativeKernel>(node);
+    }
+};
+
+}  // namespace
+
+namespace AutoBatchTestsDefinitions {
+
+/* The network computes output = 2 * input, the batch 1 network is loaded as BATCH:CPU(4).
+
+    Parameter
+        |
+    [FailOnNegative]
+        |
+    Multiply (output) -> Result
+ */
+class AutoBatchTest : public CommonTestUtils::TestsCommon {
+protected:
+    static constexpr int batch = 4;
+    static constexpr size_t size = 16;
+    const std::string batchDevice = std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
+                                    CommonTestUtils::DEVICE_CPU + "(" + std::to_string(batch) + ")";
+
+    static CNNNetwork makeNetwork(bool failOnNegative = false) {
+        auto params = builder::makeParams(element::f32, {Shape{1, size}});
+        Output<Node> input = params[0];
+        if (failOnNegative) {
+            input = std::make_shared<FailOnNegative>(input);
+        }
+        auto two = builder::makeConstant<float>(element::f32, Shape{1, 1}, {2.f});
+        auto output = std::make_shared<opset1::Multiply>(input, two);
+        output->set_friendly_name("output");
+        ResultVector results{std::make_shared<opset1::Result>(output)};
+        return CNNNetwork(std::make_shared<Function>(results, params, "AutoBatch"));
+    }
+
+    ExecutableNetwork loadNetwork(Core& ie, const CNNNetwork& network, const std::string& timeout) {
+        inputName = network.getInputsInfo().begin()->first;
+        return ie.LoadNetwork(network, batchDevice, {{AUTO_BATCH_CONFIG_KEY(TIMEOUT), timeout}});
+    }
+
+    static Blob::Ptr makeInput(int seed) {
+        TensorDesc desc(Precision::FP32, {1, size}, Layout::NC);
+        return FuncTestUtils::createAndFillBlob(desc, 10, 1, 1, seed);
+    }
+
+    static void checkOutput(const Blob::CPtr& output, const Blob::CPtr& input) {
+        ASSERT_EQ(input->size(), output->size());
+        auto inputData = input->cbuffer().as<const float*>();
+        auto outputData = output->cbuffer().as<const float*>();
+        for (size_t i = 0; i < input->size(); i++) {
+            ASSERT_FLOAT_EQ(2.f * inputData[i], outputData[i]) << "at index " << i;
+        }
+    }
+
+    static std::vector<unsigned int> getHistogram(const ExecutableNetwork& execNet) {
+        return execNet.GetMetric(METRIC_KEY(AUTO_BATCH_SIZE_HISTOGRAM)).as<std::vector<unsigned int>>();
+    }
+
+    std::string inputName;
+};
+
+TEST_F(AutoBatchTest, FullBatchIsCollectedFromAnyRequests) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    auto execNet = loadNetwork(*ie, makeNetwork(), "1000");
+    // two batched requests are created, the started requests do not depend on the batched request creation order
+    std::vector<InferRequest> requests;
+    for (int i = 0; i < 2 * batch; i++) {
+        requests.push_back(execNet.CreateInferRequest());
+    }
+    std::vector<Blob::Ptr> inputs;
+    for (int i = 0; i < batch; i++) {
+        inputs.push_back(makeInput(i));
+        requests[2 * i + 1].SetBlob(inputName, inputs.back());
+    }
+    for (int i = 0; i < batch; i++) {
+        requests[2 * i + 1].StartAsync();
+    }
+    for (int i = 0; i < batch; i++) {
+        requests[2 * i + 1].Wait(InferRequest::WaitMode::RESULT_READY);
+        checkOutput(requests[2 * i + 1].GetBlob("output"), inputs[i]);
+    }
+    ASSERT_EQ(std::vector<unsigned int>({0, 0, 0, 1}), getHistogram(execNet));
+}
+
+TEST_F(AutoBatchTest, PartialBatchIsExecutedOnTimeout) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    auto execNet = loadNetwork(*ie, makeNetwork(), "100");
+    std::vector<InferRequest> requests;
+    for (int i = 0; i < batch; i++) {
+        requests.push_back(execNet.CreateInferRequest());
+    }
+    auto input0 = makeInput(0), input1 = makeInput(1);
+    requests[0].SetBlob(inputName, input0);
+    requests[1].SetBlob(inputName, input1);
+    const auto start = std::chrono::steady_clock::now();
+    requests[0].StartAsync();
+    requests[1].StartAsync();
+    requests[0].Wait(InferRequest::WaitMode::RESULT_READY);
+    requests[1].Wait(InferRequest::WaitMode::RESULT_READY);
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+    checkOutput(requests[0].GetBlob("output"), input0);
+    checkOutput(requests[1].GetBlob("output"), input1);
+    ASSERT_EQ(std::vector<unsigned int>({0, 1, 0, 0}), getHistogram(execNet));
+
+    // the synchronous inference of the single request is executed on timeout as well
+    auto input2 = makeInput(2);
+    requests[2].SetBlob(inputName, input2);
+    requests[2].Infer();
+    checkOutput(requests[2].GetBlob("output"), input2);
+    ASSERT_EQ(std::vector<unsigned int>({1, 1, 0, 0}), getHistogram(execNet));
+}
+
+TEST_F(AutoBatchTest, UserBlobsAreCopiedToAndFromBatch) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    auto execNet = loadNetwork(*ie, makeNetwork(), "1000");
+    std::vector<InferRequest> requests;
+    std::vector<Blob::Ptr> inputs, outputs;
+    for (int i = 0; i < batch; i++) {
+        requests.push_back(execNet.CreateInferRequest());
+        inputs.push_back(makeInput(i));
+        outputs.push_back(make_shared_blob<float>(TensorDesc(Precision::FP32, {1, size}, Layout::NC)));
+        outputs.back()->allocate();
+        requests.back().SetBlob(inputName, inputs.back());
+        requests.back().SetBlob("output", outputs.back());
+    }
+    for (int iteration = 0; iteration < 2; iteration++) {
+        for (auto&& request : requests) {
+            request.StartAsync();
+        }
+        for (int i = 0; i < batch; i++) {
+            requests[i].Wait(InferRequest::WaitMode::RESULT_READY);
+            ASSERT_EQ(inputs[i], requests[i].GetBlob(inputName));
+            ASSERT_EQ(outputs[i], requests[i].GetBlob("output"));
+            checkOutput(outputs[i], inputs[i]);
+        }
+        // the data of the user blobs is changed in place, the next inference has to use it
+        for (int i = 0; i < batch; i++) {
+            auto data = inputs[i]->buffer().as<float*>();
+            for (size_t j = 0; j < size; j++) {
+                data[j] += 1.f;
+            }
+        }
+    }
+}
+
+TEST_F(AutoBatchTest, ExceptionIsPropagatedToEveryRequestOfBatch) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the own core, as the extension is added to all the devices
+    Core ie;
+    ie.AddExtension(std::make_shared<FailOnNegativeExtension>());
+    auto execNet = loadNetwork(ie, makeNetwork(true), "1000");
+    std::vector<InferRequest> requests;
+    std::vector<Blob::Ptr> inputs;
+    for (int i = 0; i < batch; i++) {
+        requests.push_back(execNet.CreateInferRequest());
+        inputs.push_back(makeInput(i));
+        requests.back().SetBlob(inputName, inputs.back());
+    }
+    inputs[2]->buffer().as<float*>()[size - 1] = -1.f;
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (auto&& request : requests) {
+        ASSERT_THROW(request.Wait(InferRequest::WaitMode::RESULT_READY), Exception);
+    }
+
+    // the batched request is still usable after the failure
+    inputs[2]->buffer().as<float*>()[size - 1] = 1.f;
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (int i = 0; i < batch; i++) {
+        ASSERT_NO_THROW(requests[i].Wait(InferRequest::WaitMode::RESULT_READY));
+        checkOutput(requests[i].GetBlob("output"), inputs[i]);
+    }
+}
+
+TEST_F(AutoBatchTest, ConfigKeys) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the own core, as the default values of the plugin config are checked
+    Core ie;
+    std::vector<std::string> configKeys = ie.GetMetric(CommonTestUtils::DEVICE_BATCH, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    ASSERT_NE(configKeys.end(), std::find(configKeys.begin(), configKeys.end(), AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG)));
+    ASSERT_NE(configKeys.end(), std::find(configKeys.begin(), configKeys.end(), AUTO_BATCH_CONFIG_KEY(TIMEOUT)));
+    ASSERT_EQ("5", ie.GetConfig(CommonTestUtils::DEVICE_BATCH, AUTO_BATCH_CONFIG_KEY(TIMEOUT)).as<std::string>());
+
+    auto network = makeNetwork();
+    auto execNet = ie.LoadNetwork(network, batchDevice);
+    ASSERT_EQ("CPU(4)", execNet.GetConfig(AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG)).as<std::string>());
+    ASSERT_EQ("5", execNet.GetConfig(AUTO_BATCH_CONFIG_KEY(TIMEOUT)).as<std::string>());
+    ASSERT_EQ(0, execNet.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>() % batch);
+    ASSERT_EQ(std::vector<unsigned int>(batch, 0), getHistogram(execNet));
+    ASSERT_THROW(execNet.SetConfig({{AUTO_BATCH_CONFIG_KEY(TIMEOUT), "10"}}), Exception);
+
+    // the device config may be set explicitly instead of the device name
+    ie.SetConfig({{AUTO_BATCH_CONFIG_KEY(TIMEOUT), "10"}}, CommonTestUtils::DEVICE_BATCH);
+    execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_BATCH, {{AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG), "CPU(2)"}});
+    ASSERT_EQ("CPU(2)", execNet.GetConfig(AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG)).as<std::string>());
+    ASSERT_EQ("10", execNet.GetConfig(AUTO_BATCH_CONFIG_KEY(TIMEOUT)).as<std::string>());
+    ASSERT_EQ(2, getHistogram(execNet).size());
+
+    ASSERT_THROW(ie.LoadNetwork(network, batchDevice, {{AUTO_BATCH_CONFIG_KEY(TIMEOUT), "-1"}}), Exception);
+    ASSERT_THROW(ie.LoadNetwork(network, batchDevice, {{AUTO_BATCH_CONFIG_KEY(TIMEOUT), "abc"}}), Exception);
+    ASSERT_THROW(ie.LoadNetwork(network, "BATCH:CPU"), Exception);
+    ASSERT_THROW(ie.LoadNetwork(network, "BATCH:CPU(0)"), Exception);
+    ASSERT_THROW(ie.LoadNetwork(network, CommonTestUtils::DEVICE_BATCH), Exception);
+}
+
+}  // namespace AutoBatchTestsDefinitions
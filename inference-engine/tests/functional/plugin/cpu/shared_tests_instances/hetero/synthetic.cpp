@@ -17,9 +17,20 @@ INSTANTIATE_TEST_SUITE_P(smoke_SingleMajorNode, HeteroSyntheticTest,
                                 ::testing::ValuesIn(HeteroTests::HeteroSyntheticTest::_singleMajorNodeFunctions)),
                         HeteroSyntheticTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_IndependentBranches, HeteroSyntheticTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<PluginParameter>{{"CPU0", "MKLDNNPlugin"}, {"CPU1", "MKLDNNPlugin"}}),
+                                ::testing::ValuesIn(HeteroTests::HeteroSyntheticTest::_independentBranchesFunctions)),
+                        HeteroSyntheticTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(nightly_RandomMajorNodes, HeteroSyntheticTest,
                         ::testing::Combine(
                                 ::testing::Values(std::vector<PluginParameter>{{"CPU0", "MKLDNNPlugin"}, {"CPU1", "MKLDNNPlugin"}}),
                                 ::testing::ValuesIn(HeteroTests::HeteroSyntheticTest::_randomMajorNodeFunctions)),
                         HeteroSyntheticTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_FailedSubgraph, HeteroFailedSubgraphTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<PluginParameter>{{"CPU0", "MKLDNNPlugin"}, {"CPU1", "MKLDNNPlugin"}}),
+                                ::testing::ValuesIn(HeteroTests::HeteroFailedSubgraphTest::_failedSubgraphFunctions)),
+                        HeteroFailedSubgraphTest::getTestCaseName);
 }  // namespace
@@ -40,3 +40,99 @@ const auto nmsParams = ::testing::Combine(::testing::ValuesIn(inShapeParams),
 );
 
 INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerTest, NmsLayerTest, nmsParams, NmsLayerTest::getTestCaseName);
+
+// thousands of boxes, so the candidates are sorted by several chunks and the IoU is checked by several blocks
+const std::vector<InputShapeParams> manyBoxesShapeParams = {
+    InputShapeParams{1, 3000, 2},
+    InputShapeParams{2, 1500, 1}
+};
+
+const auto nmsManyBoxesParams = ::testing::Combine(::testing::ValuesIn(manyBoxesShapeParams),
+                                                   ::testing::Combine(::testing::Values(Precision::FP32),
+                                                                      ::testing::Values(Precision::I32),
+                                                                      ::testing::Values(Precision::FP32)),
+                                                   ::testing::Values(10, 100),
+                                                   ::testing::ValuesIn(threshold),
+                                                   ::testing::Values(0.3f),
+                                                   ::testing::Values(0.0f),
+                                                   ::testing::ValuesIn(encodType),
+                                                   ::testing::Values(true),
+                                                   ::testing::Values(element::i32),
+                                                   ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerTest_ManyBoxes, NmsLayerTest, nmsManyBoxesParams, NmsLayerTest::getTestCaseName);
+
+// max_output_boxes_per_class is greater than the sort chunk and than the number of boxes, so it's clamped
+const std::vector<InputShapeParams> clampShapeParams = {
+    InputShapeParams{1, 50, 3},
+    InputShapeParams{2, 100, 2}
+};
+
+const auto nmsClampParams = ::testing::Combine(::testing::ValuesIn(clampShapeParams),
+                                               ::testing::Combine(::testing::Values(Precision::FP32),
+                                                                  ::testing::Values(Precision::I32),
+                                                                  ::testing::Values(Precision::FP32)),
+                                               ::testing::Values(80, 200, 1000),
+                                               ::testing::ValuesIn(threshold),
+                                               ::testing::Values(0.3f),
+                                               ::testing::Values(0.0f),
+                                               ::testing::ValuesIn(encodType),
+                                               ::testing::ValuesIn(sortResDesc),
+                                               ::testing::Values(element::i32),
+                                               ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerTest_MaxOutClamp, NmsLayerTest, nmsClampParams, NmsLayerTest::getTestCaseName);
+
+namespace {
+
+// the scores take a few distinct values, so the order of the candidates with tied scores is checked
+class NmsLayerTiedScoresTest : public NmsLayerTest {
+public:
+    void GenerateInputs() override {
+        size_t it = 0;
+        for (const auto &input : cnnNetwork.getInputsInfo()) {
+            const auto &info = input.second;
+            auto blob = make_blob_with_precision(info->getTensorDesc());
+            blob->allocate();
+            if (it == 0) {
+                CommonTestUtils::fill_data_random_float<Precision::FP32>(blob, 100, 0, 1);
+            } else if (it == 1) {
+                CommonTestUtils::fill_data_random_float<Precision::FP32>(blob, 1, 0, 4);
+            } else {
+                blob = GenerateInput(*info);
+            }
+            inputs.push_back(blob);
+            it++;
+        }
+    }
+};
+
+TEST_P(NmsLayerTiedScoresTest, CompareWithRefs) {
+    Run();
+}
+
+const std::vector<InputShapeParams> tiedScoresShapeParams = {
+    InputShapeParams{1, 2000, 2},
+    InputShapeParams{3, 100, 2}
+};
+
+const auto nmsTiedScoresParams = ::testing::Combine(::testing::ValuesIn(tiedScoresShapeParams),
+                                                    ::testing::Combine(::testing::Values(Precision::FP32),
+                                                                       ::testing::Values(Precision::I32),
+                                                                       ::testing::Values(Precision::FP32)),
+                                                    ::testing::Values(20, 150),
+                                                    ::testing::ValuesIn(threshold),
+                                                    ::testing::Values(0.3f),
+                                                    ::testing::Values(0.0f),
+                                                    ::testing::ValuesIn(encodType),
+                                                    ::testing::ValuesIn(sortResDesc),
+                                                    ::testing::Values(element::i32),
+                                                    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerTest_TiedScores, NmsLayerTiedScoresTest, nmsTiedScoresParams,
+                         NmsLayerTiedScoresTest::getTestCaseName);
+
+}  // namespace
@@ -51,4 +51,57 @@ INSTANTIATE_TEST_SUITE_P(smoke_TopK, TopKLayerTest,
                 ::testing::Values(std::vector<size_t>({10, 10, 10})),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         TopKLayerTest::getTestCaseName);
+
+// Long axes are split between threads and filtered by blocks. The default inputs are integers from [0, 10),
+// so almost all the values are ties and the earliest index must win
+const std::vector<std::vector<size_t>> longAxisShapes = {
+        {1, 32000},
+        {2, 50000},
+};
+
+const std::vector<int64_t> longAxisK = {
+        1,
+        5,
+        100,
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TopK_LongAxis, TopKLayerTest,
+        ::testing::Combine(
+                ::testing::ValuesIn(longAxisK),
+                ::testing::Values(1),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes),
+                ::testing::Values(InferenceEngine::Precision::FP32),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Layout::ANY),
+                ::testing::ValuesIn(longAxisShapes),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        TopKLayerTest::getTestCaseName);
+
+// Same long axes filled with integers from a wide range, so ties are rare and the top values are spread over the axis
+class TopKWideRangeLayerTest : public TopKLayerTest {
+protected:
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override {
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 65536, -32768);
+    }
+};
+
+TEST_P(TopKWideRangeLayerTest, CompareWithRefs) {
+    Run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_TopK_LongAxisWideRange, TopKWideRangeLayerTest,
+        ::testing::Combine(
+                ::testing::ValuesIn(longAxisK),
+                ::testing::Values(1),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes),
+                ::testing::Values(InferenceEngine::Precision::FP32),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                ::testing::Values(InferenceEngine::Layout::ANY),
+                ::testing::ValuesIn(longAxisShapes),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        TopKLayerTest::getTestCaseName);
 }  // namespace
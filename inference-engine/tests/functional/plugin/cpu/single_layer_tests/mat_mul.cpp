@@ -5,6 +5,7 @@
 #include <shared_test_classes/single_layer/normalize_l2.hpp>
 #include "test_utils/fusing_test_utils.hpp"
 #include "ngraph_functions/builders.hpp"
+#include <exec_graph_info.hpp>
 
 using namespace ngraph;
 using namespace InferenceEngine;
@@ -88,6 +89,13 @@ protected:
             std::swap(*(isB.end() - 1), *(isB.end() - 2));
         }
 
+        if (prec == Precision::BF16) {
+            // the reference is computed on the fp32 network, bf16 execution is enforced by the plugin
+            configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES});
+            inPrc = Precision::BF16;
+            prec = Precision::FP32;
+        }
+
         auto ngPrec = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(prec);
         auto params = builder::makeParams(ngPrec, {isA});
         auto matrixB = builder::makeInputLayer(ngPrec, typeB, isB);
@@ -108,6 +116,120 @@ TEST_P(MatMulLayerCPUTest, CompareWithRefs) {
     CheckFusingResults(executableNetwork, cpuNodeType);
 }
 
+using MatMulInt8LayerCPUTestParamSet = std::tuple<std::pair<SizeVector, SizeVector>,
+                                                  Precision,    // precision of the quantized input A
+                                                  Precision,    // output precision of the MatMul node
+                                                  bool,
+                                                  bool>;
+
+class MatMulInt8LayerCPUTest : public testing::WithParamInterface<MatMulInt8LayerCPUTestParamSet>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatMulInt8LayerCPUTestParamSet> obj) {
+        std::pair<SizeVector, SizeVector> IS;
+        Precision inPrecA, outPrec;
+        bool transpA, transpB;
+        std::tie(IS, inPrecA, outPrec, transpA, transpB) = obj.param;
+
+        std::ostringstream result;
+        result << "IS_A=" << CommonTestUtils::vec2str(IS.first) << "_";
+        result << "IS_B=" << CommonTestUtils::vec2str(IS.second) << "_";
+        result << "Transp_A=" << transpA << "_";
+        result << "Transp_B=" << transpB << "_";
+        result << "InPrecA=" << inPrecA << "_";
+        result << "OutPrec=" << outPrec;
+
+        return result.str();
+    }
+
+protected:
+    Precision outPrec;
+
+    Blob::Ptr GenerateInput(const InputInfo &info) const override {
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 2, -1, 100);
+    }
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::pair<SizeVector, SizeVector> IS;
+        Precision inPrecA;
+        bool transpA, transpB;
+        std::tie(IS, inPrecA, outPrec, transpA, transpB) = this->GetParam();
+
+        SizeVector isA = IS.first, isB = IS.second;
+        if (transpA) {
+            std::swap(*(isA.end() - 1), *(isA.end() - 2));
+        }
+        if (transpB) {
+            std::swap(*(isB.end() - 1), *(isB.end() - 2));
+        }
+
+        // B is a parameter to keep the MatMul node instead of the FullyConnected one
+        auto params = builder::makeParams(element::f32, {isA, isB});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<opset1::Parameter>(params));
+
+        auto fqRange = [](const Precision& prec) {
+            return prec == Precision::U8 ? std::make_pair(0.f, 2.55f) : std::make_pair(-1.28f, 1.27f);
+        };
+        auto makeFQ = [&fqRange](const Output<Node>& in, const Precision& prec) {
+            const auto range = fqRange(prec);
+            return builder::makeFakeQuantize(in, element::f32, 256, SizeVector(in.get_shape().size(), 1),
+                                             {range.first}, {range.second}, {range.first}, {range.second});
+        };
+
+        auto matMul = builder::makeMatMul(makeFQ(paramOuts[0], inPrecA), makeFQ(paramOuts[1], Precision::I8), transpA, transpB);
+        matMul->set_friendly_name("MatMul");
+
+        std::shared_ptr<Node> output = matMul;
+        if (outPrec != Precision::FP32) {
+            // the quantized output is fused into the MatMul node with the low precision output
+            output = makeFQ(matMul, outPrec);
+            output->set_friendly_name("OutputFakeQuantize");
+            // one quantization step of the output
+            threshold = 0.011f;
+        }
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(output)}, params, "MatMulInt8");
+    }
+
+    void CheckMatMulNode() {
+        auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, execGraph);
+
+        bool isNodeFound = false;
+        for (const auto &node : execGraph->get_ops()) {
+            const auto &rtInfo = node->get_rt_info();
+            auto getExecValue = [&rtInfo](const std::string &paramName) -> std::string {
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(rtInfo.end() != it);
+                auto value = std::dynamic_pointer_cast<VariantImpl<std::string>>(it->second);
+                IE_ASSERT(nullptr != value);
+                return value->get();
+            };
+
+            if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) == "MatMul") {
+                isNodeFound = true;
+                ASSERT_NE(std::string::npos, getExecValue(ExecGraphInfoSerialization::ORIGINAL_NAMES).find("MatMul"));
+                if (outPrec != Precision::FP32) {
+                    ASSERT_NE(std::string::npos, getExecValue(ExecGraphInfoSerialization::ORIGINAL_NAMES).find("OutputFakeQuantize"))
+                        << "The output FakeQuantize has not been fused";
+                }
+                ASSERT_EQ(outPrec.name(), getExecValue(ExecGraphInfoSerialization::OUTPUT_PRECISIONS));
+                const auto runtimePrecision = getExecValue(ExecGraphInfoSerialization::RUNTIME_PRECISION);
+                ASSERT_TRUE(runtimePrecision == "U8" || runtimePrecision == "I8") << "MatMul is executed in " << runtimePrecision;
+            }
+        }
+        ASSERT_TRUE(isNodeFound) << "MatMul node has not been found";
+    }
+};
+
+TEST_P(MatMulInt8LayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckMatMulNode();
+}
+
 namespace {
 
 /* ============= Common params ============= */
@@ -192,12 +314,73 @@ const auto gemmParams = ::testing::Combine(::testing::ValuesIn(IS),
                                            ::testing::ValuesIn(transpose),
                                            ::testing::ValuesIn(transpose));
 
+std::vector<fusingSpecificParams> fusingParamsSet {
+        emptyFusingSpec,
+        fusingRelu,
+        fusingMultiplyPerTensor,
+        fusingAddPerTensor
+};
+
 const auto testParams = ::testing::Combine(gemmParams,
                                            ::testing::Values(MatMulNodeType::MatMul),
-                                           ::testing::Values(emptyFusingSpec));
+                                           ::testing::ValuesIn(fusingParamsSet));
 
 INSTANTIATE_TEST_SUITE_P(smoke_Check, MatMulLayerCPUTest, testParams, MatMulLayerCPUTest::getTestCaseName);
 
+const auto gemmParamsBF16 = ::testing::Combine(::testing::ValuesIn(IS),
+                                               ::testing::Values(Precision::BF16),
+                                               ::testing::Values(helpers::InputLayerType::PARAMETER),
+                                               ::testing::ValuesIn(transpose),
+                                               ::testing::ValuesIn(transpose));
+
+std::vector<fusingSpecificParams> fusingParamsSetBF16 {
+        emptyFusingSpec,
+        fusingRelu
+};
+
+const auto testParamsBF16 = ::testing::Combine(gemmParamsBF16,
+                                               ::testing::Values(MatMulNodeType::MatMul),
+                                               ::testing::ValuesIn(fusingParamsSetBF16));
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check_BF16, MatMulLayerCPUTest, testParamsBF16, MatMulLayerCPUTest::getTestCaseName);
+
+// per-channel post ops are supported along the columns of 2D outputs only
+const std::vector<std::pair<SizeVector, SizeVector>> IS2D = {
+    {{55, 12}, {12, 55}},
+    {{71, 128}, {128, 20}}
+};
+
+const auto gemmParams2D = ::testing::Combine(::testing::ValuesIn(IS2D),
+                                             ::testing::Values(Precision::FP32),
+                                             ::testing::Values(helpers::InputLayerType::PARAMETER),
+                                             ::testing::ValuesIn(transpose),
+                                             ::testing::ValuesIn(transpose));
+
+std::vector<fusingSpecificParams> fusingParamsSet2D {
+        fusingScaleShift,
+        fusingFakeQuantizePerChannel
+};
+
+const auto testParams2D = ::testing::Combine(gemmParams2D,
+                                             ::testing::Values(MatMulNodeType::MatMul),
+                                             ::testing::ValuesIn(fusingParamsSet2D));
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check_2D_PerChannel, MatMulLayerCPUTest, testParams2D, MatMulLayerCPUTest::getTestCaseName);
+
+const std::vector<std::pair<SizeVector, SizeVector>> ISInt8 = {
+    {{1, 2, 32, 120}, {120, 5}},
+    {{10, 10, 10}, {10, 10, 10}},
+    {{55, 12}, {12, 55}}
+};
+
+const auto testParamsInt8 = ::testing::Combine(::testing::ValuesIn(ISInt8),
+                                               ::testing::Values(Precision::U8, Precision::I8),
+                                               ::testing::Values(Precision::FP32, Precision::U8, Precision::I8),
+                                               ::testing::ValuesIn(transpose),
+                                               ::testing::ValuesIn(transpose));
+
+INSTANTIATE_TEST_SUITE_P(smoke_Check_Int8, MatMulInt8LayerCPUTest, testParamsInt8, MatMulInt8LayerCPUTest::getTestCaseName);
+
 }; // namespace gemm
 
 } // namespace
@@ -0,0 +1,83 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <functional_test_utils/blob_utils.hpp>
+#include <functional_test_utils/plugin_cache.hpp>
+#include <functional_test_utils/skip_tests_config.hpp>
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/builders.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+// Input and output precisions differ from the graph ones, so in the throughput mode the conversions run as separate
+// stages of the asynchronous pipeline
+class AsyncConversionPipelineTest : public CommonTestUtils::TestsCommon {
+protected:
+    static CNNNetwork makeNetwork() {
+        auto inputParams = builder::makeParams(element::f32, {Shape{1, 3, 32, 32}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto conv = builder::makeConvolution(paramOuts[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                             {1, 1}, op::PadType::EXPLICIT, 16);
+        auto relu = builder::makeActivation(conv, element::f32, helpers::ActivationTypes::Relu);
+
+        ResultVector results{std::make_shared<opset1::Result>(relu)};
+        CNNNetwork network(std::make_shared<Function>(results, inputParams, "AsyncConversionPipeline"));
+        network.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+        network.getOutputsInfo().begin()->second->setPrecision(Precision::I32);
+        return network;
+    }
+};
+
+TEST_F(AsyncConversionPipelineTest, CompareWithSyncInference) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    constexpr size_t requestsNum = 4;
+    auto ie = PluginCache::get().ie();
+    auto network = makeNetwork();
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+
+    auto refExecNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto execNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2"}});
+
+    std::vector<InferRequest> requests;
+    std::vector<Blob::Ptr> inputs;
+    for (size_t i = 0; i < requestsNum; i++) {
+        TensorDesc inputDesc(Precision::U8, {1, 3, 32, 32}, Layout::NCHW);
+        inputs.push_back(FuncTestUtils::createAndFillBlob(inputDesc, 255, 0, 1, static_cast<int>(i)));
+        requests.push_back(execNet.CreateInferRequest());
+        requests.back().SetBlob(inputName, inputs.back());
+    }
+
+    for (int iteration = 0; iteration < 3; iteration++) {
+        for (auto& request : requests)
+            request.StartAsync();
+        for (auto& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::WaitMode::RESULT_READY));
+
+        for (size_t i = 0; i < requestsNum; i++) {
+            auto refRequest = refExecNet.CreateInferRequest();
+            refRequest.SetBlob(inputName, inputs[i]);
+            refRequest.Infer();
+
+            auto expected = refRequest.GetBlob(outputName);
+            auto actual = requests[i].GetBlob(outputName);
+            ASSERT_EQ(Precision::I32, actual->getTensorDesc().getPrecision());
+            ASSERT_EQ(expected->size(), actual->size());
+            auto expectedData = expected->cbuffer().as<const int32_t*>();
+            auto actualData = actual->cbuffer().as<const int32_t*>();
+            for (size_t j = 0; j < actual->size(); j++)
+                ASSERT_NEAR(expectedData[j], actualData[j], 1) << "request " << i << ", element " << j;
+        }
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,89 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "base/import_export_base/import_export_base.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <exec_graph_info.hpp>
+
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/* The network is transformed to the CPU plugin specific operations (FullyConnected, LeakyRelu, SwishCPU),
+ * so the exported network can be read back only with the CPU plugin opset.
+
+    Parameter
+        |
+      MatMul  ->  FullyConnected
+        |
+      PRelu   ->  LeakyRelu
+        |
+      Swish   ->  SwishCPU
+        |
+      Result
+*/
+class ImportCpuSpecificOps : public FuncTestUtils::ImportNetworkTestBase {
+protected:
+    void SetUp() override {
+        Precision netPrecision;
+        std::tie(netPrecision, targetDevice, exportConfiguration, importConfiguration, applicationHeader) = this->GetParam();
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+
+        auto params = ngraph::builder::makeParams(ngPrc, {{2, 64}});
+        auto weights = ngraph::builder::makeConstant<float>(ngPrc, {64, 32}, {}, true, 1.f, -1.f);
+        auto matMul = ngraph::builder::makeMatMul(params[0], weights);
+        auto slope = ngraph::builder::makeConstant<float>(ngPrc, {1}, {0.1f});
+        auto prelu = std::make_shared<ngraph::opset1::PRelu>(matMul, slope);
+        auto swish = std::make_shared<ngraph::opset4::Swish>(prelu);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(swish)};
+        function = std::make_shared<ngraph::Function>(results, params, "ImportCpuSpecificOps");
+    }
+};
+
+TEST_P(ImportCpuSpecificOps, CompareWithRefImpl) {
+    Run();
+};
+
+TEST_P(ImportCpuSpecificOps, ExecGraphIsKeptAfterImport) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // layer name -> the original layers names of the exec graph, fused operations included
+    auto getExecGraphLayers = [this]() {
+        std::map<std::string, std::string> layers;
+        auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+        for (const auto& op : execGraph->get_ops()) {
+            const auto& rtInfo = op->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::ORIGINAL_NAMES);
+            IE_ASSERT(rtInfo.end() != it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != value);
+            layers[op->get_friendly_name()] = value->get();
+        }
+        return layers;
+    };
+
+    configuration.insert(exportConfiguration.begin(), exportConfiguration.end());
+    LoadNetwork();
+    const auto compiledLayers = getExecGraphLayers();
+
+    configuration.insert(importConfiguration.begin(), importConfiguration.end());
+    exportImportNetwork();
+    ASSERT_EQ(compiledLayers, getExecGraphLayers());
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ImportNetworkCase, ImportCpuSpecificOps,
+                        ::testing::Combine(
+                            ::testing::Values(Precision::FP32),
+                            ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                            ::testing::Values(std::map<std::string, std::string>{}),
+                            ::testing::Values(std::map<std::string, std::string>{}),
+                            ::testing::Values("")),
+                        ImportCpuSpecificOps::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,73 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpu/cpu_config.hpp>
+#include <functional_test_utils/plugin_cache.hpp>
+#include <functional_test_utils/skip_tests_config.hpp>
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/builders.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+class NumaMemoryTest : public CommonTestUtils::TestsCommon {
+protected:
+    static CNNNetwork makeNetwork() {
+        auto inputParams = builder::makeParams(element::f32, {Shape{1, 32, 16, 16}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto conv = builder::makeConvolution(paramOuts[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                             {1, 1}, op::PadType::EXPLICIT, 64);
+        auto relu = builder::makeActivation(conv, element::f32, helpers::ActivationTypes::Relu);
+
+        ResultVector results{std::make_shared<opset1::Result>(relu)};
+        return CNNNetwork(std::make_shared<Function>(results, inputParams, "NumaMemory"));
+    }
+
+    static std::map<int, uint64_t> getBoundBytes() {
+        return PluginCache::get().ie()->GetMetric(CommonTestUtils::DEVICE_CPU, CPU_METRIC_KEY(NUMA_NODES_BOUND_BYTES))
+            .as<std::map<int, uint64_t>>();
+    }
+
+    static uint64_t getTotal(const std::map<int, uint64_t>& bytes) {
+        uint64_t total = 0;
+        for (const auto& node : bytes)
+            total += node.second;
+        return total;
+    }
+};
+
+TEST_F(NumaMemoryTest, MetricIsSupported) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    std::vector<std::string> metrics = ie->GetMetric(CommonTestUtils::DEVICE_CPU, METRIC_KEY(SUPPORTED_METRICS));
+    ASSERT_NE(std::find(metrics.begin(), metrics.end(), CPU_METRIC_KEY(NUMA_NODES_BOUND_BYTES)), metrics.end());
+}
+
+TEST_F(NumaMemoryTest, MemoryOfStreamsIsBoundToNodes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // nothing is bound on single node systems
+    if (getBoundBytes().empty())
+        return;
+
+    auto ie = PluginCache::get().ie();
+    const auto before = getTotal(getBoundBytes());
+    {
+        auto execNet = ie->LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                       {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), CONFIG_VALUE(CPU_THROUGHPUT_NUMA)}});
+        auto request = execNet.CreateInferRequest();
+        request.Infer();
+        ASSERT_GT(getTotal(getBoundBytes()), before);
+    }
+    ASSERT_EQ(getTotal(getBoundBytes()), before);
+}
+
+} // namespace SubgraphTestsDefinitions
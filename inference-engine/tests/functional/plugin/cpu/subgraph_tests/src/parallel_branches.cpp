@@ -0,0 +1,80 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+using ParallelBranchesTestParams = std::tuple<size_t,         // number of independent branches
+                                              std::string>;   // parallel graph execution mode (YES/NO)
+
+class ParallelBranchesTest : public testing::WithParamInterface<ParallelBranchesTestParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ParallelBranchesTestParams> obj) {
+        size_t numBranches;
+        std::string parallelMode;
+        std::tie(numBranches, parallelMode) = obj.param;
+
+        std::ostringstream result;
+        result << "NUM_BRANCHES=" << numBranches << "_";
+        result << "PARALLEL=" << parallelMode;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        size_t numBranches;
+        std::string parallelMode;
+        std::tie(numBranches, parallelMode) = this->GetParam();
+
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION, parallelMode});
+
+        auto inputParams = builder::makeParams(element::f32, {Shape{1, 16, 20, 20}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        // Inception-like block: every branch has its own chain of nodes and they meet only in the Concat
+        OutputVector branches;
+        for (size_t i = 0; i < numBranches; i++) {
+            const size_t kernel = 2 * (i % 3) + 1;
+            const ptrdiff_t pad = static_cast<ptrdiff_t>(kernel / 2);
+            auto conv = builder::makeConvolution(paramOuts[0], element::f32, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad},
+                                                 {1, 1}, op::PadType::EXPLICIT, 8);
+            auto relu = builder::makeActivation(conv, element::f32, helpers::ActivationTypes::Relu);
+            auto mul = std::make_shared<opset5::Multiply>(relu, opset5::Constant::create(element::f32, Shape{1}, {0.5f + i}));
+            branches.push_back(mul);
+        }
+
+        auto concat = builder::makeConcat(branches, 1);
+        ResultVector results{std::make_shared<opset5::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ParallelBranches");
+    }
+};
+
+TEST_P(ParallelBranchesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<size_t> numBranches = { 1, 2, 4 };
+const std::vector<std::string> parallelModes = { PluginConfigParams::YES, PluginConfigParams::NO };
+
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelBranchesTest, ParallelBranchesTest,
+                         ::testing::Combine(::testing::ValuesIn(numBranches),
+                                            ::testing::ValuesIn(parallelModes)),
+                         ParallelBranchesTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
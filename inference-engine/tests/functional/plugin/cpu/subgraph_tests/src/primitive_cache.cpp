@@ -0,0 +1,139 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpu/cpu_config.hpp>
+#include <functional_test_utils/blob_utils.hpp>
+#include <functional_test_utils/plugin_cache.hpp>
+#include <functional_test_utils/skip_tests_config.hpp>
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/builders.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+class PrimitiveCacheTest : public CommonTestUtils::TestsCommon {
+protected:
+    static CNNNetwork makeNetwork(const Shape& inputShape = Shape{1, 16, 20, 20}) {
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto conv = builder::makeConvolution(paramOuts[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                             {1, 1}, op::PadType::EXPLICIT, 16);
+        auto relu = builder::makeActivation(conv, element::f32, helpers::ActivationTypes::Relu);
+
+        ResultVector results{std::make_shared<opset1::Result>(relu)};
+        return CNNNetwork(std::make_shared<Function>(results, inputParams, "PrimitiveCache"));
+    }
+
+    static uint64_t getMetric(const std::string& name) {
+        return PluginCache::get().ie()->GetMetric(CommonTestUtils::DEVICE_CPU, name).as<uint64_t>();
+    }
+};
+
+TEST_F(PrimitiveCacheTest, MetricsAreSupported) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    std::vector<std::string> metrics = ie->GetMetric(CommonTestUtils::DEVICE_CPU, METRIC_KEY(SUPPORTED_METRICS));
+    for (const auto& metric : { CPU_METRIC_KEY(PRIMITIVE_CACHE_HITS),
+                                CPU_METRIC_KEY(PRIMITIVE_CACHE_MISSES),
+                                CPU_METRIC_KEY(PRIMITIVE_CACHE_SIZE) }) {
+        ASSERT_NE(std::find(metrics.begin(), metrics.end(), metric), metrics.end()) << metric;
+    }
+}
+
+TEST_F(PrimitiveCacheTest, SecondLoadNetworkReusesPrimitives) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    ie->SetConfig({{CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY, "1024"}}, CommonTestUtils::DEVICE_CPU);
+
+    auto network = makeNetwork();
+    auto firstExecNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    ASSERT_GT(getMetric(CPU_METRIC_KEY(PRIMITIVE_CACHE_SIZE)), 0u);
+
+    const auto hits = getMetric(CPU_METRIC_KEY(PRIMITIVE_CACHE_HITS));
+    const auto misses = getMetric(CPU_METRIC_KEY(PRIMITIVE_CACHE_MISSES));
+    auto secondExecNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    ASSERT_GT(getMetric(CPU_METRIC_KEY(PRIMITIVE_CACHE_HITS)), hits);
+    ASSERT_EQ(getMetric(CPU_METRIC_KEY(PRIMITIVE_CACHE_MISSES)), misses);
+}
+
+TEST_F(PrimitiveCacheTest, ZeroCapacityDisablesCache) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    ie->SetConfig({{CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY, "0"}}, CommonTestUtils::DEVICE_CPU);
+    ASSERT_EQ(getMetric(CPU_METRIC_KEY(PRIMITIVE_CACHE_SIZE)), 0u);
+
+    const auto hits = getMetric(CPU_METRIC_KEY(PRIMITIVE_CACHE_HITS));
+    auto network = makeNetwork();
+    auto firstExecNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto secondExecNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    ASSERT_EQ(getMetric(CPU_METRIC_KEY(PRIMITIVE_CACHE_HITS)), hits);
+    ASSERT_EQ(getMetric(CPU_METRIC_KEY(PRIMITIVE_CACHE_SIZE)), 0u);
+
+    ie->SetConfig({{CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY, "1024"}}, CommonTestUtils::DEVICE_CPU);
+}
+
+// the same cached convolution is executed at once by the streams of both networks, so each node has to pass
+// own scratchpad to the primitive
+TEST_F(PrimitiveCacheTest, ConcurrentInferWithSharedPrimitives) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    constexpr size_t requestsPerNetwork = 4;
+    auto ie = PluginCache::get().ie();
+    ie->SetConfig({{CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY, "1024"}}, CommonTestUtils::DEVICE_CPU);
+
+    auto network = makeNetwork(Shape{1, 16, 64, 64});
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    const std::map<std::string, std::string> config = {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2"}};
+
+    std::vector<ExecutableNetwork> execNets;
+    execNets.push_back(ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config));
+    const auto hits = getMetric(CPU_METRIC_KEY(PRIMITIVE_CACHE_HITS));
+    execNets.push_back(ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config));
+    ASSERT_GT(getMetric(CPU_METRIC_KEY(PRIMITIVE_CACHE_HITS)), hits);
+
+    std::vector<InferRequest> requests;
+    std::vector<std::vector<float>> expected;
+    for (auto& execNet : execNets) {
+        for (size_t i = 0; i < requestsPerNetwork; i++) {
+            auto input = FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc(),
+                                                          10, -5, 1, static_cast<int>(requests.size()));
+            requests.push_back(execNet.CreateInferRequest());
+            requests.back().SetBlob(inputName, input);
+
+            // references are computed while nothing else is running
+            requests.back().Infer();
+            auto output = requests.back().GetBlob(outputName);
+            auto outputData = output->cbuffer().as<const float*>();
+            expected.emplace_back(outputData, outputData + output->size());
+        }
+    }
+
+    for (int iteration = 0; iteration < 10; iteration++) {
+        for (auto& request : requests)
+            request.StartAsync();
+        for (auto& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::WaitMode::RESULT_READY));
+
+        for (size_t i = 0; i < requests.size(); i++) {
+            auto actual = requests[i].GetBlob(outputName);
+            ASSERT_EQ(expected[i].size(), actual->size());
+            auto actualData = actual->cbuffer().as<const float*>();
+            for (size_t j = 0; j < actual->size(); j++)
+                ASSERT_NEAR(expected[i][j], actualData[j], 1e-3f) << "request " << i << ", element " << j;
+        }
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,130 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <functional_test_utils/blob_utils.hpp>
+#include <functional_test_utils/plugin_cache.hpp>
+#include <functional_test_utils/skip_tests_config.hpp>
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/builders.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+using RuntimeReshapeTestParams = std::tuple<std::vector<SizeVector>,   // sequence of input shapes to infer
+                                            size_t>;                   // runtime reshape cache size
+
+class RuntimeReshapeTest : public testing::WithParamInterface<RuntimeReshapeTestParams>,
+                           public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<RuntimeReshapeTestParams> obj) {
+        std::vector<SizeVector> shapes;
+        size_t cacheSize;
+        std::tie(shapes, cacheSize) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=";
+        for (const auto& shape : shapes)
+            result << CommonTestUtils::vec2str(shape);
+        result << "_CACHE_SIZE=" << cacheSize;
+
+        return result.str();
+    }
+
+protected:
+    static std::shared_ptr<Function> makeFunction(const SizeVector& inputShape) {
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto conv = builder::makeConvolution(paramOuts[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                             {1, 1}, op::PadType::EXPLICIT, 8);
+        auto relu = builder::makeActivation(conv, element::f32, helpers::ActivationTypes::Relu);
+        auto pool = builder::makePooling(relu, {2, 2}, {0, 0}, {0, 0}, {2, 2}, op::RoundingType::FLOOR,
+                                         op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+
+        ResultVector results{std::make_shared<opset1::Result>(pool)};
+        return std::make_shared<Function>(results, inputParams, "RuntimeReshape");
+    }
+};
+
+TEST_P(RuntimeReshapeTest, CompareWithStaticNetworks) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    std::vector<SizeVector> shapes;
+    size_t cacheSize;
+    std::tie(shapes, cacheSize) = GetParam();
+
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(makeFunction(shapes.front()));
+    auto execNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                   {{PluginConfigInternalParams::KEY_CPU_RUNTIME_RESHAPE_CACHE_SIZE, std::to_string(cacheSize)}});
+    auto inferRequest = execNet.CreateInferRequest();
+
+    const auto inputName = network.getInputsInfo().begin()->first;
+    const auto outputName = network.getOutputsInfo().begin()->first;
+    for (size_t i = 0; i < shapes.size(); i++) {
+        TensorDesc inputDesc(Precision::FP32, shapes[i], Layout::NCHW);
+        auto input = FuncTestUtils::createAndFillBlobFloatNormalDistribution(inputDesc, 0.0f, 0.2f, static_cast<int32_t>(i));
+
+        inferRequest.SetBlob(inputName, input);
+        ASSERT_NO_THROW(inferRequest.Infer());
+        auto actual = inferRequest.GetBlob(outputName);
+
+        // reference is a network compiled for the particular shape
+        CNNNetwork refNetwork(makeFunction(shapes[i]));
+        auto refRequest = ie->LoadNetwork(refNetwork, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+        refRequest.SetBlob(inputName, input);
+        refRequest.Infer();
+        auto expected = refRequest.GetBlob(outputName);
+
+        ASSERT_EQ(expected->getTensorDesc().getDims(), actual->getTensorDesc().getDims());
+        FuncTestUtils::compareBlobs(actual, expected);
+    }
+}
+
+TEST_P(RuntimeReshapeTest, ThrowsOnReshapeIfDisabled) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    std::vector<SizeVector> shapes;
+    size_t cacheSize;
+    std::tie(shapes, cacheSize) = GetParam();
+
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(makeFunction(shapes.front()));
+    auto inferRequest = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+
+    const auto inputName = network.getInputsInfo().begin()->first;
+    for (const auto& shape : shapes) {
+        auto input = make_blob_with_precision(TensorDesc(Precision::FP32, shape, Layout::NCHW));
+        input->allocate();
+        if (shape == shapes.front()) {
+            ASSERT_NO_THROW(inferRequest.SetBlob(inputName, input));
+        } else {
+            ASSERT_ANY_THROW(inferRequest.SetBlob(inputName, input));
+        }
+    }
+}
+
+namespace {
+
+const std::vector<std::vector<SizeVector>> inputShapes = {
+    {{1, 3, 16, 16}, {1, 3, 32, 24}, {1, 3, 16, 16}},
+    {{1, 3, 16, 16}, {1, 3, 8, 40}, {2, 3, 12, 12}, {1, 3, 8, 40}, {1, 3, 16, 16}},
+};
+
+const std::vector<size_t> cacheSizes = { 1, 4 };
+
+INSTANTIATE_TEST_SUITE_P(smoke_RuntimeReshapeTest, RuntimeReshapeTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::ValuesIn(cacheSizes)),
+                         RuntimeReshapeTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
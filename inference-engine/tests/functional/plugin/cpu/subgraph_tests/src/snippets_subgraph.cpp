@@ -0,0 +1,145 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <exec_graph_info.hpp>
+#include <ie_system_conf.h>
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+using SnippetsSubgraphTestParams = std::tuple<std::vector<size_t>,   // data input shape
+                                              std::vector<size_t>>;  // broadcasted input shape
+
+class SnippetsSubgraphTest : public testing::WithParamInterface<SnippetsSubgraphTestParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SnippetsSubgraphTestParams> obj) {
+        std::vector<size_t> dataShape, bcastShape;
+        std::tie(dataShape, bcastShape) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(dataShape) << "_";
+        result << "BS=" << CommonTestUtils::vec2str(bcastShape);
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::vector<size_t> dataShape, bcastShape;
+        std::tie(dataShape, bcastShape) = this->GetParam();
+
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_SNIPPETS, PluginConfigParams::YES});
+
+        auto inputParams = builder::makeParams(element::f32, {dataShape, bcastShape});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        // the Add result is consumed by two branches, so the whole diamond is collapsed into a single snippet
+        auto add = std::make_shared<opset1::Add>(paramOuts[0], paramOuts[1]);
+        auto mul = std::make_shared<opset1::Multiply>(add, opset1::Constant::create(element::f32, Shape{1}, {0.5f}));
+        auto sub = std::make_shared<opset1::Subtract>(add, paramOuts[1]);
+        auto relu = std::make_shared<opset1::Relu>(sub);
+        auto max = std::make_shared<opset1::Maximum>(mul, relu);
+
+        auto concat = builder::makeConcat({max, add}, 1);
+        ResultVector results{std::make_shared<opset1::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "SnippetsSubgraph");
+    }
+
+    void CheckSnippetsCount(bool expectSnippets = true) {
+        auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, execGraph);
+        size_t snippetsCount = 0;
+        for (const auto& node : execGraph->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            ASSERT_NE(rtInfo.end(), it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            ASSERT_NE(nullptr, value);
+            if (value->get() == "Subgraph")
+                snippetsCount++;
+        }
+        if (expectSnippets && with_cpu_x86_avx2())
+            ASSERT_NE(0, snippetsCount);
+        else
+            ASSERT_EQ(0, snippetsCount);
+    }
+};
+
+TEST_P(SnippetsSubgraphTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckSnippetsCount();
+}
+
+// the snippet node doesn't support PRelu with the slope broadcasted by the channel, so the tokenized subgraph
+// has to be turned back to the plain operations instead of failing the network loading
+class SnippetsRejectedSubgraphTest : public SnippetsSubgraphTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::vector<size_t> dataShape, slopeShape;
+        std::tie(dataShape, slopeShape) = this->GetParam();
+
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_SNIPPETS, PluginConfigParams::YES});
+
+        auto inputParams = builder::makeParams(element::f32, {dataShape, slopeShape});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto add = std::make_shared<opset1::Add>(paramOuts[0], opset1::Constant::create(element::f32, Shape{1}, {1.0f}));
+        auto prelu = std::make_shared<opset1::PRelu>(add, paramOuts[1]);
+        auto mul = std::make_shared<opset1::Multiply>(prelu, opset1::Constant::create(element::f32, Shape{1}, {0.5f}));
+
+        auto concat = builder::makeConcat({mul, add}, 1);
+        ResultVector results{std::make_shared<opset1::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "SnippetsRejectedSubgraph");
+    }
+};
+
+TEST_P(SnippetsRejectedSubgraphTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckSnippetsCount(false);
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> dataShapes = {
+    {1, 3, 16, 16},
+};
+
+const std::vector<std::vector<size_t>> bcastShapes = {
+    {1, 3, 16, 16},
+    {1, 3, 1, 16},
+    {1, 3, 16, 1},
+    {1, 1, 16, 16},
+    {3, 1, 1},
+    {1},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsSubgraphTest, SnippetsSubgraphTest,
+                         ::testing::Combine(::testing::ValuesIn(dataShapes),
+                                            ::testing::ValuesIn(bcastShapes)),
+                         SnippetsSubgraphTest::getTestCaseName);
+
+const std::vector<std::vector<size_t>> slopeShapes = {
+    {1, 3, 1, 1},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsRejectedSubgraphTest, SnippetsRejectedSubgraphTest,
+                         ::testing::Combine(::testing::ValuesIn(dataShapes),
+                                            ::testing::ValuesIn(slopeShapes)),
+                         SnippetsRejectedSubgraphTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
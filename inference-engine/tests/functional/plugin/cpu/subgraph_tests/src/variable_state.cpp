@@ -0,0 +1,211 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <functional_test_utils/blob_utils.hpp>
+#include <functional_test_utils/plugin_cache.hpp>
+#include <functional_test_utils/skip_tests_config.hpp>
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/builders.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+enum class StateConsumer {
+    PassThrough,  // ReadValue is connected to Assign directly
+    InPlace,      // the only consumer of ReadValue may work in-place
+    NotInPlace    // ReadValue has several consumers, so none of them works in-place
+};
+
+/* The state is accumulated: the output sum = state + input is assigned as the new state. The pass through network
+ * assigns the read state back as is. With several consumers the network also outputs doubled = 2 * state.
+
+    Constant
+        |
+    ReadValue     Parameter
+      |     \      /
+      |       Add (sum) -> Result
+      |        |
+    Multiply  Assign
+ */
+class VariableStateTest : public testing::WithParamInterface<StateConsumer>, public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<StateConsumer> obj) {
+        switch (obj.param) {
+            case StateConsumer::PassThrough: return "PassThrough";
+            case StateConsumer::InPlace: return "InPlace";
+            default: return "NotInPlace";
+        }
+    }
+
+protected:
+    static constexpr size_t size = 16;
+    const std::string variableName = "state";
+
+    CNNNetwork makeNetwork() const {
+        auto params = builder::makeParams(element::f32, {Shape{1, size}});
+        auto init = builder::makeConstant<float>(element::f32, Shape{1, size}, std::vector<float>(size, 1.f));
+        auto read = std::make_shared<opset3::ReadValue>(init, variableName);
+
+        auto sum = std::make_shared<opset1::Add>(read, params[0]);
+        sum->set_friendly_name("sum");
+        ResultVector results{std::make_shared<opset1::Result>(sum)};
+        if (GetParam() == StateConsumer::NotInPlace) {
+            auto two = builder::makeConstant<float>(element::f32, Shape{1, 1}, {2.f});
+            auto doubled = std::make_shared<opset1::Multiply>(read, two);
+            doubled->set_friendly_name("doubled");
+            results.push_back(std::make_shared<opset1::Result>(doubled));
+        }
+
+        std::shared_ptr<opset3::Assign> assign;
+        if (GetParam() == StateConsumer::PassThrough) {
+            assign = std::make_shared<opset3::Assign>(read, variableName);
+        } else {
+            assign = std::make_shared<opset3::Assign>(sum, variableName);
+        }
+        assign->add_control_dependency(read);
+
+        return CNNNetwork(std::make_shared<Function>(results, SinkVector{assign}, params, "VariableState"));
+    }
+
+    static void compare(const Blob::CPtr& blob, const std::vector<float>& expected) {
+        ASSERT_EQ(expected.size(), blob->size());
+        auto data = blob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_FLOAT_EQ(expected[i], data[i]) << "at index " << i;
+        }
+    }
+
+    static std::vector<float> toVector(const Blob::CPtr& blob) {
+        auto data = blob->cbuffer().as<const float*>();
+        return std::vector<float>(data, data + blob->size());
+    }
+
+    /**
+     * @brief Runs the inference and checks the outputs and the state. The state blob is taken before the inference,
+     * it has to show the new state as well.
+     */
+    void inferAndCheck(InferRequest& request, std::vector<float>& state, const Blob::CPtr& stateBlob, int seed) const {
+        TensorDesc desc(Precision::FP32, {1, size}, Layout::NC);
+        auto input = FuncTestUtils::createAndFillBlob(desc, 10, -5, 1, seed);
+        request.SetBlob(inputName, input);
+        request.Infer();
+
+        const auto x = toVector(input);
+        std::vector<float> sum(size), doubled(size);
+        for (size_t i = 0; i < size; i++) {
+            sum[i] = state[i] + x[i];
+            doubled[i] = 2.f * state[i];
+        }
+        compare(request.GetBlob("sum"), sum);
+        if (GetParam() == StateConsumer::NotInPlace) {
+            compare(request.GetBlob("doubled"), doubled);
+        }
+
+        if (GetParam() != StateConsumer::PassThrough) {
+            state = sum;
+        }
+        compare(stateBlob, state);
+        compare(request.QueryState()[0].GetState(), state);
+    }
+
+    std::string inputName;
+};
+
+TEST_P(VariableStateTest, MixedStateOperations) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    auto network = makeNetwork();
+    inputName = network.getInputsInfo().begin()->first;
+    auto execNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto request = execNet.CreateInferRequest();
+
+    auto states = request.QueryState();
+    ASSERT_EQ(1, states.size());
+    ASSERT_EQ(variableName, states[0].GetName());
+    // the blob is taken once, it must follow the state through all the inferences
+    const auto stateBlob = states[0].GetState();
+    std::vector<float> state(size, 1.f);
+    compare(stateBlob, state);
+
+    inferAndCheck(request, state, stateBlob, 1);
+    inferAndCheck(request, state, stateBlob, 2);
+
+    TensorDesc desc(Precision::FP32, {1, size}, Layout::NC);
+    auto newState = FuncTestUtils::createAndFillBlob(desc, 10, -5, 1, 3);
+    states[0].SetState(newState);
+    state = toVector(newState);
+    compare(stateBlob, state);
+    inferAndCheck(request, state, stateBlob, 4);
+    inferAndCheck(request, state, stateBlob, 5);
+
+    states[0].Reset();
+    state.assign(size, 0.f);
+    compare(stateBlob, state);
+    inferAndCheck(request, state, stateBlob, 6);
+
+    // the state set before the inference is used even if it's set several times
+    states[0].SetState(FuncTestUtils::createAndFillBlob(desc, 10, -5, 1, 7));
+    newState = FuncTestUtils::createAndFillBlob(desc, 10, -5, 1, 8);
+    states[0].SetState(newState);
+    state = toVector(newState);
+    inferAndCheck(request, state, stateBlob, 9);
+}
+
+TEST_P(VariableStateTest, RequestsSharingStreamGraph) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    auto network = makeNetwork();
+    inputName = network.getInputsInfo().begin()->first;
+    // a single stream, so both requests run the same graph and have to keep their own states
+    auto execNet = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "1"}});
+    auto request1 = execNet.CreateInferRequest();
+    auto request2 = execNet.CreateInferRequest();
+
+    const auto stateBlob1 = request1.QueryState()[0].GetState();
+    const auto stateBlob2 = request2.QueryState()[0].GetState();
+    std::vector<float> state1(size, 1.f), state2(size, 1.f);
+
+    inferAndCheck(request1, state1, stateBlob1, 1);
+    inferAndCheck(request2, state2, stateBlob2, 2);
+    inferAndCheck(request1, state1, stateBlob1, 3);
+
+    request2.QueryState()[0].Reset();
+    state2.assign(size, 0.f);
+    compare(stateBlob1, state1);
+    inferAndCheck(request1, state1, stateBlob1, 4);
+    inferAndCheck(request2, state2, stateBlob2, 5);
+
+    // the asynchronous inferences of both requests go through the same stream
+    TensorDesc desc(Precision::FP32, {1, size}, Layout::NC);
+    auto input1 = FuncTestUtils::createAndFillBlob(desc, 10, -5, 1, 6);
+    auto input2 = FuncTestUtils::createAndFillBlob(desc, 10, -5, 1, 7);
+    request1.SetBlob(inputName, input1);
+    request2.SetBlob(inputName, input2);
+    request1.StartAsync();
+    request2.StartAsync();
+    request1.Wait(InferRequest::WaitMode::RESULT_READY);
+    request2.Wait(InferRequest::WaitMode::RESULT_READY);
+    const auto x1 = toVector(input1), x2 = toVector(input2);
+    for (size_t i = 0; i < size; i++) {
+        if (GetParam() != StateConsumer::PassThrough) {
+            state1[i] += x1[i];
+            state2[i] += x2[i];
+        }
+    }
+    compare(stateBlob1, state1);
+    compare(stateBlob2, state2);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_VariableState, VariableStateTest,
+                         ::testing::Values(StateConsumer::PassThrough, StateConsumer::InPlace, StateConsumer::NotInPlace),
+                         VariableStateTest::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
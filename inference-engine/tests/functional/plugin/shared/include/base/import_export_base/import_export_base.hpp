@@ -29,7 +29,6 @@ protected:
     std::map<std::string, std::string> importConfiguration;
     std::string                        applicationHeader;
 
-private:
     virtual void exportImportNetwork();
 };
 
@@ -38,7 +38,12 @@ struct HeteroSyntheticTest : public testing::WithParamInterface<HeteroSyntheticT
     static std::string getTestCaseName(const ::testing::TestParamInfo<HeteroSyntheticTestParameters>& obj);
     static std::vector<FunctionParameter> _singleMajorNodeFunctions;
     static std::vector<FunctionParameter> _randomMajorNodeFunctions;
+    static std::vector<FunctionParameter> _independentBranchesFunctions;
     std::vector<std::string> _registredPlugins;
 };
 
+struct HeteroFailedSubgraphTest : public HeteroSyntheticTest {
+    static std::vector<FunctionParameter> _failedSubgraphFunctions;
+};
+
 }  //  namespace HeteroTests
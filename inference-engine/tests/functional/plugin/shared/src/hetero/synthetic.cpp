@@ -61,6 +61,47 @@ std::vector<FunctionParameter> HeteroSyntheticTest::_randomMajorNodeFunctions{[]
     return results;
 } ()};
 
+// Two branches without common nodes, the first one is placed on the major plugin and the second one on the fallback
+// plugin, so the subgraphs of the branches are inferred concurrently
+std::vector<FunctionParameter> HeteroSyntheticTest::_independentBranchesFunctions{[] {
+    auto ngPrc = ngraph::element::Type_t::f32;
+    auto params = ngraph::builder::makeParams(ngPrc, {{1, 3, 16, 16}, {1, 3, 16, 16}});
+    ngraph::ResultVector results;
+    std::unordered_set<std::string> majorPluginNodeIds;
+    for (std::size_t branch = 0; branch < params.size(); ++branch) {
+        auto conv = ngraph::builder::makeConvolution(params[branch], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 8);
+        conv->set_friendly_name("Conv_" + std::to_string(branch));
+        auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+        relu->set_friendly_name("Relu_" + std::to_string(branch));
+        results.push_back(std::make_shared<ngraph::opset1::Result>(relu));
+        if (branch == 0) {
+            majorPluginNodeIds.insert({conv->get_friendly_name(), relu->get_friendly_name()});
+        }
+    }
+    auto function = std::make_shared<ngraph::Function>(results, params, "IndependentBranches");
+    return std::vector<FunctionParameter>{{majorPluginNodeIds, function}};
+} ()};
+
+// The EmbeddingBagPackedSum subgraph on the fallback plugin fails on out of range indices, the subgraph of the major
+// plugin consumes its output
+std::vector<FunctionParameter> HeteroFailedSubgraphTest::_failedSubgraphFunctions{[] {
+    auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 4});
+    data->set_friendly_name("Data");
+    auto indices = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::i32, ngraph::Shape{2, 2});
+    indices->set_friendly_name("Indices");
+    auto table = ngraph::builder::makeConstant<float>(ngraph::element::f32, {10, 4}, {}, true);
+    auto embeddingBag = std::make_shared<ngraph::opset3::EmbeddingBagPackedSum>(table, indices);
+    embeddingBag->set_friendly_name("EmbeddingBag");
+    auto relu = std::make_shared<ngraph::opset1::Relu>(data);
+    relu->set_friendly_name("Relu");
+    auto add = std::make_shared<ngraph::opset1::Add>(relu, embeddingBag);
+    add->set_friendly_name("Add");
+    auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(add)},
+                                                       ngraph::ParameterVector{data, indices}, "FailedSubgraph");
+    return std::vector<FunctionParameter>{{{relu->get_friendly_name(), add->get_friendly_name()}, function}};
+} ()};
+
 std::string HeteroSyntheticTest::getTestCaseName(const ::testing::TestParamInfo<HeteroSyntheticTestParameters>& obj) {
     std::vector<PluginParameter> pluginParameters;
     FunctionParameter functionParamter;
@@ -149,4 +190,31 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroFailedSubgraphTest, failedSubgraphFailsWholeRequest) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    LoadNetwork();
+    auto request = executableNetwork.CreateInferRequest();
+    for (auto&& input : executableNetwork.GetInputsInfo()) {
+        request.SetBlob(input.first, FuncTestUtils::createAndFillBlob(input.second->getTensorDesc()));
+    }
+    auto setIndices = [&](int32_t value) {
+        auto indices = request.GetBlob("Indices");
+        auto data = indices->buffer().as<int32_t*>();
+        std::fill(data, data + indices->size(), value);
+    };
+
+    setIndices(100);
+    ASSERT_THROW(request.Infer(), InferenceEngine::Exception);
+    request.StartAsync();
+    ASSERT_THROW(request.Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY), InferenceEngine::Exception);
+
+    // the request is still usable after the failure
+    setIndices(1);
+    ASSERT_NO_THROW(request.Infer());
+    request.StartAsync();
+    ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY));
+}
+
 }  //  namespace HeteroTests
@@ -0,0 +1,217 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <ie_parallel.hpp>
+#include <ngraph/type/float16.hpp>
+#include "nodes/common/cpu_convert.h"
+#include "utils/bfloat16.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+namespace {
+
+double getValue(const std::vector<uint8_t>& buffer, Precision prc, size_t i) {
+    const void* data = buffer.data();
+    switch (prc) {
+        case Precision::U8: return static_cast<const uint8_t*>(data)[i];
+        case Precision::I8: return static_cast<const int8_t*>(data)[i];
+        case Precision::U16: return static_cast<const uint16_t*>(data)[i];
+        case Precision::I16: return static_cast<const int16_t*>(data)[i];
+        case Precision::I32: return static_cast<const int32_t*>(data)[i];
+        case Precision::FP32: return static_cast<const float*>(data)[i];
+        case Precision::FP16: return static_cast<float>(static_cast<const ngraph::float16*>(data)[i]);
+        case Precision::BF16: return static_cast<float>(static_cast<const bfloat16_t*>(data)[i]);
+        case Precision::BOOL: return static_cast<const uint8_t*>(data)[i];
+        default: IE_THROW() << "Unexpected precision " << prc;
+    }
+}
+
+template <typename T>
+T clampTo(double value) {
+    return static_cast<T>(std::min<double>(std::max<double>(value, std::numeric_limits<T>::lowest()), std::numeric_limits<T>::max()));
+}
+
+void setValue(std::vector<uint8_t>& buffer, Precision prc, size_t i, double value) {
+    void* data = buffer.data();
+    switch (prc) {
+        case Precision::U8: static_cast<uint8_t*>(data)[i] = clampTo<uint8_t>(value); break;
+        case Precision::I8: static_cast<int8_t*>(data)[i] = clampTo<int8_t>(value); break;
+        case Precision::U16: static_cast<uint16_t*>(data)[i] = clampTo<uint16_t>(value); break;
+        case Precision::I16: static_cast<int16_t*>(data)[i] = clampTo<int16_t>(value); break;
+        case Precision::I32: static_cast<int32_t*>(data)[i] = clampTo<int32_t>(value); break;
+        case Precision::FP32: static_cast<float*>(data)[i] = static_cast<float>(value); break;
+        case Precision::FP16: static_cast<ngraph::float16*>(data)[i] = ngraph::float16(static_cast<float>(value)); break;
+        case Precision::BF16: static_cast<bfloat16_t*>(data)[i] = bfloat16_t(static_cast<float>(value)); break;
+        default: IE_THROW() << "Unexpected precision " << prc;
+    }
+}
+
+bool isFloat(Precision prc) {
+    return prc == Precision::FP32 || prc == Precision::FP16 || prc == Precision::BF16;
+}
+
+std::vector<uint8_t> makeSource(Precision prc, size_t size) {
+    static const double special[] = {0., -0., 0.5, -0.5, 1.75, -1.75, 127.5, 128., -129., 255.5, 256., 65535.9, 65536.,
+                                     -32769., 2147483520., 2147483648., -2147483904., 3e9, -3e9,
+                                     std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+                                     std::numeric_limits<double>::quiet_NaN()};
+    const size_t specialCount = isFloat(prc) ? sizeof(special) / sizeof(special[0]) : 0;
+
+    std::vector<uint8_t> buffer(size * prc.size());
+    uint32_t state = 12345;
+    for (size_t i = 0; i < size; i++) {
+        state = state * 1664525u + 1013904223u;
+        double value = static_cast<int32_t>(state) / 16384.;  // [-131072, 131072)
+        if (i % 7 == 0 && specialCount) {
+            value = special[(i / 7) % specialCount];
+        } else if (!isFloat(prc)) {
+            // random bits of the whole type range
+            const int shift = 32 - 8 * static_cast<int>(prc.size());
+            value = (prc == Precision::U8 || prc == Precision::U16) ? static_cast<double>(state >> shift)
+                                                                    : static_cast<double>(static_cast<int32_t>(state) >> shift);
+        }
+        setValue(buffer, prc, i, value);
+    }
+    return buffer;
+}
+
+// expected semantics: integer results are saturated, floating point values are truncated and NaN gives the lowest value
+double expectedValue(double value, Precision dstPrc) {
+    auto saturate = [&](double lowest, double highest) {
+        if (std::isnan(value) || value <= lowest)
+            return lowest;
+        if (value >= highest)
+            return highest;
+        return std::trunc(value);
+    };
+
+    switch (dstPrc) {
+        case Precision::U8: return saturate(0, 255);
+        case Precision::I8: return saturate(-128, 127);
+        case Precision::U16: return saturate(0, 65535);
+        case Precision::I16: return saturate(-32768, 32767);
+        case Precision::I32: return saturate(-2147483648., 2147483647.);
+        case Precision::BOOL: return value != 0 ? 1 : 0;
+        default: return value;
+    }
+}
+
+bool isClose(double actual, double expected, Precision dstPrc) {
+    if (std::isnan(expected))
+        return std::isnan(actual);
+    if (actual == expected)
+        return true;
+    switch (dstPrc) {
+        case Precision::FP32:
+            return static_cast<float>(expected) == actual;
+        case Precision::FP16:
+            if (std::fabs(expected) >= 65520.)
+                return std::isinf(actual) && std::signbit(actual) == std::signbit(expected);
+            return std::fabs(actual - expected) <= std::max(std::fabs(expected) * std::ldexp(1., -11), std::ldexp(1., -24));
+        case Precision::BF16:
+            return std::fabs(actual - expected) <= std::fabs(expected) * std::ldexp(1., -7);
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+using CpuConvertTestParams = std::tuple<Precision, Precision, size_t>;
+
+class CpuConvertTest : public ::testing::TestWithParam<CpuConvertTestParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<CpuConvertTestParams>& obj) {
+        return std::string(std::get<0>(obj.param).name()) + "_" + std::get<1>(obj.param).name() + "_" +
+               std::to_string(std::get<2>(obj.param));
+    }
+};
+
+TEST_P(CpuConvertTest, matchesReference) {
+    Precision srcPrc, dstPrc;
+    size_t size;
+    std::tie(srcPrc, dstPrc, size) = GetParam();
+    if (srcPrc == dstPrc)
+        GTEST_SKIP();
+
+    const auto src = makeSource(srcPrc, size);
+    std::vector<uint8_t> dst(size * dstPrc.size());
+
+    cpu_convert(src.data(), dst.data(), srcPrc, dstPrc, size);
+
+    for (size_t i = 0; i < size; i++) {
+        const auto value = getValue(src, srcPrc, i);
+        const auto expected = expectedValue(value, dstPrc);
+        const auto actual = getValue(dst, dstPrc, i);
+        ASSERT_TRUE(isClose(actual, expected, dstPrc)) << "element " << i << ": " << value << " is converted to "
+                                                       << actual << ", expected " << expected;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(CpuConvert, CpuConvertTest,
+    ::testing::Combine(
+        ::testing::Values(Precision::U8, Precision::I8, Precision::U16, Precision::I16,
+                          Precision::I32, Precision::FP32, Precision::FP16, Precision::BF16),
+        ::testing::Values(Precision::U8, Precision::I8, Precision::U16, Precision::I16,
+                          Precision::I32, Precision::FP32, Precision::FP16, Precision::BF16, Precision::BOOL),
+        ::testing::Values(1, 67, 100003)),
+    CpuConvertTest::getTestCaseName);
+
+namespace {
+
+template <typename srcType, typename dstType>
+void benchmarkConversion(Precision srcPrc, Precision dstPrc) {
+    const size_t size = 1920 * 1080 * 3;
+    const auto src = makeSource(srcPrc, size);
+    std::vector<uint8_t> dst(size * dstPrc.size());
+
+    auto measure = [&](const std::function<void()>& func) {
+        using namespace std::chrono;
+        double best = std::numeric_limits<double>::max();
+        for (int i = 0; i < 10; i++) {
+            const auto start = steady_clock::now();
+            func();
+            best = std::min(best, duration<double, std::milli>(steady_clock::now() - start).count());
+        }
+        return best;
+    };
+
+    // the element-wise conversion which was used before
+    const auto before = measure([&] {
+        const auto srcData = reinterpret_cast<const srcType*>(src.data());
+        auto dstData = reinterpret_cast<dstType*>(dst.data());
+        parallel_for(size, [&](size_t i) {
+            dstData[i] = static_cast<dstType>(srcData[i]);
+        });
+    });
+    const auto after = measure([&] { cpu_convert(src.data(), dst.data(), srcPrc, dstPrc, size); });
+
+    std::cout << srcPrc << " -> " << dstPrc << ": element-wise " << before << " ms, cpu_convert " << after << " ms ("
+              << size * (srcPrc.size() + dstPrc.size()) / after / 1e6 << " GB/s)" << std::endl;
+}
+
+}  // namespace
+
+// Throughput of full HD frame conversions, run with --gtest_also_run_disabled_tests
+TEST(CpuConvertBenchmark, DISABLED_frameConversions) {
+    benchmarkConversion<uint8_t, float>(Precision::U8, Precision::FP32);
+    benchmarkConversion<float, uint8_t>(Precision::FP32, Precision::U8);
+    benchmarkConversion<int32_t, float>(Precision::I32, Precision::FP32);
+    benchmarkConversion<float, bfloat16_t>(Precision::FP32, Precision::BF16);
+    benchmarkConversion<bfloat16_t, float>(Precision::BF16, Precision::FP32);
+    benchmarkConversion<ngraph::float16, float>(Precision::FP16, Precision::FP32);
+    benchmarkConversion<float, ngraph::float16>(Precision::FP32, Precision::FP16);
+}
@@ -0,0 +1,417 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+// to suppress deprecated definition errors
+#define IMPLEMENT_INFERENCE_ENGINE_PLUGIN
+#include "runtime/gna_float_runtime.hpp"
+
+using namespace GNAPluginNS::runtime;
+
+namespace {
+// the primitives are compared with the straightforward loops, the sums are accumulated in a different order
+constexpr float kTolerance = 1e-4f;
+
+void ReferenceAffine(const std::vector<float>& weights, const std::vector<float>& biases, const std::vector<float>& input,
+                     std::vector<float>& output, uint32_t outputs, uint32_t inputs, uint32_t batch) {
+    for (uint32_t i = 0; i < outputs; i++) {
+        for (uint32_t j = 0; j < batch; j++) {
+            float sum = biases[i];
+            for (uint32_t k = 0; k < inputs; k++) {
+                sum += weights[i * inputs + k] * input[k * batch + j];
+            }
+            output[i * batch + j] = sum;
+        }
+    }
+}
+
+#if GNA_LIB_VER == 2
+struct Convolution2DParams {
+    uint32_t IH, IW, IC, KH, KW, OC, SH, SW, PH, PW;
+
+    uint32_t OH() const { return (IH + 2 * PH - KH) / SH + 1; }
+    uint32_t OW() const { return (IW + 2 * PW - KW) / SW + 1; }
+    // every kernel is aligned to 16 bytes
+    uint32_t KernelStride() const { return (KH * KW * IC + 3) / 4 * 4; }
+};
+
+void ReferenceConvolution2D(const Convolution2DParams& p, const std::vector<float>& filters, const std::vector<float>& biases,
+                            const std::vector<float>& input, std::vector<float>& output) {
+    const uint32_t OH = p.OH(), OW = p.OW(), kernel_stride = p.KernelStride();
+    for (uint32_t oh = 0; oh < OH; oh++) {
+        for (uint32_t ow = 0; ow < OW; ow++) {
+            for (uint32_t oc = 0; oc < p.OC; oc++) {
+                float sum = 0;
+                for (uint32_t kh = 0; kh < p.KH; kh++) {
+                    for (uint32_t kw = 0; kw < p.KW; kw++) {
+                        const int ih = static_cast<int>(oh * p.SH + kh) - static_cast<int>(p.PH);
+                        const int iw = static_cast<int>(ow * p.SW + kw) - static_cast<int>(p.PW);
+                        if (ih < 0 || iw < 0 || ih >= static_cast<int>(p.IH) || iw >= static_cast<int>(p.IW)) {
+                            continue;
+                        }
+                        for (uint32_t kc = 0; kc < p.IC; kc++) {
+                            sum += input[(ih * p.IW + iw) * p.IC + kc] * filters[oc * kernel_stride + (kh * p.KW + kw) * p.IC + kc];
+                        }
+                    }
+                }
+                output[(oh * OW + ow) * p.OC + oc] = sum + biases[oc];
+            }
+        }
+    }
+}
+#endif
+
+void ReferenceSigmoid(const std::vector<float>& input, std::vector<float>& output) {
+    for (size_t i = 0; i < input.size(); i++) {
+        output[i] = 0.5 * (1.0 + tanh(0.5 * input[i]));
+    }
+}
+
+// average time of one call in microseconds, the first call warms up the caches and the thread pool
+template <typename F>
+double MeasureMicroseconds(const F& func, size_t repetitions = 20) {
+    func();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < repetitions; i++) {
+        func();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / repetitions;
+}
+
+void PrintTimings(const std::string& name, double reference_us, double runtime_us) {
+    std::cout << name << ": reference " << reference_us << " us, runtime " << runtime_us << " us, speedup "
+              << reference_us / runtime_us << "x" << std::endl;
+}
+
+class GNAFloatRuntimeTest : public ::testing::Test {
+ protected:
+    std::mt19937 generator{42};
+
+    std::vector<float> Random(size_t size) {
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        std::vector<float> values(size);
+        for (auto& value : values) {
+            value = distribution(generator);
+        }
+        return values;
+    }
+
+    static void Compare(const std::vector<float>& actual, const std::vector<float>& expected) {
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < actual.size(); i++) {
+            ASSERT_NEAR(actual[i], expected[i], kTolerance * (1.0f + std::fabs(expected[i]))) << "at index " << i;
+        }
+    }
+
+    static intel_dnn_component_t Component(uint32_t rows_in, uint32_t columns_in, uint32_t rows_out, uint32_t columns_out) {
+        intel_dnn_component_t component{};
+        component.num_rows_in = rows_in;
+        component.num_columns_in = columns_in;
+        component.num_rows_out = rows_out;
+        component.num_columns_out = columns_out;
+        component.num_bytes_per_input = sizeof(float);
+        component.num_bytes_per_output = sizeof(float);
+        component.original_layer_name = "test";
+        return component;
+    }
+
+#if GNA_LIB_VER == 2
+    static intel_dnn_component_t Convolution2DComponent(const Convolution2DParams& p, std::vector<float>& filters,
+                                                        std::vector<float>& biases, std::vector<float>& input,
+                                                        std::vector<float>& output) {
+        auto component = Component(1, p.IH * p.IW * p.IC, 1, p.OH() * p.OW() * p.OC);
+        component.tensors.resize(3);
+        component.tensors[0].dimensions = {1, p.IH, p.IW, p.IC};
+        component.tensors[1].dimensions = {1, p.OH(), p.OW(), p.OC};
+        component.tensors[2].dimensions = {p.OC, p.KH, p.KW, p.IC};
+        component.op.conv2D.convStride = {p.SH, p.SW};
+        component.op.conv2D.zeroPadding = {p.PH, p.PW};
+        component.op.conv2D.ptr_filters = filters.data();
+        component.op.conv2D.ptr_biases = biases.data();
+        component.ptr_inputs = input.data();
+        component.ptr_outputs = output.data();
+        return component;
+    }
+#endif
+};
+
+TEST_F(GNAFloatRuntimeTest, affineMatchesReference) {
+    // sizes are not multiples of the vector width and big enough to be split between threads
+    const uint32_t outputs = 301, inputs = 257, batch = 3;
+    auto weights = Random(outputs * inputs);
+    auto biases = Random(outputs);
+    auto input = Random(inputs * batch);
+    std::vector<float> output(outputs * batch), expected(outputs * batch);
+
+    auto component = Component(inputs, batch, outputs, batch);
+    component.op.affine.ptr_weights = weights.data();
+    component.op.affine.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    FP::ApplyAffineTransform(&component, nullptr, 0);
+
+    ReferenceAffine(weights, biases, input, expected, outputs, inputs, batch);
+    Compare(output, expected);
+}
+
+TEST_F(GNAFloatRuntimeTest, affineSubsetMatchesReference) {
+    const uint32_t outputs = 40, inputs = 70, batch = 1;
+    std::vector<uint32_t> list = {39, 0, 17, 5};
+    auto weights = Random(outputs * inputs);
+    auto biases = Random(outputs);
+    auto input = Random(inputs * batch);
+    std::vector<float> output(list.size() * batch), expected(list.size() * batch);
+
+    auto component = Component(inputs, batch, outputs, batch);
+    component.op.affine.ptr_weights = weights.data();
+    component.op.affine.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    FP::ApplyAffineTransform(&component, list.data(), list.size());
+
+    for (size_t l = 0; l < list.size(); l++) {
+        float sum = biases[list[l]];
+        for (uint32_t k = 0; k < inputs; k++) {
+            sum += weights[list[l] * inputs + k] * input[k];
+        }
+        expected[l] = sum;
+    }
+    Compare(output, expected);
+}
+
+TEST_F(GNAFloatRuntimeTest, diagonalMatchesReference) {
+    const uint32_t rows = 1000, batch = 4;
+    auto weights = Random(rows);
+    auto biases = Random(rows);
+    auto input = Random(rows * batch);
+    std::vector<float> output(rows * batch), expected(rows * batch);
+
+    auto component = Component(rows, batch, rows, batch);
+    component.op.affine.ptr_weights = weights.data();
+    component.op.affine.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    FP::ApplyDiagonalTransform(&component);
+
+    for (uint32_t i = 0; i < rows; i++) {
+        for (uint32_t j = 0; j < batch; j++) {
+            expected[i * batch + j] = biases[i] + weights[i] * input[i * batch + j];
+        }
+    }
+    Compare(output, expected);
+}
+
+TEST_F(GNAFloatRuntimeTest, convolution1DMatchesReference) {
+    const uint32_t filters = 24, filter_rows = 3, feature_maps = 2, feature_map_columns = 13, feature_map_rows = 60;
+    const uint32_t coefficients = filter_rows * feature_maps * feature_map_columns;
+    const uint32_t band = feature_maps * feature_map_columns;
+    const uint32_t filter_outputs = feature_map_rows - filter_rows + 1;
+    auto filters_data = Random(filters * coefficients);
+    auto biases = Random(filters);
+    auto input = Random(feature_map_rows * band);
+    std::vector<float> output(filter_outputs * filters), expected(filter_outputs * filters);
+
+    auto component = Component(1, feature_map_rows * band, 1, filter_outputs * filters);
+    component.op.conv1D.num_filters = filters;
+    component.op.conv1D.num_filter_rows = filter_rows;
+    component.op.conv1D.num_filter_coefficients = coefficients;
+    component.op.conv1D.num_feature_maps = feature_maps;
+    component.op.conv1D.num_feature_map_rows = feature_map_rows;
+    component.op.conv1D.num_feature_map_columns = feature_map_columns;
+    component.op.conv1D.ptr_filters = filters_data.data();
+    component.op.conv1D.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    FP::ApplyConvolutional1DTransform(&component);
+
+    for (uint32_t j = 0; j < filter_outputs; j++) {
+        for (uint32_t i = 0; i < filters; i++) {
+            float sum = biases[i];
+            for (uint32_t k = 0; k < coefficients; k++) {
+                sum += input[j * band + k] * filters_data[i * coefficients + k];
+            }
+            expected[j * filters + i] = sum;
+        }
+    }
+    Compare(output, expected);
+}
+
+#if GNA_LIB_VER == 2
+TEST_F(GNAFloatRuntimeTest, convolution2DWithPaddingMatchesReference) {
+    const Convolution2DParams p{9, 20, 5, 3, 4, 16, 1, 2, 1, 2};
+    auto filters = Random(p.OC * p.KernelStride());
+    auto biases = Random(p.OC);
+    auto input = Random(p.IH * p.IW * p.IC);
+    std::vector<float> output(p.OH() * p.OW() * p.OC), expected(output.size());
+
+    auto component = Convolution2DComponent(p, filters, biases, input, output);
+    FP::ApplyConvolutional2DTransform(&component);
+
+    ReferenceConvolution2D(p, filters, biases, input, expected);
+    Compare(output, expected);
+}
+#endif
+
+TEST_F(GNAFloatRuntimeTest, maxPool1DMatchesReference) {
+    const uint32_t channels = 32, rows = 23, pool = 3;
+    const uint32_t rows_out = (rows + pool - 1) / pool;
+    auto input = Random(rows * channels);
+    std::vector<float> output(rows_out * channels), expected(rows_out * channels);
+
+    auto component = Component(1, rows * channels, 1, rows_out * channels);
+    component.op.maxpool.inCHW = {channels, rows, 1};
+    component.op.maxpool.poolingWindowXY = {pool, 1};
+    component.op.maxpool.poolingStrideXY = {pool, 1};
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    FP::ApplyMaxPoolTransform(&component, kDnnFloat);
+
+    for (uint32_t m = 0; m < rows_out; m++) {
+        for (uint32_t c = 0; c < channels; c++) {
+            float max = -1e20f;
+            for (uint32_t k = m * pool; k < (std::min)(rows, (m + 1) * pool); k++) {
+                max = (std::max)(max, input[k * channels + c]);
+            }
+            expected[m * channels + c] = max;
+        }
+    }
+    Compare(output, expected);
+}
+
+TEST_F(GNAFloatRuntimeTest, maxPool2DMatchesReference) {
+    const uint32_t C = 8, IH = 7, IW = 10, WH = 2, WW = 3, SH = 2, SW = 2;
+    const uint32_t OH = (IH - 1) / SH + 1, OW = (IW - 1) / SW + 1;
+    auto input = Random(IH * IW * C);
+    std::vector<float> output(OH * OW * C), expected(OH * OW * C);
+
+    auto component = Component(1, IH * IW * C, 1, OH * OW * C);
+    component.op.maxpool.inCHW = {C, IH, IW};
+    component.op.maxpool.outCHW = {C, OH, OW};
+    component.op.maxpool.poolingWindowXY = {WW, WH};
+    component.op.maxpool.poolingStrideXY = {SW, SH};
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    FP::ApplyMaxPoolTransform(&component, kDnnFloat);
+
+    for (uint32_t oh = 0; oh < OH; oh++) {
+        for (uint32_t ow = 0; ow < OW; ow++) {
+            for (uint32_t c = 0; c < C; c++) {
+                float max = std::numeric_limits<float>::lowest();
+                for (uint32_t ih = oh * SH; ih < (std::min)(IH, oh * SH + WH); ih++) {
+                    for (uint32_t iw = ow * SW; iw < (std::min)(IW, ow * SW + WW); iw++) {
+                        max = (std::max)(max, input[(ih * IW + iw) * C + c]);
+                    }
+                }
+                expected[(oh * OW + ow) * C + c] = max;
+            }
+        }
+    }
+    Compare(output, expected);
+}
+
+TEST_F(GNAFloatRuntimeTest, piecewiseLinearMatchesReference) {
+    for (uint32_t rows : {1u, 600u}) {
+        const uint32_t columns = 50;
+        auto input = Random(rows * columns);
+        std::vector<float> output(rows * columns), expected(rows * columns);
+
+        auto component = Component(rows, columns, rows, columns);
+        component.orientation_in = kDnnNonInterleavedOrientation;
+        component.op.pwl.func_id.type = kActSigmoid;
+        component.ptr_inputs = input.data();
+        component.ptr_outputs = output.data();
+        FP::ApplyPiecewiseLinearTransform(&component, kDnnFloat, rows);
+
+        ReferenceSigmoid(input, expected);
+        Compare(output, expected);
+    }
+}
+
+TEST_F(GNAFloatRuntimeTest, piecewiseLinearThrowsOnUnknownFunction) {
+    std::vector<float> input(4), output(4);
+    auto component = Component(2, 2, 2, 2);
+    component.orientation_in = kDnnNonInterleavedOrientation;
+    component.op.pwl.func_id.type = kActCustom;
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    ASSERT_ANY_THROW(FP::ApplyPiecewiseLinearTransform(&component, kDnnFloat, 2));
+}
+
+// The performance tests compare the runtime primitives with the scalar single threaded loops the software
+// runtime used before on sizes typical for the speech models, run them with --gtest_also_run_disabled_tests
+TEST_F(GNAFloatRuntimeTest, DISABLED_affinePerformance) {
+    const uint32_t outputs = 2048, inputs = 440, batch = 8;
+    auto weights = Random(outputs * inputs);
+    auto biases = Random(outputs);
+    auto input = Random(inputs * batch);
+    std::vector<float> output(outputs * batch), expected(outputs * batch);
+
+    auto component = Component(inputs, batch, outputs, batch);
+    component.op.affine.ptr_weights = weights.data();
+    component.op.affine.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+
+    const double reference_us = MeasureMicroseconds([&] {
+        ReferenceAffine(weights, biases, input, expected, outputs, inputs, batch);
+    });
+    const double runtime_us = MeasureMicroseconds([&] {
+        FP::ApplyAffineTransform(&component, nullptr, 0);
+    });
+    PrintTimings("affine 2048x440x8", reference_us, runtime_us);
+    Compare(output, expected);
+}
+
+#if GNA_LIB_VER == 2
+TEST_F(GNAFloatRuntimeTest, DISABLED_convolution2DPerformance) {
+    const Convolution2DParams p{40, 64, 16, 3, 3, 64, 1, 1, 1, 1};
+    auto filters = Random(p.OC * p.KernelStride());
+    auto biases = Random(p.OC);
+    auto input = Random(p.IH * p.IW * p.IC);
+    std::vector<float> output(p.OH() * p.OW() * p.OC), expected(output.size());
+
+    auto component = Convolution2DComponent(p, filters, biases, input, output);
+
+    const double reference_us = MeasureMicroseconds([&] {
+        ReferenceConvolution2D(p, filters, biases, input, expected);
+    });
+    const double runtime_us = MeasureMicroseconds([&] {
+        FP::ApplyConvolutional2DTransform(&component);
+    });
+    PrintTimings("convolution 2D 40x64x16 3x3x64", reference_us, runtime_us);
+    Compare(output, expected);
+}
+#endif
+
+TEST_F(GNAFloatRuntimeTest, DISABLED_piecewiseLinearPerformance) {
+    const uint32_t rows = 2048, columns = 8;
+    auto input = Random(rows * columns);
+    std::vector<float> output(rows * columns), expected(rows * columns);
+
+    auto component = Component(rows, columns, rows, columns);
+    component.orientation_in = kDnnNonInterleavedOrientation;
+    component.op.pwl.func_id.type = kActSigmoid;
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+
+    const double reference_us = MeasureMicroseconds([&] {
+        ReferenceSigmoid(input, expected);
+    });
+    const double runtime_us = MeasureMicroseconds([&] {
+        FP::ApplyPiecewiseLinearTransform(&component, kDnnFloat, rows);
+    });
+    PrintTimings("sigmoid 2048x8", reference_us, runtime_us);
+    Compare(output, expected);
+}
+}  // namespace
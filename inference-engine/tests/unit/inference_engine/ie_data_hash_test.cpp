@@ -0,0 +1,118 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "ie_data_hash.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+
+namespace {
+
+// byte-wise CRC-64 (ECMA-182) which was used by the CPU plugin weights cache before
+class TableCRC64 {
+public:
+    TableCRC64() {
+        for (int i = 0; i < 256; i++) {
+            uint64_t c = i;
+            for (int j = 0; j < 8; j++)
+                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
+            table[i] = c;
+        }
+    }
+
+    uint64_t hash(const unsigned char* data, size_t size) const {
+        uint64_t crc = 0;
+        for (size_t idx = 0; idx < size; idx++)
+            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+        return ~crc;
+    }
+
+private:
+    uint64_t table[256];
+};
+
+std::vector<uint8_t> makeData(size_t size) {
+    std::vector<uint8_t> data(size);
+    uint32_t state = 12345;
+    for (auto& value : data) {
+        state = state * 1664525u + 1013904223u;
+        value = static_cast<uint8_t>(state >> 24);
+    }
+    return data;
+}
+
+}  // namespace
+
+TEST(DataHashTests, matchesReferenceValues) {
+    ASSERT_EQ(0xEF46DB3751D8E999ULL, computeDataHash("", 0));
+    ASSERT_EQ(0xD24EC4F1A98C6E5BULL, computeDataHash("a", 1));
+    ASSERT_EQ(0x44BC2CF5AD770999ULL, computeDataHash("abc", 3));
+}
+
+TEST(DataHashTests, isDeterministic) {
+    const auto data = makeData(3 * 1024 * 1024 + 17);
+    ASSERT_EQ(computeDataHash(data.data(), data.size()), computeDataHash(data.data(), data.size()));
+}
+
+TEST(DataHashTests, dependsOnSeed) {
+    const auto data = makeData(1000);
+    ASSERT_NE(computeDataHash(data.data(), data.size(), 0), computeDataHash(data.data(), data.size(), 1));
+}
+
+TEST(DataHashTests, dependsOnSize) {
+    const std::vector<uint8_t> data(2 * 1024 * 1024, 0);
+    ASSERT_NE(computeDataHash(data.data(), data.size() - 1), computeDataHash(data.data(), data.size()));
+    ASSERT_NE(computeDataHash(data.data(), 31), computeDataHash(data.data(), 32));
+}
+
+TEST(DataHashTests, detectsChangeOfAnyByteInLargeBuffer) {
+    auto data = makeData(5 * 1024 * 1024 + 3);
+    const auto reference = computeDataHash(data.data(), data.size());
+    for (size_t offset : {size_t(0), size_t(1024 * 1024 - 1), size_t(1024 * 1024), data.size() - 1}) {
+        data[offset] ^= 1;
+        EXPECT_NE(reference, computeDataHash(data.data(), data.size())) << "offset: " << offset;
+        data[offset] ^= 1;
+    }
+    ASSERT_EQ(reference, computeDataHash(data.data(), data.size()));
+}
+
+TEST(DataHashTests, doesNotDependOnAlignment) {
+    const auto data = makeData(4096 + 8);
+    std::vector<uint8_t> shifted(data.size() + 1);
+    std::memcpy(shifted.data() + 1, data.data(), data.size());
+    ASSERT_EQ(computeDataHash(data.data(), data.size()), computeDataHash(shifted.data() + 1, data.size()));
+}
+
+// Throughput comparison with the previous weights cache hash, run with --gtest_also_run_disabled_tests
+TEST(DataHashTests, DISABLED_benchmarkAgainstTableCRC64) {
+    const auto data = makeData(256 * 1024 * 1024);
+    const TableCRC64 crc;
+
+    auto measure = [&](const std::string& name, const std::function<uint64_t()>& hash) {
+        using namespace std::chrono;
+        uint64_t result = 0;
+        double best = std::numeric_limits<double>::max();
+        for (int i = 0; i < 3; i++) {
+            const auto start = steady_clock::now();
+            result ^= hash();
+            best = std::min(best, duration<double>(steady_clock::now() - start).count());
+        }
+        std::cout << name << ": " << data.size() / best / 1e9 << " GB/s (" << std::hex << result << std::dec << ")"
+                  << std::endl;
+    };
+
+    measure("CRC-64 table", [&] { return crc.hash(data.data(), data.size()); });
+    measure("computeDataHash", [&] { return computeDataHash(data.data(), data.size()); });
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+#include "ie_blob.h"
+#include "ie_mmap_allocator.hpp"
+
+using namespace InferenceEngine;
+
+class MmapAllocatorTests : public CommonTestUtils::TestsCommon {
+protected:
+    void SetUp() override {
+        CommonTestUtils::TestsCommon::SetUp();
+        data.resize(4096 + 17);
+        std::iota(data.begin(), data.end(), 0);
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFile(fileName);
+        CommonTestUtils::TestsCommon::TearDown();
+    }
+
+    const std::string fileName = "mmap_allocator_test.bin";
+    std::vector<uint8_t> data;
+};
+
+TEST_F(MmapAllocatorTests, canMapFileContent) {
+    auto allocator = details::CreateMmapAllocator(fileName);
+    void* handle = allocator->alloc(data.size());
+    ASSERT_NE(handle, nullptr);
+    auto ptr = static_cast<const uint8_t*>(allocator->lock(handle, LOCK_FOR_READ));
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), ptr));
+    allocator->unlock(handle);
+    EXPECT_TRUE(allocator->free(handle));
+}
+
+TEST_F(MmapAllocatorTests, writesDoNotChangeFile) {
+    auto allocator = details::CreateMmapAllocator(fileName);
+    void* handle = allocator->alloc(data.size());
+    ASSERT_NE(handle, nullptr);
+    static_cast<uint8_t*>(allocator->lock(handle))[0] = 42;
+    allocator->unlock(handle);
+    EXPECT_TRUE(allocator->free(handle));
+
+    std::ifstream file(fileName, std::ios::binary);
+    char first = 0;
+    file.read(&first, 1);
+    EXPECT_EQ(data[0], static_cast<uint8_t>(first));
+}
+
+TEST_F(MmapAllocatorTests, cannotMapMoreThanFileSize) {
+    auto allocator = details::CreateMmapAllocator(fileName);
+    EXPECT_EQ(allocator->alloc(data.size() + 1), nullptr);
+}
+
+TEST_F(MmapAllocatorTests, cannotMapNotExistingFile) {
+    auto allocator = details::CreateMmapAllocator("not_existing_file.bin");
+    EXPECT_EQ(allocator->alloc(1), nullptr);
+}
+
+TEST_F(MmapAllocatorTests, canBeUsedAsBlobAllocator) {
+    auto blob = make_shared_blob<uint8_t>({Precision::U8, {data.size()}, Layout::C}, details::CreateMmapAllocator(fileName));
+    blob->allocate();
+    auto ptr = blob->cbuffer().as<const uint8_t*>();
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), ptr));
+}
@@ -6,7 +6,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstring>
 #include <limits>
+#include <vector>
 
 using namespace InferenceEngine;
 
@@ -46,3 +49,39 @@ TEST_F(PrecisionUtilsTests, FP32ToFP16LowestValue) {
     const auto fp16ConvertedLowestValue = InferenceEngine::PrecisionUtils::f32tof16(std::numeric_limits<float>::lowest());
     ASSERT_EQ(fp16ConvertedLowestValue, lowestNumber);
 }
+
+TEST_F(PrecisionUtilsTests, FP32ToFP16ArrayMatchesScalarConversion) {
+    const float special[] = {0.f, -0.f, 1e-8f, 3e-5f, 6.1e-5f, 0.33333f, 65504.f, 65519.f, 65520.f, 1e10f,
+                             std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                             std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::denorm_min()};
+    // odd length to cover both vectorized part and tail
+    std::vector<float> src(1003);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = (i % 5 == 0) ? special[(i / 5) % (sizeof(special) / sizeof(special[0]))]
+                              : static_cast<float>(static_cast<int>(i * 7919 % 2001) - 1000) / 7.f;
+    }
+
+    std::vector<ie_fp16> dst(src.size());
+    PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size());
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(dst[i], PrecisionUtils::f32tof16(src[i])) << "element " << i << ": " << src[i];
+    }
+}
+
+TEST_F(PrecisionUtilsTests, FP16ToFP32ArrayMatchesScalarConversion) {
+    // all 16 bit patterns in several odd chunks
+    std::vector<ie_fp16> src(65536);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<ie_fp16>(i);
+    }
+
+    std::vector<float> dst(src.size());
+    for (size_t offset = 0, chunk = 1; offset < src.size(); offset += chunk, chunk = chunk * 3 + 1) {
+        const size_t count = std::min(chunk, src.size() - offset);
+        PrecisionUtils::f16tof32Arrays(dst.data() + offset, src.data() + offset, count);
+    }
+    for (size_t i = 0; i < src.size(); i++) {
+        const float expected = PrecisionUtils::f16tof32(src[i]);
+        ASSERT_EQ(0, std::memcmp(&dst[i], &expected, sizeof(float))) << "element " << i;
+    }
+}
@@ -17,6 +17,7 @@
 
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <ctime>
 
 #include <chrono>
@@ -1053,6 +1054,114 @@ TEST_P(ColorConvertYUV420TestIE, AccuracyTest)
     }
 }
 
+TEST_P(FusedPreprocTestIE, AccuracyTest)
+{
+    using namespace InferenceEngine;
+    auto in_fmt = ColorFormat::NV12;
+    auto out_prec = Precision::FP32;
+    auto algorithm = ResizeAlgorithm::NO_RESIZE;
+    cv::Size sz_in, sz_out;
+    double tolerance = 0.0;
+    std::pair<cv::Size, cv::Size> sizes;
+    std::tie(in_fmt, out_prec, algorithm, sizes, tolerance) = GetParam();
+    std::tie(sz_in, sz_out) = sizes;
+
+    const bool yuv420 = in_fmt == ColorFormat::NV12 || in_fmt == ColorFormat::I420;
+    const float means[] = {103.94f, 116.78f, 123.68f};
+    const float scales[] = {57.375f, 57.12f, 58.395f};
+
+    // input data and reference color conversion to BGR
+    cv::Mat in_mat, in_mat_y, in_mat_uv;
+    cv::Mat bgr_ref;
+    Blob::Ptr in_blob;
+    if (yuv420) {
+        in_mat_y.create(sz_in, CV_8UC1);
+        in_mat_uv.create(cv::Size(sz_in.width / 2, sz_in.height / 2), CV_8UC2);
+        cv::randu(in_mat_y, cv::Scalar::all(0), cv::Scalar::all(255));
+        cv::randu(in_mat_uv, cv::Scalar::all(0), cv::Scalar::all(255));
+
+        auto y_blob = img2Blob<Precision::U8>(in_mat_y, Layout::NHWC);
+        if (in_fmt == ColorFormat::NV12) {
+            auto uv_blob = img2Blob<Precision::U8>(in_mat_uv, Layout::NHWC);
+            in_blob = make_shared_blob<NV12Blob>(y_blob, uv_blob);
+        } else {
+            std::array<cv::Mat, 2> in_uv;
+            cv::split(in_mat_uv, in_uv);
+            auto u_blob = img2Blob<Precision::U8>(in_uv[0], Layout::NHWC);
+            auto v_blob = img2Blob<Precision::U8>(in_uv[1], Layout::NHWC);
+            in_blob = make_shared_blob<I420Blob>(y_blob, u_blob, v_blob);
+        }
+        cv::cvtColorTwoPlane(in_mat_y, in_mat_uv, bgr_ref, cv::COLOR_YUV2BGR_NV12);
+    } else {
+        in_mat.create(sz_in, CV_MAKE_TYPE(CV_8U, numChannels(in_fmt)));
+        cv::randu(in_mat, cv::Scalar::all(0), cv::Scalar::all(255));
+        in_blob = img2Blob<Precision::U8>(in_mat, Layout::NHWC);
+        if (in_fmt == ColorFormat::BGR) {
+            bgr_ref = in_mat;
+        } else {
+            cv::cvtColor(in_mat, bgr_ref, toCvtColorCode(in_fmt, ColorFormat::BGR));
+        }
+    }
+
+    // Inference Engine code ///////////////////////////////////////////////////
+    const TensorDesc out_desc(out_prec, {1, 3, static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width)},
+                              Layout::NCHW);
+    Blob::Ptr out_blob = (out_prec == Precision::BF16) ? Blob::Ptr{make_shared_blob<int16_t>(out_desc)}
+                                                       : Blob::Ptr{make_shared_blob<float>(out_desc)};
+    out_blob->allocate();
+
+    PreProcessInfo info;
+    info.setColorFormat(in_fmt);
+    info.setResizeAlgorithm(algorithm);
+    info.init(3);
+    for (size_t c = 0; c < 3; c++) {
+        info[c]->meanValue = means[c];
+        info[c]->stdScale = scales[c];
+    }
+    info.setVariant(MEAN_VALUE);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+    ASSERT_TRUE(preprocess->executeFused(out_blob, info, false));
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ preprocess->executeFused(out_blob, info, false); },
+            100, "Fused Preproc IE %s %s %dx%d -> %dx%d",
+            colorFormatToString(in_fmt).c_str(), out_prec.name(),
+            sz_in.width, sz_in.height, sz_out.width, sz_out.height);
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    cv::Mat bgr_f32, resized;
+    bgr_ref.convertTo(bgr_f32, CV_32F);
+    if (sz_in != sz_out) {
+        cv::resize(bgr_f32, resized, sz_out, 0, 0, cv::INTER_LINEAR);
+    } else {
+        resized = bgr_f32;
+    }
+    std::array<cv::Mat, 3> planes_ocv;
+    cv::split(resized, planes_ocv);
+
+    // Comparison //////////////////////////////////////////////////////////////
+    const size_t plane_size = static_cast<size_t>(sz_out.area());
+    for (size_t c = 0; c < 3; c++) {
+        cv::Mat expected = (planes_ocv[c] - means[c]) / scales[c];
+        cv::Mat actual(sz_out, CV_32FC1);
+        if (out_prec == Precision::BF16) {
+            const auto data = out_blob->buffer().as<const uint16_t*>() + c * plane_size;
+            for (size_t i = 0; i < plane_size; i++) {
+                uint32_t bits = static_cast<uint32_t>(data[i]) << 16;
+                std::memcpy(actual.ptr<float>() + i, &bits, sizeof(float));
+            }
+        } else {
+            std::memcpy(actual.ptr<float>(), out_blob->buffer().as<const float*>() + c * plane_size,
+                        plane_size * sizeof(float));
+        }
+        EXPECT_LE(cv::norm(expected, actual, cv::NORM_INF), tolerance) << "channel " << c;
+    }
+}
+
 TEST_P(SplitTestIE, AccuracyTest)
 {
     const auto params = GetParam();
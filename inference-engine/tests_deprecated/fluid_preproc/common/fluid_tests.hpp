@@ -60,6 +60,14 @@ struct ColorConvertYUV420TestIE:
                                              double>>                       // tolerance
 {};
 
+struct FusedPreprocTestIE:
+    public testing::TestWithParam<std::tuple<InferenceEngine::ColorFormat,      // input color format
+                                             InferenceEngine::Precision,        // output precision FP32 or BF16
+                                             InferenceEngine::ResizeAlgorithm,  // resize algorithm
+                                             std::pair<cv::Size, cv::Size>,     // input and output sizes
+                                             double>>                           // tolerance
+{};
+
 struct PrecisionConvertTestIE: public TestParams<std::tuple<cv::Size,
                                                             int,     // input  matrix depth
                                                             int,     // output matrix depth
@@ -282,6 +282,32 @@ INSTANTIATE_TEST_SUITE_P(ColorConvertYUV420Fluid, ColorConvertYUV420TestIE,
                                        cv::Size( 150,  150)),
                                 Values(0)));
 
+INSTANTIATE_TEST_SUITE_P(FusedPreprocFluid, FusedPreprocTestIE,
+                        Combine(Values(InferenceEngine::NV12, InferenceEngine::I420,
+                                       InferenceEngine::BGR, InferenceEngine::RGBX),
+                                Values(InferenceEngine::Precision::FP32),
+                                Values(InferenceEngine::RESIZE_BILINEAR),
+                                Values(std::make_pair(cv::Size(1920, 1080), cv::Size(224, 224)),
+                                       std::make_pair(cv::Size(1280,  720), cv::Size(300, 300)),
+                                       std::make_pair(cv::Size( 320,  200), cv::Size(640, 480)),
+                                       std::make_pair(cv::Size( 150,  150), cv::Size( 33,  17))),
+                                Values(1e-3)));
+
+INSTANTIATE_TEST_SUITE_P(FusedPreprocFluid_NoResize, FusedPreprocTestIE,
+                        Combine(Values(InferenceEngine::NV12, InferenceEngine::RGB),
+                                Values(InferenceEngine::Precision::FP32),
+                                Values(InferenceEngine::NO_RESIZE),
+                                Values(std::make_pair(cv::Size(640, 480), cv::Size(640, 480)),
+                                       std::make_pair(cv::Size(150, 150), cv::Size(150, 150))),
+                                Values(1e-5)));
+
+INSTANTIATE_TEST_SUITE_P(FusedPreprocFluid_BF16, FusedPreprocTestIE,
+                        Combine(Values(InferenceEngine::NV12, InferenceEngine::BGR),
+                                Values(InferenceEngine::Precision::BF16),
+                                Values(InferenceEngine::RESIZE_BILINEAR),
+                                Values(std::make_pair(cv::Size(1280, 720), cv::Size(300, 300))),
+                                Values(1e-2)));
+
 INSTANTIATE_TEST_SUITE_P(Reorder_HWC2CHW, ColorConvertTestIE,
                         Combine(Values(CV_8U, CV_32F, CV_16S, CV_16F),
                                 Values(InferenceEngine::ColorFormat::BGR),
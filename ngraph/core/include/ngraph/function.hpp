@@ -8,6 +8,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -123,6 +124,10 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::vector<std::shared_ptr<Node>> get_ops() const;
+        /// \brief Returns the nodes in topological order.
+        ///
+        /// The order is cached and recomputed only after the graph was modified: changes of node
+        /// inputs or control dependencies, and of the function parameters, results or sinks.
         std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
@@ -253,12 +258,20 @@ namespace ngraph
         /// function and registers them, otherwise checks all the Parameters are registered.
         void prerequirements(bool detect_variables, bool detect_parameters);
 
+        /// \brief Marks the cached topological order as stale
+        void invalidate_topology_cache();
+
         static std::atomic<size_t> m_next_instance_id;
         std::string m_name;
         const std::string m_unique_name;
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
 
+        // The cached order keeps weak references only, so replaced nodes are released immediately
+        mutable std::shared_ptr<TopologyCacheState> m_topology_cache_state;
+        mutable std::vector<std::weak_ptr<Node>> m_cached_ordered_ops;
+        mutable std::mutex m_topology_cache_mutex;
+
         ResultVector m_results;
         // List of the nodes with side effect in graph.
         // These nodes are not outputs of graph but should not be removed even if have no children.
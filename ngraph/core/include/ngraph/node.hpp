@@ -10,6 +10,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <tuple>
@@ -49,6 +50,7 @@ namespace ngraph
     class Node;
 
     class Function;
+    class TopologyCacheState;
 
     namespace runtime
     {
@@ -136,6 +138,9 @@ namespace ngraph
         template <typename NodeType>
         friend class Output;
 
+        // For access to add_topology_cache_state.
+        friend class Function;
+
     public:
         /// \brief Verifies that attributes and inputs are consistent and computes output shapes
         /// and element types. Must be implemented by concrete child classes so that it
@@ -493,6 +498,12 @@ namespace ngraph
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
+        /// \brief Marks the cached topological order of all functions the node belongs to as
+        /// stale. Must be called on any change of the node inputs or control dependencies.
+        void invalidate_topology_cache();
+        /// \brief Links the node to the cache state of the function which has ordered it.
+        void add_topology_cache_state(const std::shared_ptr<TopologyCacheState>& state);
+
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
         std::string m_node_type;
@@ -506,6 +517,10 @@ namespace ngraph
         std::deque<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
+        // Cache states of the functions which ordered this node, not copied with the node.
+        // The node does not keep the states alive, states of destroyed functions are pruned.
+        std::vector<std::weak_ptr<TopologyCacheState>> m_topology_cache_states;
+        std::mutex m_topology_cache_states_mutex;
     };
 
     using NodeTypeInfo = Node::type_info_t;
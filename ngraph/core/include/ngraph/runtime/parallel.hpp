@@ -0,0 +1,47 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Body of a parallel loop, processes iterations in the range [begin, end).
+        using ParallelForBody = std::function<void(size_t begin, size_t end)>;
+
+        /// \brief Implementation of a parallel loop. It must split the range [0, work_amount)
+        /// into disjoint subranges, call the body for each of them (possibly concurrently) and
+        /// return when all subranges are processed.
+        using ParallelForImpl = void (*)(size_t work_amount, const ParallelForBody& body);
+
+        /// \brief Sets the threading backend used by the reference kernels. By default the
+        /// loops are executed sequentially in the calling thread. The runtime embedding nGraph
+        /// (e.g. Inference Engine with its TBB or OpenMP threading) installs its own
+        /// implementation, nullptr restores the sequential one.
+        NGRAPH_API void set_parallel_for_impl(ParallelForImpl impl);
+
+        /// \brief Returns true if a parallel implementation is installed.
+        NGRAPH_API bool has_parallel_for_impl();
+
+        /// \brief Minimal amount of work (number of iterations multiplied by the cost of an
+        /// iteration in elementary operations) which is worth to be split between threads.
+        constexpr size_t parallel_for_min_work = 32 * 1024;
+
+        /// \brief Runs the body over the range [0, work_amount) with the installed threading
+        /// backend. Small loops are executed sequentially in the calling thread.
+        ///
+        /// \param work_amount Number of iterations.
+        /// \param item_cost Estimated number of elementary operations per iteration.
+        /// \param body Loop body, must be safe to call concurrently for disjoint ranges. An
+        ///             exception thrown by the body is rethrown in the calling thread.
+        NGRAPH_API void
+            parallel_for(size_t work_amount, size_t item_cost, const ParallelForBody& body);
+    } // namespace runtime
+} // namespace ngraph
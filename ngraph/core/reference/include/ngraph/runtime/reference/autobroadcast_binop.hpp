@@ -4,11 +4,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
-
 #include <utility>
+#include <vector>
+
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -77,6 +80,101 @@ namespace ngraph
                     }
                 }
 
+                /// \brief Parallel version of the numpy broadcasting. Adjacent dimensions with
+                /// the same broadcasting pattern are merged, so the output is processed by rows
+                /// of the innermost merged dimension with vectorizable loops.
+                template <typename T, typename U, typename Functor>
+                void parallel_numpy_autobroadcast_binop(const T* arg0,
+                                                        const T* arg1,
+                                                        U* out,
+                                                        const Shape& arg0_shape,
+                                                        const Shape& arg1_shape,
+                                                        Functor elementwise_functor)
+                {
+                    const size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+                    const size_t padding0 = rank - arg0_shape.size();
+                    const size_t padding1 = rank - arg1_shape.size();
+
+                    // 0 - same dimensions, 1 - arg0 is broadcasted, 2 - arg1 is broadcasted
+                    std::vector<size_t> dims, dims0, dims1;
+                    int prev_pattern = -1;
+                    for (size_t i = 0; i < rank; i++)
+                    {
+                        const size_t dim0 = value_with_padding_or(arg0_shape, padding0, i, 1);
+                        const size_t dim1 = value_with_padding_or(arg1_shape, padding1, i, 1);
+                        if (dim0 == 1 && dim1 == 1)
+                            continue;
+                        const int pattern = dim0 == dim1 ? 0 : (dim0 == 1 ? 1 : 2);
+                        if (pattern == prev_pattern)
+                        {
+                            dims.back() *= std::max(dim0, dim1);
+                            dims0.back() *= dim0;
+                            dims1.back() *= dim1;
+                        }
+                        else
+                        {
+                            dims.push_back(std::max(dim0, dim1));
+                            dims0.push_back(dim0);
+                            dims1.push_back(dim1);
+                        }
+                        prev_pattern = pattern;
+                    }
+                    if (dims.empty())
+                    {
+                        out[0] = elementwise_functor(arg0[0], arg1[0]);
+                        return;
+                    }
+
+                    // broadcasted dimensions have zero strides
+                    const size_t outer_rank = dims.size() - 1;
+                    std::vector<size_t> strides0(dims.size()), strides1(dims.size());
+                    for (size_t i = dims.size(), s0 = 1, s1 = 1; i-- > 0;)
+                    {
+                        strides0[i] = dims0[i] == 1 ? 0 : s0;
+                        strides1[i] = dims1[i] == 1 ? 0 : s1;
+                        s0 *= dims0[i];
+                        s1 *= dims1[i];
+                    }
+
+                    const size_t inner = dims.back();
+                    if (inner == 0)
+                        return;
+                    const size_t rows = shape_size(dims) / inner;
+                    parallel_for(rows, inner, [&](size_t begin, size_t end) {
+                        for (size_t row = begin; row < end; ++row)
+                        {
+                            size_t offset0 = 0, offset1 = 0;
+                            for (size_t i = outer_rank, r = row; i-- > 0;)
+                            {
+                                const size_t coord = r % dims[i];
+                                r /= dims[i];
+                                offset0 += coord * strides0[i];
+                                offset1 += coord * strides1[i];
+                            }
+                            const T* a0 = arg0 + offset0;
+                            const T* a1 = arg1 + offset1;
+                            U* o = out + row * inner;
+                            if (strides0[outer_rank] == 0)
+                            {
+                                const T a = a0[0];
+                                for (size_t j = 0; j < inner; ++j)
+                                    o[j] = elementwise_functor(a, a1[j]);
+                            }
+                            else if (strides1[outer_rank] == 0)
+                            {
+                                const T b = a1[0];
+                                for (size_t j = 0; j < inner; ++j)
+                                    o[j] = elementwise_functor(a0[j], b);
+                            }
+                            else
+                            {
+                                for (size_t j = 0; j < inner; ++j)
+                                    o[j] = elementwise_functor(a0[j], a1[j]);
+                            }
+                        }
+                    });
+                }
+
                 inline size_t calculate_fixed_axis(size_t axis, const size_t* strides)
                 {
                     while (axis > 0 && strides[axis - 1] == 1)
@@ -114,10 +212,12 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
+                    parallel_for(shape_size(arg0_shape), 1, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            out[i] = elementwise_functor(arg0[i], arg1[i]);
+                        }
+                    });
                     break;
                 case op::AutoBroadcastType::NUMPY:
                     // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -141,6 +241,12 @@ namespace ngraph
                     //                 Output shape
                     //                 ------------
                     //                 [ 3, 2, 6]
+                    if (has_parallel_for_impl())
+                    {
+                        internal::parallel_numpy_autobroadcast_binop(
+                            arg0, arg1, out, arg0_shape, arg1_shape, elementwise_functor);
+                    }
+                    else
                     {
                         using namespace internal;
 
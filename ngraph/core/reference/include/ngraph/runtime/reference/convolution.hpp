@@ -4,14 +4,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <cfenv>
 #include <cmath>
 #include <functional>
 #include <numeric>
+#include <utility>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/concat.hpp"
 #include "ngraph/runtime/reference/helpers.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
@@ -60,6 +63,19 @@ namespace ngraph
                     return val >= range.first && val < range.second;
                 }
 
+                /// \brief Returns the range of filter positions which are applied to the input
+                /// elements (not to the padding) when the filter starts at the input position i.
+                inline std::pair<int, int>
+                    valid_filter_range(int i, int dilation, int input_size, int filter_size)
+                {
+                    const int begin = i < 0 ? (-i + dilation - 1) / dilation : 0;
+                    const int end =
+                        i < input_size
+                            ? std::min(filter_size, (input_size - i + dilation - 1) / dilation)
+                            : 0;
+                    return {begin, std::max(begin, end)};
+                }
+
                 template <typename T>
                 void convolve_3D_channels(const ConvolutionParams& p,
                                           const T* batch,
@@ -91,47 +107,48 @@ namespace ngraph
                                  p.output_padding[0]);
                          i_z += p.strides[0])
                     {
+                        // padding checks are hoisted out of the accumulation loops
+                        const auto f_z_range =
+                            valid_filter_range(i_z, p.dilation[0], input_size_z, filter_size_z);
                         for (int i_y = -p.pads_begin[1];
                              i_y <= (p.pads_end[1] + input_size_y - dilated_filter_size_y +
                                      p.output_padding[1]);
                              i_y += p.strides[1])
                         {
+                            const auto f_y_range = valid_filter_range(
+                                i_y, p.dilation[1], input_size_y, filter_size_y);
                             for (int i_x = -p.pads_begin[2];
                                  i_x <= (p.pads_end[2] + input_size_x - dilated_filter_size_x +
                                          p.output_padding[2]);
                                  i_x += p.strides[2])
                             {
+                                const auto f_x_range = valid_filter_range(
+                                    i_x, p.dilation[2], input_size_x, filter_size_x);
                                 auto input_channel = batch;
                                 auto filter_channel = filter;
                                 T sum = 0;
                                 size_t filter_channels_count = filter_shape[0];
                                 while (filter_channels_count--)
                                 {
-                                    for (int f_z = 0; f_z < filter_size_z; ++f_z)
+                                    for (int f_z = f_z_range.first; f_z < f_z_range.second; ++f_z)
                                     {
-                                        for (int f_y = 0; f_y < filter_size_y; ++f_y)
+                                        const int rel_i_z = i_z + (f_z * p.dilation[0]);
+                                        for (int f_y = f_y_range.first; f_y < f_y_range.second;
+                                             ++f_y)
                                         {
-                                            for (int f_x = 0; f_x < filter_size_x; ++f_x)
+                                            const int rel_i_y = i_y + (f_y * p.dilation[1]);
+                                            const T* input_row =
+                                                input_channel +
+                                                (rel_i_z * input_size_y + rel_i_y) * input_size_x;
+                                            const T* filter_row =
+                                                filter_channel +
+                                                (f_z * filter_size_y + f_y) * filter_size_x;
+                                            for (int f_x = f_x_range.first; f_x < f_x_range.second;
+                                                 ++f_x)
                                             {
-                                                int rel_i_z = i_z + (f_z * p.dilation[0]);
-                                                int rel_i_y = i_y + (f_y * p.dilation[1]);
-                                                int rel_i_x = i_x + (f_x * p.dilation[2]);
-
-                                                bool padding =
-                                                    !(in_range(rel_i_x, {0, input_size_x}) &&
-                                                      in_range(rel_i_y, {0, input_size_y}) &&
-                                                      in_range(rel_i_z, {0, input_size_z}));
-                                                if (padding)
-                                                    continue;
-
-                                                int f_buf_idx =
-                                                    (f_z * filter_size_y * filter_size_x) +
-                                                    (f_y * filter_size_x) + f_x;
-                                                int i_buf_idx =
-                                                    (rel_i_z * input_size_y * input_size_x) +
-                                                    (rel_i_y * input_size_x) + rel_i_x;
-                                                sum += static_cast<T>(input_channel[i_buf_idx]) *
-                                                       static_cast<T>(filter_channel[f_buf_idx]);
+                                                sum += static_cast<T>(
+                                                           input_row[i_x + f_x * p.dilation[2]]) *
+                                                       static_cast<T>(filter_row[f_x]);
                                             }
                                         }
                                     }
@@ -279,17 +296,28 @@ namespace ngraph
                 const Shape filter_shape(++filters_shape.begin(), filters_shape.end());
                 const size_t filter_size = shape_size(filter_shape);
 
-                auto batch = in;
-                for (size_t batch_idx = 0; batch_idx < batches_count; ++batch_idx)
-                {
-                    auto filter = f;
-                    for (size_t f_idx = 0; f_idx < filters_count; ++f_idx)
-                    {
-                        convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, out);
-                        filter += filter_size;
-                    }
-                    batch += batch_size;
-                }
+                const size_t out_channel_size = shape_size(out_shape) /
+                                                std::max<size_t>(1, batches_count * filters_count);
+                const size_t out_channel_cost = out_channel_size * filter_size;
+
+                // output channels of all batches are computed in parallel
+                parallel_for(
+                    batches_count * filters_count,
+                    out_channel_cost,
+                    [&](size_t begin, size_t end) {
+                        for (size_t idx = begin; idx < end; ++idx)
+                        {
+                            const size_t batch_idx = idx / filters_count;
+                            const size_t f_idx = idx % filters_count;
+                            T* out_channel = out + idx * out_channel_size;
+                            convolve_3D_channels(params,
+                                                 in + batch_idx * batch_size,
+                                                 batch_shape,
+                                                 f + f_idx * filter_size,
+                                                 filter_shape,
+                                                 out_channel);
+                        }
+                    });
             }
 
             // DEPRECATED, can't be removed currently due to kmb-plugin dependency (#47799)
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
 #include "ngraph/shape_util.hpp"
 
@@ -21,41 +22,68 @@ namespace ngraph
         {
             namespace details
             {
-                template <typename T>
-                void dot(const T* arg0,
-                         const T* arg1,
-                         T* out,
-                         const Shape& arg0_shape,
-                         const Shape& arg1_shape,
-                         const Shape& out_shape)
+                /// \brief Gets the {I, K} x {K, J} dimensions of the dot product.
+                /// If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
+                /// If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
+                inline void dot_dims(const Shape& arg0_shape,
+                                     const Shape& arg1_shape,
+                                     size_t& I_dim,
+                                     size_t& K_dim,
+                                     size_t& J_dim)
                 {
-                    std::fill(out, out + shape_size(out_shape), T{0});
                     const size_t arg0_rank = arg0_shape.size();
                     const size_t arg1_rank = arg1_shape.size();
+                    I_dim = arg0_rank == 1 ? 1 : arg0_shape[arg0_rank - 2];
+                    J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
+                    K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
+                }
 
-                    // 2D inputs shapes are interpreted as {I, K} x {K, J}
-                    // If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
-                    // If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
-                    const size_t I_dim = arg0_rank == 1 ? 1 : arg0_shape[arg0_rank - 2];
-                    const size_t J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
-                    const size_t K_dim =
-                        arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
-
-                    for (size_t i = 0; i < I_dim; ++i)
+                /// \brief Computes rows [i_begin, i_end) of the {I, K} x {K, J} product.
+                /// The innermost loop goes over contiguous rows of the second argument and the
+                /// output, so it is vectorized by the compiler.
+                template <typename T>
+                void dot_rows(const T* arg0,
+                              const T* arg1,
+                              T* out,
+                              size_t i_begin,
+                              size_t i_end,
+                              size_t K_dim,
+                              size_t J_dim)
+                {
+                    for (size_t i = i_begin; i < i_end; ++i)
                     {
+                        const T* a_row = arg0 + i * K_dim;
+                        T* out_row = out + i * J_dim;
+                        std::fill(out_row, out_row + J_dim, T{0});
                         for (size_t k = 0; k < K_dim; ++k)
                         {
-                            const size_t a_idx = i * K_dim + k;
+                            const T a = a_row[k];
+                            const T* b_row = arg1 + k * J_dim;
                             for (size_t j = 0; j < J_dim; ++j)
                             {
-                                const size_t b_idx = k * J_dim + j;
-                                const size_t out_idx = i * J_dim + j;
-                                out[out_idx] += arg0[a_idx] * arg1[b_idx];
+                                out_row[j] += a * b_row[j];
                             }
                         }
                     }
                 }
 
+                template <typename T>
+                void dot(const T* arg0,
+                         const T* arg1,
+                         T* out,
+                         const Shape& arg0_shape,
+                         const Shape& arg1_shape,
+                         const Shape& out_shape)
+                {
+                    // 2D inputs shapes are interpreted as {I, K} x {K, J}
+                    size_t I_dim, K_dim, J_dim;
+                    dot_dims(arg0_shape, arg1_shape, I_dim, K_dim, J_dim);
+
+                    parallel_for(I_dim, K_dim * J_dim, [&](size_t begin, size_t end) {
+                        dot_rows(arg0, arg1, out, begin, end, K_dim, J_dim);
+                    });
+                }
+
                 std::vector<size_t> get_transpose_order(const Shape& input_shape);
             } // namespace details
             /// \brief Reference kernel for matmul computation.
@@ -235,15 +263,24 @@ namespace ngraph
                 const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
                 const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
                 const size_t output_offset = shape_size(dot_output_shape);
-                for (size_t i = 0; i < output_batch_size; i++)
-                {
-                    details::dot(arg0_data + i * arg0_offset,
-                                 arg1_data + i * arg1_offset,
-                                 out + i * output_offset,
-                                 dot_arg0_shape,
-                                 dot_arg1_shape,
-                                 dot_output_shape);
-                }
+                size_t I_dim, K_dim, J_dim;
+                details::dot_dims(dot_arg0_shape, dot_arg1_shape, I_dim, K_dim, J_dim);
+
+                // rows of all batches are processed in parallel
+                parallel_for(
+                    output_batch_size * I_dim, K_dim * J_dim, [&](size_t begin, size_t end) {
+                        for (size_t row = begin; row < end; ++row)
+                        {
+                            const size_t i = row / I_dim;
+                            details::dot_rows(arg0_data + i * arg0_offset,
+                                              arg1_data + i * arg1_offset,
+                                              out + i * output_offset,
+                                              row % I_dim,
+                                              row % I_dim + 1,
+                                              K_dim,
+                                              J_dim);
+                        }
+                    });
             }
         } // namespace reference
     }     // namespace runtime
@@ -9,6 +9,7 @@
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -26,6 +27,16 @@ namespace ngraph
 
                 constexpr bool dont_keep_dims_in_output = false;
                 const auto out_shape = reduce(in_shape, reduction_axes, dont_keep_dims_in_output);
+                size_t outer, reduced, inner;
+                if (details::contiguous_reduction(in_shape, reduction_axes, outer, reduced, inner))
+                {
+                    details::reduce_contiguous(
+                        arg, out, outer, reduced, inner, minval, [](T max, T x) {
+                            return x > max ? x : max;
+                        });
+                    return;
+                }
+
                 std::fill(out, out + shape_size(out_shape), minval);
 
                 const auto in_strides = row_major_strides(in_shape);
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <map>
 #include <vector>
@@ -28,6 +29,16 @@ namespace ngraph
                       bool keep_dims)
             {
                 auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
+
+                size_t outer, reduced, inner;
+                if (details::contiguous_reduction(in_shape, reduction_axes, outer, reduced, inner))
+                {
+                    details::sum_contiguous(arg, out, outer, reduced, inner);
+                    const T count = static_cast<T>(reduced);
+                    std::transform(out, out + outer * inner, out, [count](T x) { return x / count; });
+                    return;
+                }
+
                 CoordinateTransform output_transform(out_shape);
                 std::vector<T> cs(shape_size(out_shape));
 
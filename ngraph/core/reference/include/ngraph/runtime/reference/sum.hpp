@@ -4,10 +4,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -41,12 +44,59 @@ namespace ngraph
                 return true;
             }
 
+            namespace details
+            {
+                /// \brief Kahan summation of {outer, reduced, inner} tensor over the middle axis.
+                /// Elements are accumulated in the same order as in the generic implementation.
+                template <typename T>
+                void sum_contiguous(
+                    const T* arg, T* out, size_t outer, size_t reduced, size_t inner)
+                {
+                    parallel_for(outer, reduced * inner, [&](size_t begin, size_t end) {
+                        std::vector<T> cs(inner);
+                        for (size_t o = begin; o < end; ++o)
+                        {
+                            T* dst = out + o * inner;
+                            std::fill(dst, dst + inner, T(0));
+                            std::fill(cs.begin(), cs.end(), T(0));
+                            const T* src = arg + o * reduced * inner;
+                            for (size_t r = 0; r < reduced; ++r, src += inner)
+                            {
+                                for (size_t i = 0; i < inner; ++i)
+                                {
+                                    const T x = src[i];
+                                    T& z = dst[i];
+                                    if (is_finite(x) && is_finite(z))
+                                    {
+                                        T& c = cs[i];
+                                        T t = z + (x - c);
+                                        c = (t - z) - (x - c);
+                                        z = t;
+                                    }
+                                    else
+                                    {
+                                        z = z + x;
+                                    }
+                                }
+                            }
+                        }
+                    });
+                }
+            } // namespace details
+
             template <typename T>
             void sum(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes)
             {
                 constexpr bool dont_keep_dims_in_output = false;
                 const auto out_shape = reduce(in_shape, reduction_axes, dont_keep_dims_in_output);
 
+                size_t outer, reduced, inner;
+                if (details::contiguous_reduction(in_shape, reduction_axes, outer, reduced, inner))
+                {
+                    details::sum_contiguous(arg, out, outer, reduced, inner);
+                    return;
+                }
+
                 std::vector<T> cs(shape_size(out_shape), 0);
                 std::fill(out, out + shape_size(out_shape), 0);
 
@@ -0,0 +1,95 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/parallel.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace details
+            {
+                /// \brief Checks that the reduction axes form a contiguous block of the shape
+                /// (dimensions equal to 1 are ignored), so the input can be viewed as
+                /// {outer, reduced, inner} tensor and the output as {outer, inner} one.
+                inline bool contiguous_reduction(const Shape& in_shape,
+                                                 const AxisSet& reduction_axes,
+                                                 size_t& outer,
+                                                 size_t& reduced,
+                                                 size_t& inner)
+                {
+                    enum
+                    {
+                        OUTER,
+                        REDUCED,
+                        INNER
+                    } part = OUTER;
+                    outer = reduced = inner = 1;
+                    for (size_t axis = 0; axis < in_shape.size(); ++axis)
+                    {
+                        if (in_shape[axis] == 1)
+                        {
+                            continue;
+                        }
+                        if (reduction_axes.count(axis))
+                        {
+                            if (part == INNER)
+                            {
+                                return false;
+                            }
+                            part = REDUCED;
+                            reduced *= in_shape[axis];
+                        }
+                        else
+                        {
+                            if (part == REDUCED)
+                            {
+                                part = INNER;
+                            }
+                            (part == OUTER ? outer : inner) *= in_shape[axis];
+                        }
+                    }
+                    return true;
+                }
+
+                /// \brief Reduces {outer, reduced, inner} tensor over the middle axis. Rows of
+                /// the output are computed in parallel and the innermost loop goes over
+                /// contiguous memory, so it is vectorized by the compiler.
+                template <typename T, typename Functor>
+                void reduce_contiguous(const T* arg,
+                                       T* out,
+                                       size_t outer,
+                                       size_t reduced,
+                                       size_t inner,
+                                       T init,
+                                       Functor reduce_functor)
+                {
+                    parallel_for(outer, reduced * inner, [&](size_t begin, size_t end) {
+                        for (size_t o = begin; o < end; ++o)
+                        {
+                            T* dst = out + o * inner;
+                            std::fill(dst, dst + inner, init);
+                            const T* src = arg + o * reduced * inner;
+                            for (size_t r = 0; r < reduced; ++r, src += inner)
+                            {
+                                for (size_t i = 0; i < inner; ++i)
+                                {
+                                    dst[i] = reduce_functor(dst[i], src[i]);
+                                }
+                            }
+                        }
+                    });
+                }
+            } // namespace details
+        }     // namespace reference
+    }         // namespace runtime
+} // namespace ngraph
@@ -3,11 +3,15 @@
 //
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
+#include <vector>
 
 #include "ngraph/check.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/shape_util.hpp"
 
 using namespace ngraph;
 
@@ -234,6 +238,87 @@ namespace
             }
         }
     }
+    template <typename T>
+    void reshape_strided(const char* in,
+                         char* out,
+                         const Shape& in_shape,
+                         const AxisVector& in_axis_order,
+                         const Shape& out_shape)
+    {
+        // the output is traversed in row-major order, sizes and input strides are permuted
+        const size_t rank = in_shape.size();
+        const auto in_strides = row_major_strides(in_shape);
+        std::vector<size_t> size(rank);
+        std::vector<size_t> stride(rank);
+        for (size_t i = 0; i < rank; i++)
+        {
+            size[i] = in_shape[in_axis_order[i]];
+            stride[i] = in_strides[in_axis_order[i]];
+        }
+
+        const size_t inner = size.back();
+        const size_t inner_stride = stride.back();
+        const size_t outer = shape_size(out_shape) / std::max<size_t>(1, inner);
+        const T* src = reinterpret_cast<const T*>(in);
+        T* dst = reinterpret_cast<T*>(out);
+
+        // rows of the output are copied in parallel
+        runtime::parallel_for(outer, inner, [&](size_t begin, size_t end) {
+            std::vector<size_t> coord(rank - 1);
+            size_t in_offset = 0;
+            for (size_t i = rank - 1, row = begin; i-- > 0;)
+            {
+                coord[i] = row % size[i];
+                row /= size[i];
+                in_offset += coord[i] * stride[i];
+            }
+            for (size_t row = begin; row < end; ++row)
+            {
+                const T* src_row = src + in_offset;
+                T* dst_row = dst + row * inner;
+                for (size_t j = 0; j < inner; ++j)
+                {
+                    dst_row[j] = src_row[j * inner_stride];
+                }
+                for (size_t i = rank - 1; i-- > 0;)
+                {
+                    in_offset += stride[i];
+                    if (++coord[i] < size[i])
+                    {
+                        break;
+                    }
+                    in_offset -= size[i] * stride[i];
+                    coord[i] = 0;
+                }
+            }
+        });
+    }
+
+    bool reshape_strided(const char* in,
+                         char* out,
+                         const Shape& in_shape,
+                         const AxisVector& in_axis_order,
+                         const Shape& out_shape,
+                         size_t elem_size)
+    {
+        const auto misaligned = [elem_size](const void* ptr) {
+            return reinterpret_cast<uintptr_t>(ptr) % elem_size != 0;
+        };
+        if (in_shape.empty() || misaligned(in) || misaligned(out))
+        {
+            return false;
+        }
+        switch (elem_size)
+        {
+        case 1: reshape_strided<uint8_t>(in, out, in_shape, in_axis_order, out_shape); break;
+        case 2: reshape_strided<uint16_t>(in, out, in_shape, in_axis_order, out_shape); break;
+        case 4: reshape_strided<uint32_t>(in, out, in_shape, in_axis_order, out_shape); break;
+        case 8: reshape_strided<uint64_t>(in, out, in_shape, in_axis_order, out_shape); break;
+        default: return false;
+        }
+        return true;
+    }
+
     bool no_axis_reordering(const AxisVector& axis_order)
     {
         auto tmp = axis_order;
@@ -255,6 +340,12 @@ void runtime::opt_kernel::reshape(const char* in,
         return;
     }
 
+    // elements of the common sizes are copied as integers with a single traversal
+    if (reshape_strided(in, out, in_shape, in_axis_order, out_shape, elem_size))
+    {
+        return;
+    }
+
     switch (in_shape.size())
     {
     case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
@@ -38,6 +38,7 @@ descriptor::Input::~Input()
 
 void descriptor::Input::replace_output(Output& new_output)
 {
+    m_node->invalidate_topology_cache();
     if (m_output != nullptr)
     {
         m_output->remove_input(this);
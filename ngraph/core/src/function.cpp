@@ -16,6 +16,7 @@
 #include "ngraph/op/util/variable_extension.hpp"
 #include "ngraph/opsets/opset7.hpp"
 #include "ngraph/validation_util.hpp"
+#include "topology_cache_state.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -215,7 +216,10 @@ void Function::prerequirements(bool detect_variables, bool detect_parameters)
 
     const auto& ordered_ops = get_ordered_ops();
     if (detect_parameters)
+    {
         m_parameters = auto_detect_parameters(ordered_ops);
+        invalidate_topology_cache();
+    }
     else
         check_all_parameters_registered(ordered_ops, m_parameters);
 
@@ -280,6 +284,28 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    std::lock_guard<std::mutex> lock(m_topology_cache_mutex);
+    if (m_topology_cache_state && m_topology_cache_state->is_valid())
+    {
+        // the cached nodes are reachable from the results, sinks or parameters while the graph
+        // is unchanged, an expired one means a modification which bypassed the invalidation
+        vector<shared_ptr<Node>> ordered_ops;
+        ordered_ops.reserve(m_cached_ordered_ops.size());
+        for (const auto& weak_node : m_cached_ordered_ops)
+        {
+            auto node = weak_node.lock();
+            if (!node)
+            {
+                break;
+            }
+            ordered_ops.push_back(std::move(node));
+        }
+        if (ordered_ops.size() == m_cached_ordered_ops.size())
+        {
+            return ordered_ops;
+        }
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -294,7 +320,29 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_ops = m_topological_sorter(nodes);
+
+    if (!m_topology_cache_state)
+    {
+        m_topology_cache_state = std::make_shared<TopologyCacheState>();
+    }
+    m_cached_ordered_ops.assign(ordered_ops.begin(), ordered_ops.end());
+    for (const auto& node : ordered_ops)
+    {
+        node->add_topology_cache_state(m_topology_cache_state);
+    }
+    m_topology_cache_state->set_valid(true);
+
+    return ordered_ops;
+}
+
+void Function::invalidate_topology_cache()
+{
+    std::lock_guard<std::mutex> lock(m_topology_cache_mutex);
+    if (m_topology_cache_state)
+    {
+        m_topology_cache_state->set_valid(false);
+    }
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -432,12 +480,9 @@ size_t Function::get_graph_size() const
     return total_size;
 }
 
-// TODO(pthoreho) this will be expensive, since we will be traversing all the nodes in
-// the graph, figure out if their is a way to cache the result and invalidate/update
-// the result if the function is modified
 bool Function::is_dynamic() const
 {
-    auto list_of_nodes = this->get_ops();
+    auto list_of_nodes = this->get_ordered_ops();
     for (auto& node : list_of_nodes)
     {
         if (node->get_output_partial_shape(0).is_dynamic())
@@ -458,11 +503,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    invalidate_topology_cache();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    invalidate_topology_cache();
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -540,12 +587,14 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    invalidate_topology_cache();
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    invalidate_topology_cache();
     for (const auto& sink : sinks)
     {
         if (const auto& variable_op = dynamic_pointer_cast<VariableExtension>(sink))
@@ -565,11 +614,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    invalidate_topology_cache();
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    invalidate_topology_cache();
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -579,6 +630,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    invalidate_topology_cache();
 }
 
 void Function::add_parameters(const ParameterVector& params)
@@ -595,6 +647,7 @@ void Function::add_parameters(const ParameterVector& params)
         }
     }
     m_parameters.insert(m_parameters.end(), params.begin(), params.end());
+    invalidate_topology_cache();
 }
 
 void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
@@ -604,6 +657,7 @@ void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
                        m_parameters.end(),
                        [&param](std::shared_ptr<op::v0::Parameter>& r) { return r == param; }),
         m_parameters.end());
+    invalidate_topology_cache();
 }
 
 void Function::add_variables(const VariableVector& variables)
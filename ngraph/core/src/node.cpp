@@ -16,6 +16,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "topology_cache_state.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -467,11 +468,52 @@ const std::vector<Node*>& Node::get_control_dependents() const
     return m_control_dependents;
 }
 
+void Node::invalidate_topology_cache()
+{
+    std::lock_guard<std::mutex> lock(m_topology_cache_states_mutex);
+    auto it = m_topology_cache_states.begin();
+    while (it != m_topology_cache_states.end())
+    {
+        if (auto state = it->lock())
+        {
+            state->set_valid(false);
+            ++it;
+        }
+        else
+        {
+            it = m_topology_cache_states.erase(it);
+        }
+    }
+}
+
+void Node::add_topology_cache_state(const std::shared_ptr<TopologyCacheState>& state)
+{
+    std::lock_guard<std::mutex> lock(m_topology_cache_states_mutex);
+    bool found = false;
+    auto it = m_topology_cache_states.begin();
+    while (it != m_topology_cache_states.end())
+    {
+        auto current = it->lock();
+        if (!current)
+        {
+            it = m_topology_cache_states.erase(it);
+            continue;
+        }
+        found = found || current == state;
+        ++it;
+    }
+    if (!found)
+    {
+        m_topology_cache_states.push_back(state);
+    }
+}
+
 void Node::add_control_dependency(std::shared_ptr<Node> node)
 {
     if (find(m_control_dependencies.begin(), m_control_dependencies.end(), node) ==
         m_control_dependencies.end())
     {
+        invalidate_topology_cache();
         m_control_dependencies.push_back(node);
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
@@ -509,6 +551,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end())
         {
+            invalidate_topology_cache();
             m_control_dependencies.erase(it);
         }
     }
@@ -523,6 +566,10 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
 
 void Node::clear_control_dependencies()
 {
+    if (!m_control_dependencies.empty())
+    {
+        invalidate_topology_cache();
+    }
     for (auto& node : m_control_dependencies)
     {
         auto it = find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this);
@@ -0,0 +1,61 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+
+#include "ngraph/runtime/parallel.hpp"
+
+using namespace ngraph;
+
+namespace
+{
+    std::atomic<runtime::ParallelForImpl> parallel_for_impl{nullptr};
+} // namespace
+
+void runtime::set_parallel_for_impl(ParallelForImpl impl)
+{
+    parallel_for_impl.store(impl);
+}
+
+bool runtime::has_parallel_for_impl()
+{
+    return parallel_for_impl.load() != nullptr;
+}
+
+void runtime::parallel_for(size_t work_amount, size_t item_cost, const ParallelForBody& body)
+{
+    if (work_amount == 0)
+    {
+        return;
+    }
+    auto impl = parallel_for_impl.load();
+    if (impl == nullptr || work_amount == 1 || work_amount * item_cost < parallel_for_min_work)
+    {
+        body(0, work_amount);
+        return;
+    }
+    // exceptions must not escape threads of the backend, the first one is rethrown here
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    impl(work_amount, [&](size_t begin, size_t end) {
+        try
+        {
+            body(begin, end);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    });
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
@@ -0,0 +1,25 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+
+namespace ngraph
+{
+    /// \brief Validity flag of the topological order cached by a Function.
+    ///
+    /// The flag is shared between the Function and all nodes which were reachable from it when
+    /// the order was computed, so any change of node inputs or control dependencies marks the
+    /// cached order of every function the node belongs to as stale.
+    class TopologyCacheState
+    {
+    public:
+        bool is_valid() const { return m_valid; }
+        void set_valid(bool valid) { m_valid = valid; }
+
+    private:
+        std::atomic<bool> m_valid{false};
+    };
+} // namespace ngraph
@@ -559,4 +559,46 @@ TEST(build_graph, build_graph_unregistred_variables)
 
     EXPECT_ANY_THROW(make_shared<Function>(OutputVector{res, res2}, SinkVector{assign, assign_2},
                                    ParameterVector{arg, arg2}, VariableVector{variable}));
-}
\ No newline at end of file
+}
+
+TEST(build_graph, topological_sort_cache_invalidation)
+{
+    using namespace opset7;
+    auto arg = make_shared<Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<Relu>(arg);
+    auto abs = make_shared<Abs>(relu);
+    auto res = make_shared<Result>(abs);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, relu, abs, res}));
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, relu, abs, res}));
+
+    // replace_node rewires the consumer inputs
+    auto exp = make_shared<Exp>(relu);
+    replace_node(abs, exp);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, relu, exp, res}));
+
+    // a replaced node isn't kept alive by the cached order
+    weak_ptr<Node> weak_abs = abs;
+    abs.reset();
+    EXPECT_TRUE(weak_abs.expired());
+
+    // input of a node in the middle of the graph
+    auto sigmoid = make_shared<Sigmoid>(arg);
+    exp->input(0).replace_source_output(sigmoid);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, sigmoid, exp, res}));
+
+    // control dependencies
+    auto floor = make_shared<Floor>(arg);
+    exp->add_control_dependency(floor);
+    EXPECT_EQ(f->get_ordered_ops().size(), 5);
+    exp->remove_control_dependency(floor);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, sigmoid, exp, res}));
+
+    // function results
+    auto res2 = make_shared<Result>(floor);
+    f->add_results(ResultVector{res2});
+    EXPECT_EQ(f->get_ordered_ops().size(), 6);
+    f->remove_result(res2);
+    EXPECT_EQ(f->get_ordered_ops(), (NodeVector{arg, sigmoid, exp, res}));
+}
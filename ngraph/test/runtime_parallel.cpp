@@ -0,0 +1,194 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/parallel.hpp"
+#include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/gather.hpp"
+#include "ngraph/runtime/reference/matmul.hpp"
+#include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/runtime/reference/transpose.hpp"
+
+using namespace ngraph;
+
+namespace
+{
+    void threads_parallel_for(size_t work_amount, const runtime::ParallelForBody& body)
+    {
+        constexpr size_t threads_count = 4;
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < threads_count; t++)
+        {
+            threads.emplace_back([&, t] {
+                const size_t begin = work_amount * t / threads_count;
+                const size_t end = work_amount * (t + 1) / threads_count;
+                if (begin < end)
+                {
+                    body(begin, end);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    std::vector<float> iota_data(size_t size)
+    {
+        std::vector<float> data(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            data[i] = static_cast<float>(i % 13) - 6.f;
+        }
+        return data;
+    }
+
+    // runs the kernel sequentially and with the parallel implementation installed
+    void compare_with_sequential(const Shape& out_shape,
+                                 const std::function<void(float*)>& kernel)
+    {
+        std::vector<float> sequential(shape_size(out_shape));
+        std::vector<float> parallel(shape_size(out_shape));
+        runtime::set_parallel_for_impl(nullptr);
+        kernel(sequential.data());
+        runtime::set_parallel_for_impl(threads_parallel_for);
+        kernel(parallel.data());
+        runtime::set_parallel_for_impl(nullptr);
+        EXPECT_EQ(sequential, parallel);
+    }
+} // namespace
+
+TEST(runtime_parallel, parallel_for_covers_range)
+{
+    runtime::set_parallel_for_impl(threads_parallel_for);
+    std::vector<int> visited(100000, 0);
+    runtime::parallel_for(visited.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            visited[i]++;
+        }
+    });
+    runtime::set_parallel_for_impl(nullptr);
+    EXPECT_EQ(std::accumulate(visited.begin(), visited.end(), 0), 100000);
+    EXPECT_EQ(*std::min_element(visited.begin(), visited.end()), 1);
+}
+
+TEST(runtime_parallel, parallel_for_rethrows)
+{
+    runtime::set_parallel_for_impl(threads_parallel_for);
+    EXPECT_THROW(runtime::parallel_for(100000,
+                                       1,
+                                       [](size_t begin, size_t) {
+                                           if (begin == 0)
+                                               throw std::domain_error("error");
+                                       }),
+                 std::domain_error);
+    runtime::set_parallel_for_impl(nullptr);
+}
+
+TEST(runtime_parallel, matmul)
+{
+    const Shape arg0_shape{3, 64, 48};
+    const Shape arg1_shape{48, 80};
+    const Shape out_shape{3, 64, 80};
+    const auto arg0 = iota_data(shape_size(arg0_shape));
+    const auto arg1 = iota_data(shape_size(arg1_shape));
+    compare_with_sequential(out_shape, [&](float* out) {
+        runtime::reference::matmul(
+            arg0.data(), arg1.data(), out, arg0_shape, arg1_shape, out_shape, false, false);
+    });
+}
+
+TEST(runtime_parallel, convolution)
+{
+    const Shape in_shape{2, 8, 33, 31};
+    const Shape f_shape{16, 8, 3, 3};
+    const Shape out_shape{2, 16, 17, 16};
+    const auto in = iota_data(shape_size(in_shape));
+    const auto f = iota_data(shape_size(f_shape));
+    compare_with_sequential(out_shape, [&](float* out) {
+        runtime::reference::convolution(in.data(),
+                                        f.data(),
+                                        out,
+                                        in_shape,
+                                        f_shape,
+                                        out_shape,
+                                        Strides{2, 2},
+                                        Strides{1, 1},
+                                        CoordinateDiff{1, 1},
+                                        CoordinateDiff{1, 1});
+    });
+}
+
+TEST(runtime_parallel, reduce)
+{
+    const Shape in_shape{16, 32, 24, 8};
+    const auto in = iota_data(shape_size(in_shape));
+    for (const auto& axes : {AxisSet{2, 3}, AxisSet{1}, AxisSet{0, 2}})
+    {
+        const auto out_shape = reduce(in_shape, axes, false);
+        compare_with_sequential(out_shape, [&](float* out) {
+            runtime::reference::sum(in.data(), out, in_shape, axes);
+        });
+        compare_with_sequential(out_shape, [&](float* out) {
+            runtime::reference::max(in.data(), out, in_shape, axes);
+        });
+    }
+}
+
+TEST(runtime_parallel, transpose)
+{
+    const Shape in_shape{8, 16, 24, 32};
+    const Shape out_shape{24, 8, 32, 16};
+    const std::vector<int64_t> order{2, 0, 3, 1};
+    const auto in = iota_data(shape_size(in_shape));
+    compare_with_sequential(out_shape, [&](float* out) {
+        runtime::reference::transpose(reinterpret_cast<const char*>(in.data()),
+                                      reinterpret_cast<char*>(out),
+                                      in_shape,
+                                      sizeof(float),
+                                      order.data(),
+                                      out_shape);
+    });
+}
+
+TEST(runtime_parallel, gather)
+{
+    const Shape data_shape{10, 200, 30};
+    const Shape indices_shape{5};
+    const Shape out_shape{10, 5, 30};
+    const std::vector<int32_t> indices{3, -1, 0, 7, 7};
+    const auto data = iota_data(shape_size(data_shape));
+    compare_with_sequential(out_shape, [&](float* out) {
+        runtime::reference::gather(
+            data.data(), indices.data(), out, data_shape, indices_shape, out_shape, 1);
+    });
+}
+
+TEST(runtime_parallel, add_numpy_broadcast)
+{
+    const Shape arg0_shape{8, 1, 64, 1};
+    const Shape arg1_shape{3, 1, 50};
+    const Shape out_shape{8, 3, 64, 50};
+    const auto arg0 = iota_data(shape_size(arg0_shape));
+    const auto arg1 = iota_data(shape_size(arg1_shape));
+    compare_with_sequential(out_shape, [&](float* out) {
+        runtime::reference::add(arg0.data(),
+                                arg1.data(),
+                                out,
+                                arg0_shape,
+                                arg1_shape,
+                                op::AutoBroadcastSpec::NUMPY);
+    });
+}